@@ -3,6 +3,8 @@
 #include "benchmark_config.hpp"
 #include "benchmark_table_encoder.hpp"
 #include "operators/export_binary.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/format_duration.hpp"
 #include "utils/timer.hpp"
@@ -19,6 +21,32 @@ void AbstractTableGenerator::generate_and_store() {
   auto table_info_by_name = generate();
   std::cout << "- Loading/Generating tables done (" << timer.lap_formatted() << ")" << std::endl;
 
+  /**
+   * Sort the Tables if required
+   */
+  if (_benchmark_config->sort_tables) {
+    std::cout << "- Sorting tables if necessary" << std::endl;
+    for (const auto& [table_name, column_name] : _sort_columns_by_table()) {
+      auto& table_info = table_info_by_name.at(table_name);
+      const auto column_id = table_info.table->column_id_by_name(column_name);
+
+      // Tables loaded from binary files that were written after sorting are sorted already
+      auto is_sorted = true;
+      for (auto chunk_id = ChunkID{0}; chunk_id < table_info.table->chunk_count(); ++chunk_id) {
+        const auto& ordered_by = table_info.table->get_chunk(chunk_id)->ordered_by();
+        is_sorted &= ordered_by && ordered_by->first == column_id;
+      }
+      if (is_sorted) continue;
+
+      std::cout << "-  Sorting '" << table_name << "' by '" << column_name << "' " << std::flush;
+      Timer per_table_timer;
+      table_info.table = _sort_table(table_info.table, column_id);
+      table_info.binary_file_out_of_date = true;
+      std::cout << "(" << per_table_timer.lap_formatted() << ")" << std::endl;
+    }
+    std::cout << "- Sorting tables done (" << timer.lap_formatted() << ")" << std::endl;
+  }
+
   /**
    * Encode the Tables
    */
@@ -77,4 +105,26 @@ void AbstractTableGenerator::generate_and_store() {
             << std::endl;
 }
 
+std::unordered_map<std::string, std::string> AbstractTableGenerator::_sort_columns_by_table() const { return {}; }
+
+std::shared_ptr<Table> AbstractTableGenerator::_sort_table(const std::shared_ptr<Table>& table,
+                                                           const ColumnID column_id) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto sort = std::make_shared<Sort>(table_wrapper, column_id, OrderByMode::Ascending, table->max_chunk_size());
+  sort->execute();
+  const auto sorted_table = sort->get_output();
+
+  // The output of the Sort operator has no MVCC data, so its segments are added to a table with the original setting
+  const auto stored_table = std::make_shared<Table>(table->column_definitions(), TableType::Data,
+                                                    table->max_chunk_size(), table->has_mvcc());
+  for (auto chunk_id = ChunkID{0}; chunk_id < sorted_table->chunk_count(); ++chunk_id) {
+    const auto chunk = sorted_table->get_chunk(chunk_id);
+    stored_table->append_chunk(chunk->segments());
+    stored_table->get_chunk(chunk_id)->set_ordered_by(*chunk->ordered_by());
+  }
+
+  return stored_table;
+}
+
 }  // namespace opossum
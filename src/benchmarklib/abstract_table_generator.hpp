@@ -51,6 +51,16 @@ class AbstractTableGenerator {
    */
   static std::shared_ptr<BenchmarkConfig> _create_minimal_benchmark_config(uint32_t chunk_size);
 
+  /**
+   * @return A table_name -> column_name mapping of the tables that are sorted by generate_and_store() if
+   *         BenchmarkConfig::sort_tables is set. The chunks of these tables are marked as ordered (see
+   *         Chunk::ordered_by()), so that scans on the sort column can use binary search.
+   */
+  virtual std::unordered_map<std::string, std::string> _sort_columns_by_table() const;
+
+  // Sorts the rows of a stored table by the given column. The returned table keeps the chunk size and MVCC setting.
+  static std::shared_ptr<Table> _sort_table(const std::shared_ptr<Table>& table, const ColumnID column_id);
+
   const std::shared_ptr<BenchmarkConfig> _benchmark_config;
 };
 
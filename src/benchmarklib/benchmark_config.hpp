@@ -24,7 +24,8 @@ class BenchmarkConfig {
                   const Duration& warmup_duration, const UseMvcc use_mvcc,
                   const std::optional<std::string>& output_file_path, const bool enable_scheduler, const uint32_t cores,
                   const uint32_t clients, const bool enable_visualization, const bool verify,
-                  const bool cache_binary_tables);
+                  const bool cache_binary_tables, const bool sort_tables,
+                  const std::optional<std::string>& trace_file_path);
 
   static BenchmarkConfig get_default_config();
 
@@ -42,6 +43,8 @@ class BenchmarkConfig {
   bool enable_visualization = false;
   bool verify = false;
   bool cache_binary_tables = false;
+  bool sort_tables = false;
+  std::optional<std::string> trace_file_path = std::nullopt;
 
   static const char* description;
 
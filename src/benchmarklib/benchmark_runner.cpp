@@ -20,6 +20,7 @@
 #include "utils/format_duration.hpp"
 #include "utils/sqlite_wrapper.hpp"
 #include "utils/timer.hpp"
+#include "utils/tracing/trace_recorder.hpp"
 #include "version.hpp"
 #include "visualization/lqp_visualizer.hpp"
 #include "visualization/pqp_visualizer.hpp"
@@ -97,6 +98,8 @@ void BenchmarkRunner::run() {
   _query_plans.resize(available_queries_count);
   _query_results.resize(available_queries_count);
 
+  if (_config.trace_file_path) TraceRecorder::get().enable();
+
   auto benchmark_start = std::chrono::steady_clock::now();
 
   // Run the queries in the selected mode
@@ -114,6 +117,12 @@ void BenchmarkRunner::run() {
   auto benchmark_end = std::chrono::steady_clock::now();
   _total_run_duration = benchmark_end - benchmark_start;
 
+  if (_config.trace_file_path) {
+    TraceRecorder::get().disable();
+    std::ofstream trace_file(*_config.trace_file_path);
+    TraceRecorder::get().write_chrome_trace(trace_file);
+  }
+
   // Create report
   if (_config.output_file_path) {
     std::ofstream output_file(*_config.output_file_path);
@@ -498,7 +507,9 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
     ("mvcc", "Enable MVCC", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("visualize", "Create a visualization image of one LQP and PQP for each query", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("verify", "Verify each query by comparing it with the SQLite result", cxxopts::value<bool>()->default_value("false")) // NOLINT
-    ("cache_binary_tables", "Cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("cache_binary_tables", "Cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("sort_tables", "Sort tables that have a natural order (e.g., TPC-H's lineitem by l_shipdate) when loading them, so that scans on the sort column can use binary search", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("trace", "Write a Chrome trace (chrome://tracing, ui.perfetto.dev) of the most recent operator and task executions to this file", cxxopts::value<std::string>()->default_value("")); // NOLINT
   // clang-format on
 
   return cli_options;
@@ -130,10 +130,22 @@ BenchmarkConfig CLIConfigParser::parse_basic_options_json_config(const nlohmann:
     std::cout << "- Not caching tables as binary files" << std::endl;
   }
 
+  const auto sort_tables = json_config.value("sort_tables", default_config.sort_tables);
+  if (sort_tables) {
+    std::cout << "- Sorting tables by their sort columns when loading them" << std::endl;
+  }
+
+  std::optional<std::string> trace_file_path;
+  const auto trace_file_string = json_config.value("trace", "");
+  if (!trace_file_string.empty()) {
+    trace_file_path = trace_file_string;
+    std::cout << "- Writing a Chrome trace of the query execution to '" << *trace_file_path << "'" << std::endl;
+  }
+
   return BenchmarkConfig{
-      benchmark_mode, chunk_size,         *encoding_config, max_runs, timeout_duration, warmup_duration,
-      use_mvcc,       output_file_path,   enable_scheduler, cores,    clients,          enable_visualization,
-      verify,         cache_binary_tables};
+      benchmark_mode, chunk_size,          *encoding_config, max_runs,        timeout_duration, warmup_duration,
+      use_mvcc,       output_file_path,    enable_scheduler, cores,           clients,          enable_visualization,
+      verify,         cache_binary_tables, sort_tables,      trace_file_path};
 }
 
 BenchmarkConfig CLIConfigParser::parse_basic_cli_options(const cxxopts::ParseResult& parse_result) {
@@ -158,6 +170,8 @@ nlohmann::json CLIConfigParser::basic_cli_options_to_json(const cxxopts::ParseRe
   json_config.emplace("output", parse_result["output"].as<std::string>());
   json_config.emplace("verify", parse_result["verify"].as<bool>());
   json_config.emplace("cache_binary_tables", parse_result["cache_binary_tables"].as<bool>());
+  json_config.emplace("sort_tables", parse_result["sort_tables"].as<bool>());
+  json_config.emplace("trace", parse_result["trace"].as<std::string>());
 
   return json_config;
 }
@@ -346,4 +346,8 @@ std::unordered_map<std::string, BenchmarkTableInfo> TpchTableGenerator::generate
   return table_info_by_name;
 }
 
+std::unordered_map<std::string, std::string> TpchTableGenerator::_sort_columns_by_table() const {
+  return {{"lineitem", "l_shipdate"}, {"orders", "o_orderdate"}};
+}
+
 }  // namespace opossum
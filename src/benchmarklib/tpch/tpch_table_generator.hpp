@@ -37,6 +37,10 @@ class TpchTableGenerator final : public AbstractTableGenerator {
 
   std::unordered_map<std::string, BenchmarkTableInfo> generate() override;
 
+ protected:
+  // Many TPC-H queries filter lineitem and orders by date ranges
+  std::unordered_map<std::string, std::string> _sort_columns_by_table() const override;
+
  private:
   float _scale_factor;
 };
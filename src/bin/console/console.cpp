@@ -7,6 +7,7 @@
 #include <boost/range/adaptors.hpp>
 
 #include <chrono>
+#include <cerrno>
 #include <csetjmp>
 #include <csignal>
 #include <cstdlib>
@@ -24,6 +25,7 @@
 #include "concurrency/transaction_manager.hpp"
 #include "constant_mappings.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
+#include "operators/chunk_pipeline.hpp"
 #include "operators/export_binary.hpp"
 #include "operators/export_csv.hpp"
 #include "operators/get_table.hpp"
@@ -35,6 +37,7 @@
 #include "pagination.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/query_context.hpp"
 #include "scheduler/topology.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_pipeline_statement.hpp"
@@ -49,6 +52,7 @@
 #include "utils/load_table.hpp"
 #include "utils/plugin_manager.hpp"
 #include "utils/string_utils.hpp"
+#include "utils/tracing/trace_recorder.hpp"
 #include "visualization/join_graph_visualizer.hpp"
 #include "visualization/lqp_visualizer.hpp"
 #include "visualization/pqp_visualizer.hpp"
@@ -132,6 +136,8 @@ Console::Console()
   register_command("rollback", std::bind(&Console::_rollback_transaction, this, std::placeholders::_1));
   register_command("commit", std::bind(&Console::_commit_transaction, this, std::placeholders::_1));
   register_command("txinfo", std::bind(&Console::_print_transaction_info, this, std::placeholders::_1));
+  register_command("schedulerinfo", std::bind(&Console::_print_scheduler_info, this, std::placeholders::_1));
+  register_command("trace", std::bind(&Console::_trace, this, std::placeholders::_1));
   register_command("pwd", std::bind(&Console::_print_current_working_directory, this, std::placeholders::_1));
   register_command("setting", std::bind(&Console::_change_runtime_setting, this, std::placeholders::_1));
   register_command("load_plugin", std::bind(&Console::_load_plugin, this, std::placeholders::_1));
@@ -400,13 +406,18 @@ int Console::_help(const std::string&) {
   out("  rollback                                - Roll back a manually created transaction\n");
   out("  commit                                  - Commit a manually created transaction\n");
   out("  txinfo                                  - Print information on the current transaction\n");
+  out("  schedulerinfo                           - Print queue wait times, execution times, and per-worker statistics of the scheduler\n");  // NOLINT
+  out("  trace on                                - Start recording the execution of operators and tasks\n");
+  out("  trace off [FILE]                        - Stop recording and write a Chrome trace (chrome://tracing, ui.perfetto.dev)\n");  // NOLINT
+  out("                                            to FILE. Default: trace.json\n");
   out("  pwd                                     - Print current working directory\n");
   out("  load_plugin FILE                        - Load and start plugin stored at FILE\n");
   out("  unload_plugin NAME                      - Stop and unload the plugin libNAME.so/dylib (also clears the query cache)\n");  // NOLINT
   out("  quit                                    - Exit the HYRISE Console\n");
   out("  help                                    - Show this message\n\n");
   out("  setting [property] [value]              - Change a runtime setting\n\n");
-  out("           scheduler (on|off)             - Turn the scheduler on (default) or off\n\n");
+  out("           scheduler (on|off)             - Turn the scheduler on (default) or off\n");
+  out("           max_concurrent_tasks (N|unlimited) - Limit the number of tasks a query runs at once (default: unlimited)\n\n");  // NOLINT
   // clang-format on
 
   return Console::ReturnCode::Ok;
@@ -782,6 +793,41 @@ int Console::_change_runtime_setting(const std::string& input) {
     return 0;
   }
 
+  if (property == "pipelining") {
+    if (value == "on") {
+      ChunkPipeline::set_enabled(true);
+      out("Pipelined execution of scans, validates, and projections turned on\n");
+    } else if (value == "off") {
+      ChunkPipeline::set_enabled(false);
+      out("Pipelined execution of scans, validates, and projections turned off\n");
+    } else {
+      out("Usage: pipelining (on|off)\n");
+      return 1;
+    }
+    return 0;
+  }
+
+  if (property == "max_concurrent_tasks") {
+    if (value == "unlimited") {
+      QueryContext::set_default_max_concurrent_tasks(QueryContext::UNLIMITED_CONCURRENT_TASKS);
+      out("Queries run an unlimited number of tasks at once\n");
+      return 0;
+    }
+
+    char* endptr{nullptr};
+    errno = 0;
+    const auto max_concurrent_tasks = std::strtoul(value.c_str(), &endptr, 10);
+    if (errno != 0 || max_concurrent_tasks == 0 || max_concurrent_tasks >= QueryContext::UNLIMITED_CONCURRENT_TASKS ||
+        *endptr != 0) {
+      out("Usage: max_concurrent_tasks (N|unlimited)\n");
+      return 1;
+    }
+
+    QueryContext::set_default_max_concurrent_tasks(static_cast<uint32_t>(max_concurrent_tasks));
+    out("Queries run at most " + std::to_string(max_concurrent_tasks) + " tasks at once\n");
+    return 0;
+  }
+
   out("Error: Unknown property\n");
   return 1;
 }
@@ -897,6 +943,48 @@ int Console::_print_transaction_info(const std::string& input) {
   return ReturnCode::Ok;
 }
 
+int Console::_print_scheduler_info(const std::string& input) {
+  const auto scheduler = std::dynamic_pointer_cast<NodeQueueScheduler>(CurrentScheduler::get());
+  if (!scheduler) {
+    out("The scheduler is turned off. Type `setting scheduler on` to turn it on.\n");
+    return ReturnCode::Error;
+  }
+
+  out(scheduler->metrics().to_string());
+  return ReturnCode::Ok;
+}
+
+int Console::_trace(const std::string& args) {
+  const auto arguments = trim_and_split(args);
+  auto& trace_recorder = TraceRecorder::get();
+
+  if (arguments.size() == 1 && arguments[0] == "on") {
+    trace_recorder.enable();
+    out("Tracing turned on\n");
+    return ReturnCode::Ok;
+  }
+
+  if ((arguments.size() == 1 || arguments.size() == 2) && arguments[0] == "off") {
+    trace_recorder.disable();
+
+    const auto filename = arguments.size() == 2 ? arguments[1] : std::string{"trace.json"};
+    std::ofstream trace_file(filename);
+    trace_recorder.write_chrome_trace(trace_file);
+    if (!trace_file) {
+      out("Error: Could not write trace to '" + filename + "'\n");
+      return ReturnCode::Error;
+    }
+
+    out("Tracing turned off, trace written to '" + filename + "'\n");
+    return ReturnCode::Ok;
+  }
+
+  out("Usage:\n");
+  out("  trace on\n");
+  out("  trace off [FILE]\n");
+  return ReturnCode::Error;
+}
+
 int Console::_print_current_working_directory(const std::string&) {
   out(filesystem::current_path().string() + "\n");
   return ReturnCode::Ok;
@@ -2,10 +2,13 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <chrono>
 #include <iostream>
+#include <optional>
 
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/query_context.hpp"
 #include "scheduler/topology.hpp"
 #include "server/server.hpp"
 #include "storage/storage_manager.hpp"
@@ -23,6 +26,29 @@ int main(int argc, char* argv[]) {
       port = static_cast<uint16_t>(port_long);
     }
 
+    // Optionally, queries that take longer than the given number of milliseconds are cancelled
+    auto statement_timeout = std::optional<std::chrono::milliseconds>{};
+
+    if (argc >= 3) {
+      char* endptr{nullptr};
+      errno = 0;
+      auto timeout_long = std::strtol(argv[2], &endptr, 10);
+      Assert(errno == 0 && timeout_long > 0 && *endptr == 0, "invalid statement timeout");
+      statement_timeout = std::chrono::milliseconds{timeout_long};
+    }
+
+    // Optionally, each query runs at most the given number of tasks at once, so that large queries leave workers to the
+    // queries of other sessions
+    if (argc >= 4) {
+      char* endptr{nullptr};
+      errno = 0;
+      auto max_concurrent_tasks_long = std::strtol(argv[3], &endptr, 10);
+      Assert(errno == 0 && max_concurrent_tasks_long > 0 &&
+                 max_concurrent_tasks_long < opossum::QueryContext::UNLIMITED_CONCURRENT_TASKS && *endptr == 0,
+             "invalid number of concurrent tasks per query");
+      opossum::QueryContext::set_default_max_concurrent_tasks(static_cast<uint32_t>(max_concurrent_tasks_long));
+    }
+
     // Set scheduler so that the server can execute the tasks on separate threads.
     opossum::CurrentScheduler::set(std::make_shared<opossum::NodeQueueScheduler>());
 
@@ -31,7 +57,7 @@ int main(int argc, char* argv[]) {
     // The server registers itself to the boost io_service. The io_service is the main IO control unit here and it lives
     // until the server doesn't request any IO any more, i.e. is has terminated. The server requests IO in its
     // constructor and then runs forever.
-    opossum::Server server{io_service, port};
+    opossum::Server server{io_service, port, statement_timeout};
 
     io_service.run();
   } catch (std::exception& e) {
@@ -11,21 +11,28 @@ CommitID CommitContext::commit_id() const { return _commit_id; }
 
 bool CommitContext::is_pending() const { return _pending; }
 
-void CommitContext::make_pending(const TransactionID transaction_id,
-                                 const std::function<void(TransactionID)>& callback) {
+void CommitContext::make_pending(const TransactionID transaction_id, const std::function<void(TransactionID)>& callback,
+                                 const std::function<void()>& validation_callback) {
   if (callback) {
     _callback = [callback, transaction_id]() { callback(transaction_id); };
   }
+  _validation_callback = validation_callback;
 
   // This line MUST be AFTER setting the callback. Otherwise we run into a race condition while committing, because this
   // is 'pending' but the callback is not there yet.
   _pending = true;
 }
 
+void CommitContext::validate() {
+  if (_validation_callback) _validation_callback();
+}
+
 void CommitContext::fire_callback() {
   if (_callback) _callback();
 }
 
+RedoLogRecords& CommitContext::redo_log_records() { return _redo_log_records; }
+
 bool CommitContext::has_next() const { return next() != nullptr; }
 
 std::shared_ptr<CommitContext> CommitContext::next() { return std::atomic_load(&_next); }
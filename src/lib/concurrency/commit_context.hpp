@@ -4,6 +4,7 @@
 #include <functional>
 #include <memory>
 
+#include "logging/redo_log_records.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -28,14 +29,28 @@ class CommitContext : private Noncopyable {
    * as soon as all previous pending have been committed.
    *
    * @param callback called when transaction is committed
+   * @param validation_callback called right before the transaction becomes visible, after all previous transactions
+   *                            have been validated. Used to check constraints and to roll the transaction back.
    */
-  void make_pending(const TransactionID transaction_id, const std::function<void(TransactionID)>& callback = nullptr);
+  void make_pending(const TransactionID transaction_id, const std::function<void(TransactionID)>& callback = nullptr,
+                    const std::function<void()>& validation_callback = nullptr);
+
+  /**
+   * Calls the validation_callback of make_pending
+   */
+  void validate();
 
   /**
    * Calls the callback of make_pending
    */
   void fire_callback();
 
+  /**
+   * The redo records of the transaction, which are written while its operators commit their records and appended to
+   * the RedoLog by the committer. Only written if the RedoLog is enabled.
+   */
+  RedoLogRecords& redo_log_records();
+
   bool has_next() const;
 
   std::shared_ptr<CommitContext> next();
@@ -53,5 +68,7 @@ class CommitContext : private Noncopyable {
   std::atomic<bool> _pending;  // true if context is waiting to be committed
   std::shared_ptr<CommitContext> _next;
   std::function<void()> _callback;
+  std::function<void()> _validation_callback;
+  RedoLogRecords _redo_log_records;
 };
 }  // namespace opossum
@@ -53,6 +53,18 @@ CommitID TransactionContext::commit_id() const {
   return _commit_context->commit_id();
 }
 
+RedoLogRecords& TransactionContext::redo_log_records() {
+  Assert((_commit_context != nullptr), "Redo log records only available after commit context has been created.");
+
+  return _commit_context->redo_log_records();
+}
+
+void TransactionContext::add_redo_log_records(const RedoLogRecords& records) {
+  Assert(_phase == TransactionPhase::Active, "Redo log records can only be added to active transactions.");
+
+  _added_redo_log_records.append(records);
+}
+
 TransactionPhase TransactionContext::phase() const { return _phase; }
 
 bool TransactionContext::aborted() const {
@@ -146,6 +158,7 @@ bool TransactionContext::_prepare_commit() {
   _wait_for_active_operators_to_finish();
 
   _commit_context = TransactionManager::get()._new_commit_context();
+  _commit_context->redo_log_records().append(_added_redo_log_records);
   return true;
 }
 
@@ -159,7 +172,7 @@ void TransactionContext::_mark_as_pending_and_try_commit(std::function<void(Tran
               "All read/write operators need to have been committed.");
 
   auto context_weak_ptr = std::weak_ptr<TransactionContext>{this->shared_from_this()};
-  _commit_context->make_pending(_transaction_id, [context_weak_ptr, callback](auto transaction_id) {
+  const auto validation_callback = [context_weak_ptr]() {
     // If the transaction context still exists, set its phase to Committed.
     if (auto context_ptr = context_weak_ptr.lock()) {
       auto no_constraint_violations = true;
@@ -181,6 +194,7 @@ void TransactionContext::_mark_as_pending_and_try_commit(std::function<void(Tran
             context_ptr->_transition(TransactionPhase::Committing, TransactionPhase::Active,
                                      TransactionPhase::RolledBack);
             context_ptr->rollback();
+            context_ptr->_commit_context->redo_log_records().clear();
             no_constraint_violations = false;
             break;
           }
@@ -190,9 +204,10 @@ void TransactionContext::_mark_as_pending_and_try_commit(std::function<void(Tran
       // gets rolled back immediately.
       if (no_constraint_violations) context_ptr->_phase = TransactionPhase::Committed;
     }
+  };
 
-    if (callback) callback(transaction_id);
-  });
+  // The callback is only called once the transaction is visible, so that the caller of commit() can see its changes
+  _commit_context->make_pending(_transaction_id, callback, validation_callback);
 
   TransactionManager::get()._try_increment_last_commit_id(_commit_context);
 }
@@ -5,6 +5,7 @@
 #include <memory>
 #include <vector>
 
+#include "logging/redo_log_records.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -114,6 +115,19 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
    */
   void register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op) { _rw_operators.push_back(op); }
 
+  /**
+   * The records that the read-write operators write to the RedoLog when they commit their records.
+   * Only available after TransactionManager::prepare_commit has been called
+   */
+  RedoLogRecords& redo_log_records();
+
+  /**
+   * Adds records that are not written by read-write operators, e.g., of a CREATE TABLE, which takes effect right away
+   * and is thus logged in a transaction of its own. They are added to the redo_log_records() when the commit is
+   * prepared. Must only be called if the RedoLog is enabled.
+   */
+  void add_redo_log_records(const RedoLogRecords& records);
+
   /**
    * @defgroup Update the counter of active operators
    * @{
@@ -180,6 +194,7 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
 
   std::atomic<TransactionPhase> _phase;
   std::shared_ptr<CommitContext> _commit_context;
+  RedoLogRecords _added_redo_log_records;
 
   std::atomic_size_t _num_active_operators;
 
@@ -1,8 +1,13 @@
 #include "transaction_manager.hpp"
 
 #include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include "commit_context.hpp"
+#include "logging/redo_log.hpp"
+#include "logging/redo_log_records.hpp"
 #include "transaction_context.hpp"
 #include "utils/assert.hpp"
 
@@ -13,12 +18,18 @@ void TransactionManager::reset() {
   manager._next_transaction_id = INITIAL_TRANSACTION_ID;
   manager._last_commit_id = INITIAL_COMMIT_ID;
   manager._last_commit_context = std::make_shared<CommitContext>(INITIAL_COMMIT_ID);
+  std::atomic_store(&manager._last_appended_context, manager._last_commit_context);
+
+  // A committer that was interrupted (e.g., by an exception in a test) must not block the commits after the reset.
+  // Threads that wait for the old commit contexts are woken up and stop waiting.
+  manager._release_committer();
 }
 
 TransactionManager::TransactionManager()
     : _next_transaction_id{INITIAL_TRANSACTION_ID},
       _last_commit_id{INITIAL_COMMIT_ID},
-      _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)} {}
+      _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)},
+      _last_appended_context{_last_commit_context} {}
 
 CommitID TransactionManager::last_commit_id() const { return _last_commit_id; }
 
@@ -26,6 +37,26 @@ std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context(
   return std::make_shared<TransactionContext>(_next_transaction_id++, _last_commit_id);
 }
 
+std::pair<std::shared_ptr<TransactionContext>, uint64_t> TransactionManager::new_transaction_context_at_log_position() {
+  // Become the committer, so that no transaction is appended to the log in the meantime
+  _become_committer();
+
+  // The snapshot has to contain all transactions before the log position, including the ones that have been appended
+  // but are not visible yet, as they wait for the log to be flushed
+  {
+    std::unique_lock<std::mutex> lock(_commit_mutex);
+    _commit_condition_variable.wait(
+        lock, [&]() { return _last_commit_id >= std::atomic_load(&_last_appended_context)->commit_id(); });
+  }
+
+  auto context = new_transaction_context();
+  const auto log_position = RedoLog::get().is_enabled() ? RedoLog::get().appended_position() : uint64_t{0};
+
+  _release_committer();
+
+  return {context, log_position};
+}
+
 /**
  * Logic of the lock-free algorithm
  *
@@ -66,23 +97,112 @@ std::shared_ptr<CommitContext> TransactionManager::_new_commit_context() {
   return next_context;
 }
 
+/**
+ * Logic of the group commit
+ *
+ * Whoever marks a context as pending tries to become the committer by setting _is_committing. The committer commits
+ * one group, i.e., all pending contexts that directly follow the last committed one, and steps down. Threads that
+ * failed to become the committer block until their context is committed or the committer stepped down, in which case
+ * they try to become the committer themselves. Thus, the contexts that became pending while a group was committed
+ * form the next group.
+ *
+ * A thread stops waiting once its context is part of a group, or if the context that follows the last group is not
+ * pending, i.e., a previous transaction has not finished its commit yet. Its thread commits the waiting context later
+ * on, as it waits for its own context to be committed.
+ *
+ * If the RedoLog is enabled, a group only becomes visible once it is durable. The committer does not wait for that: it
+ * steps down right after appending the group to the log, so that the next group can be validated and appended while
+ * the previous one is flushed. The logger thread publishes the group (see _publish_group()).
+ */
 void TransactionManager::_try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context) {
-  auto current_context = context;
+  DebugAssert(context->is_pending(), "Only pending contexts can be committed");
+
+  while (true) {
+    if (!_is_committing.exchange(true)) {
+      _commit_pending_group();
+      _release_committer();
+    }
+
+    // Once the context is part of a group, its callback is called when the group becomes visible
+    const auto last_appended_context = std::atomic_load(&_last_appended_context);
+    if (last_appended_context->commit_id() >= context->commit_id()) return;
 
-  while (current_context->is_pending()) {
-    auto expected_last_commit_id = current_context->commit_id() - 1;
+    const auto next_context = last_appended_context->next();
+    if (!next_context || !next_context->is_pending()) return;
 
-    if (_last_commit_id.load() != expected_last_commit_id) return;
+    // The committer steps down while holding the mutex, so that the notification cannot be missed
+    std::unique_lock<std::mutex> lock(_commit_mutex);
+    _commit_condition_variable.wait(lock, [&]() {
+      return !_is_committing || std::atomic_load(&_last_appended_context)->commit_id() >= context->commit_id();
+    });
+  }
+}
+
+void TransactionManager::_become_committer() {
+  std::unique_lock<std::mutex> lock(_commit_mutex);
+  _commit_condition_variable.wait(lock, [&]() { return !_is_committing.exchange(true); });
+}
+
+void TransactionManager::_release_committer() {
+  {
+    std::lock_guard<std::mutex> lock(_commit_mutex);
+    _is_committing = false;
+  }
+  _commit_condition_variable.notify_all();
+}
+
+void TransactionManager::_commit_pending_group() {
+  auto group = std::vector<std::shared_ptr<CommitContext>>{};
+  const auto last_appended_context = std::atomic_load(&_last_appended_context);
+  for (auto context = last_appended_context->next(); context && context->is_pending(); context = context->next()) {
+    group.emplace_back(context);
+  }
+  if (group.empty()) return;
 
-    current_context->fire_callback();
+  // Validation might roll a transaction back, which has to happen before it becomes visible. Each transaction is
+  // validated after the ones before it.
+  for (const auto& context : group) {
+    context->validate();
+  }
 
-    if (!_last_commit_id.compare_exchange_strong(expected_last_commit_id, current_context->commit_id())) {
-      Fail("TransactionManager found illegal state of _last_commit_id");
+  // The redo records are appended by the committer, so that the log holds the transactions in commit order
+  auto& redo_log = RedoLog::get();
+  const auto is_logged = redo_log.is_enabled();
+  auto log_position = uint64_t{0};
+  if (is_logged) {
+    auto redo_log_records = std::vector<const RedoLogRecords*>{};
+    redo_log_records.reserve(group.size());
+    for (const auto& context : group) {
+      redo_log_records.emplace_back(&context->redo_log_records());
     }
+    log_position = redo_log.append(redo_log_records);
+  }
+
+  // The next group follows this one, even if this one does not become visible before the log is flushed
+  std::atomic_store(&_last_appended_context, group.back());
 
-    if (!current_context->has_next()) return;
+  // Transactions must not become visible before they are durable. Otherwise, a crash could lose a transaction that
+  // others have already read from.
+  if (is_logged) {
+    redo_log.call_when_durable(log_position, [this, group]() { _publish_group(group); });
+  } else {
+    _publish_group(group);
+  }
+}
+
+void TransactionManager::_publish_group(const std::vector<std::shared_ptr<CommitContext>>& group) {
+  // Make the whole group visible at once. Usually, groups are published in commit order. If the logger thread has not
+  // yet called the callback of a group when a later group is published (e.g., because the later group was registered
+  // after the log had been flushed), the later group makes the earlier one visible as well. The earlier one is durable,
+  // too, as the log is flushed in order.
+  {
+    std::lock_guard<std::mutex> lock(_commit_mutex);
+    if (_last_commit_id < group.back()->commit_id()) _last_commit_id = group.back()->commit_id();
+  }
+  _commit_condition_variable.notify_all();
 
-    current_context = current_context->next();
+  for (const auto& context : group) {
+    context->fire_callback();
   }
 }
 
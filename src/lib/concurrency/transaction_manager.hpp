@@ -1,8 +1,12 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include "types.hpp"
 #include "utils/singleton.hpp"
@@ -33,6 +37,18 @@
  * TransactionContext contains data used by a transaction, mainly its ID, the snapshot commit ID explained above, and,
  * when it enters the commit phase, the TransactionManager gives it a CommitContext, which contains
  * a new commit ID that is used to make its changes visible to others.
+ *
+ * Transactions are committed in groups (group commit): Once a transaction is ready to be committed, it is marked as
+ * pending. A single thread at a time, the committer, collects all consecutive pending transactions that follow the
+ * last committed one. It validates them in commit ID order, makes them visible at once by advancing the last commit ID
+ * to the commit ID of the last transaction in the group, and then calls their callbacks. Transactions that become
+ * pending while a group is being committed form the next group. Thus, under many concurrent small transactions, the
+ * cost of making transactions visible is shared by the whole group.
+ *
+ * If the RedoLog is enabled, the committer appends the redo records of the group to the log instead of making it
+ * visible. The group only becomes visible and its callbacks (and thus commit()) only return once the log has been
+ * flushed, which the logger thread does for all groups appended in the meantime at once. The committer does not wait
+ * for the flush, so the next group is formed and appended in the meantime.
  */
 
 namespace opossum {
@@ -57,6 +73,13 @@ class TransactionManager : public Singleton<TransactionManager> {
    */
   std::shared_ptr<TransactionContext> new_transaction_context();
 
+  /**
+   * Creates a new transaction context whose snapshot contains exactly the transactions that have been appended to the
+   * RedoLog so far, and returns it together with the log position after them (zero if the log is disabled). Used to
+   * write checkpoints, see Recovery.
+   */
+  std::pair<std::shared_ptr<TransactionContext>, uint64_t> new_transaction_context_at_log_position();
+
   // TransactionID = 0 means "not set" in the MVCC data. This is the case if the row has (a) just been reserved, but
   // not yet filled with content, (b) been inserted, committed and not marked for deletion, or (c) inserted but
   // deleted in the same transaction (which has not yet committed).
@@ -74,8 +97,24 @@ class TransactionManager : public Singleton<TransactionManager> {
   friend class TransactionContext;
 
   std::shared_ptr<CommitContext> _new_commit_context();
+
+  // Called once the given context is pending. Returns once it is committed or a previous transaction is not pending
+  // yet, in which case the context is committed together with that transaction.
   void _try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context);
 
+  // Validates the pending contexts that directly follow the last group and appends them to the RedoLog as the next
+  // group. Must only be called by the committer.
+  void _commit_pending_group();
+
+  // Makes a group visible and calls the callbacks of its contexts, once the group is durable
+  void _publish_group(const std::vector<std::shared_ptr<CommitContext>>& group);
+
+  // Blocks until the calling thread became the committer, see _is_committing
+  void _become_committer();
+
+  // Steps down as the committer and wakes up the threads that wait for their contexts to be committed
+  void _release_committer();
+
   std::atomic<TransactionID> _next_transaction_id;
 
   std::atomic<CommitID> _last_commit_id;
@@ -84,5 +123,17 @@ class TransactionManager : public Singleton<TransactionManager> {
   static constexpr auto INITIAL_COMMIT_ID = CommitID{1};
 
   std::shared_ptr<CommitContext> _last_commit_context;
+
+  // The context of the last transaction of the last group, from where the committer looks for pending contexts. If
+  // the RedoLog is enabled, the group might not be visible yet. Only written by the committer.
+  std::shared_ptr<CommitContext> _last_appended_context;
+
+  // Set while a thread is committing a group
+  std::atomic_bool _is_committing{false};
+
+  // Notified when the committer steps down or a group became visible. Threads whose contexts are pending wait for it
+  // instead of spinning, as a group might take a while to be committed (e.g., when it is validated).
+  std::mutex _commit_mutex;
+  std::condition_variable _commit_condition_variable;
 };
 }  // namespace opossum
@@ -0,0 +1,235 @@
+#include "recovery.hpp"
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "json.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/export_binary.hpp"
+#include "operators/get_table.hpp"
+#include "operators/import_binary.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "redo_log.hpp"
+#include "redo_log_records.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/filesystem.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The rows of a table by their image, used to find the rows deleted by the replayed transactions. It is only built for
+// tables with deletes and extended by the rows appended since, which are all visible as replayed transactions commit.
+struct RowImageIndex {
+  std::unordered_map<std::string, std::vector<RowID>> row_ids_by_image;
+
+  // The first row that has not been indexed yet
+  ChunkID chunk_id{0};
+  ChunkOffset chunk_offset{0};
+};
+
+void index_new_rows(const Table& table, RowImageIndex& index) {
+  auto row_ids = PosList{};
+  for (auto chunk_id = index.chunk_id; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk_size = static_cast<ChunkOffset>(table.get_chunk(chunk_id)->size());
+    const auto begin_offset = chunk_id == index.chunk_id ? index.chunk_offset : ChunkOffset{0};
+    for (auto chunk_offset = begin_offset; chunk_offset < chunk_size; ++chunk_offset) {
+      row_ids.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+  if (row_ids.empty()) return;
+
+  index.chunk_id = row_ids.back().chunk_id;
+  index.chunk_offset = row_ids.back().chunk_offset + 1;
+
+  // Write the rows as a record to get their images
+  auto records = RedoLogRecords{};
+  records.add_rows(RedoLogRecordType::Delete, std::string{}, table, row_ids);
+  const auto row_images = RedoLogRecords::parse(records.data()).front().row_images;
+
+  for (auto row_index = size_t{0}; row_index < row_ids.size(); ++row_index) {
+    index.row_ids_by_image[row_images[row_index]].emplace_back(row_ids[row_index]);
+  }
+}
+
+void replay_insert(const RedoLogRecord& record, const std::shared_ptr<TransactionContext>& transaction_context) {
+  if (!StorageManager::get().has_table(record.table_name)) return;
+
+  const auto target_table = StorageManager::get().get_table(record.table_name);
+  Assert(target_table->column_data_types() == record.column_data_types,
+         "Logged rows do not match the columns of table " + record.table_name);
+
+  const auto values_to_insert = std::make_shared<Table>(target_table->column_definitions(), TableType::Data);
+  for (const auto& row_image : record.row_images) {
+    values_to_insert->append(RedoLogRecords::decode_row_image(row_image, record.column_data_types));
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+  table_wrapper->execute();
+
+  const auto insert = std::make_shared<Insert>(record.table_name, table_wrapper);
+  insert->set_transaction_context(transaction_context);
+  insert->execute();
+  Assert(!insert->execute_failed(), "Replaying an insert into table " + record.table_name + " failed");
+}
+
+void replay_delete(const RedoLogRecord& record, const std::shared_ptr<TransactionContext>& transaction_context,
+                   RowImageIndex& index) {
+  if (!StorageManager::get().has_table(record.table_name)) return;
+
+  const auto target_table = StorageManager::get().get_table(record.table_name);
+  Assert(target_table->column_data_types() == record.column_data_types,
+         "Logged rows do not match the columns of table " + record.table_name);
+
+  index_new_rows(*target_table, index);
+
+  // Rows with the same image are interchangeable, so any of them is deleted
+  const auto pos_list = std::make_shared<PosList>();
+  for (const auto& row_image : record.row_images) {
+    auto& row_ids = index.row_ids_by_image[row_image];
+    Assert(!row_ids.empty(), "Row deleted by the log does not exist in table " + record.table_name);
+    pos_list->emplace_back(row_ids.back());
+    row_ids.pop_back();
+  }
+
+  auto segments = Segments{};
+  for (auto column_id = ColumnID{0}; column_id < target_table->column_count(); ++column_id) {
+    segments.emplace_back(std::make_shared<ReferenceSegment>(target_table, column_id, pos_list));
+  }
+  const auto rows_to_delete = std::make_shared<Table>(target_table->column_definitions(), TableType::References);
+  rows_to_delete->append_chunk(segments);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(rows_to_delete);
+  table_wrapper->execute();
+
+  const auto delete_operator = std::make_shared<Delete>(table_wrapper);
+  delete_operator->set_transaction_context(transaction_context);
+  delete_operator->execute();
+  Assert(!delete_operator->execute_failed(), "Replaying a delete from table " + record.table_name + " failed");
+}
+
+}  // namespace
+
+namespace opossum {
+
+void Recovery::write_checkpoint(const std::string& directory) {
+  const auto [transaction_context, log_position] =
+      TransactionManager::get().new_transaction_context_at_log_position();
+
+  // After a crash, the log must not end before the position of the checkpoint. Otherwise, transactions appended after
+  // the recovery would be skipped by the next one.
+  if (RedoLog::get().is_enabled()) RedoLog::get().flush();
+
+  // The checkpoint is written to a temporary directory first, so that a crash does not leave a partial checkpoint
+  const auto temporary_path = filesystem::path{directory} / TEMPORARY_CHECKPOINT_DIRECTORY;
+  filesystem::remove_all(temporary_path);
+  filesystem::create_directories(temporary_path);
+
+  auto table_names = nlohmann::json::array();
+  for (const auto& [table_name, table] : StorageManager::get().tables()) {
+    const auto get_table = std::make_shared<GetTable>(table_name);
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+
+    // Tables are stored by their index, as table names might not be valid file names
+    const auto filename = temporary_path / (std::to_string(table_names.size()) + ".bin");
+    ExportBinary::write_binary(*validate->get_output(), filename.string());
+    table_names.push_back(table_name);
+  }
+
+  // The meta file is written last and marks the checkpoint as complete
+  {
+    std::ofstream meta_file;
+    meta_file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    meta_file.open((temporary_path / CHECKPOINT_META_FILE).string());
+    meta_file << nlohmann::json{{"log_position", log_position}, {"tables", table_names}};
+  }
+
+  const auto checkpoint_path = filesystem::path{directory} / CHECKPOINT_DIRECTORY;
+  filesystem::remove_all(checkpoint_path);
+  filesystem::rename(temporary_path, checkpoint_path);
+}
+
+size_t Recovery::recover(const std::string& directory) {
+  Assert(!RedoLog::get().is_enabled(), "The RedoLog must only be enabled after the recovery");
+
+  // If the process crashed while replacing the checkpoint, the new one is still in the temporary directory
+  auto checkpoint_path = filesystem::path{directory} / CHECKPOINT_DIRECTORY;
+  if (!filesystem::exists(checkpoint_path / CHECKPOINT_META_FILE)) {
+    checkpoint_path = filesystem::path{directory} / TEMPORARY_CHECKPOINT_DIRECTORY;
+  }
+
+  auto log_position = uint64_t{0};
+  if (filesystem::exists(checkpoint_path / CHECKPOINT_META_FILE)) {
+    auto meta = nlohmann::json{};
+    std::ifstream meta_file{(checkpoint_path / CHECKPOINT_META_FILE).string()};
+    meta_file >> meta;
+    log_position = meta["log_position"].get<uint64_t>();
+
+    const auto& table_names = meta["tables"];
+    for (auto table_index = size_t{0}; table_index < table_names.size(); ++table_index) {
+      const auto filename = checkpoint_path / (std::to_string(table_index) + ".bin");
+      StorageManager::get().add_table(table_names[table_index].get<std::string>(),
+                                      ImportBinary::read_binary(filename.string()));
+    }
+  }
+
+  const auto log_filename = filesystem::path{directory} / RedoLog::FILE_NAME;
+  const auto log_size = filesystem::exists(log_filename) ? filesystem::file_size(log_filename) : uintmax_t{0};
+  Assert(log_size >= log_position, "The RedoLog is shorter than the checkpoint expects");
+
+  const auto [transactions, end_position] = RedoLog::read_frames(log_filename.string(), log_position);
+
+  // Rows of tables that do not exist are skipped. This is the case if a table was dropped after its rows were committed
+  // or if it was added without being logged, e.g., by an import, after the checkpoint.
+  auto row_image_indexes = std::unordered_map<std::string, RowImageIndex>{};
+  for (const auto& transaction : transactions) {
+    const auto transaction_context = TransactionManager::get().new_transaction_context();
+
+    for (const auto& record : RedoLogRecords::parse(transaction)) {
+      switch (record.type) {
+        case RedoLogRecordType::Insert:
+          replay_insert(record, transaction_context);
+          break;
+        case RedoLogRecordType::Delete:
+          replay_delete(record, transaction_context, row_image_indexes[record.table_name]);
+          break;
+        case RedoLogRecordType::CreateTable:
+          StorageManager::get().add_table(record.table_name,
+                                          std::make_shared<Table>(record.column_definitions, TableType::Data,
+                                                                  Chunk::DEFAULT_SIZE, UseMvcc::Yes));
+          row_image_indexes.erase(record.table_name);
+          break;
+        case RedoLogRecordType::DropTable:
+          if (StorageManager::get().has_table(record.table_name)) StorageManager::get().drop_table(record.table_name);
+          row_image_indexes.erase(record.table_name);
+          break;
+      }
+    }
+
+    const auto committed = transaction_context->commit();
+    Assert(committed, "Replaying a transaction failed");
+  }
+
+  // New frames are appended to the end of the log, so a torn frame has to be removed
+  if (log_size > end_position) filesystem::resize_file(log_filename, end_position);
+
+  return transactions.size();
+}
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+
+namespace opossum {
+
+/**
+ * Restores the tables of the StorageManager after a restart (or crash) from a checkpoint and the RedoLog, which are
+ * stored in the same directory.
+ *
+ * A checkpoint consists of a binary export (see ExportBinary) of the committed state of all tables, together with the
+ * position in the RedoLog up to which the transactions are included in it. The recovery imports the tables and
+ * replays the transactions logged after that position, each in a transaction of its own. Tables created or dropped
+ * by CREATE TABLE and DROP TABLE after the checkpoint are created or dropped again. Rows logged for tables that do
+ * not exist, e.g., for tables imported after the checkpoint, which are not logged, are skipped.
+ *
+ * As the binary format does not store constraints or partitioning and only the rows visible in the checkpoint's
+ * snapshot are exported, the recovered tables have neither. The log is never truncated, so that a checkpoint bounds the
+ * recovery time, but not the size of the log.
+ */
+class Recovery {
+ public:
+  static constexpr auto CHECKPOINT_DIRECTORY = "checkpoint";
+  static constexpr auto TEMPORARY_CHECKPOINT_DIRECTORY = "checkpoint.tmp";
+  static constexpr auto CHECKPOINT_META_FILE = "meta.json";
+
+  /**
+   * Writes a checkpoint of all tables in the StorageManager into the given directory, replacing the previous one.
+   * Transactions may be committed concurrently, the checkpoint holds the snapshot of the time it was started.
+   * Tables must not be added or dropped while the checkpoint is written.
+   */
+  static void write_checkpoint(const std::string& directory);
+
+  /**
+   * Adds the tables of the last checkpoint to the StorageManager and replays the log written after it. Must be called
+   * before the RedoLog is enabled, the StorageManager must not contain any of the tables. A frame that was torn by a
+   * crash is removed from the log. Returns the number of replayed transactions.
+   */
+  static size_t recover(const std::string& directory);
+};
+
+}  // namespace opossum
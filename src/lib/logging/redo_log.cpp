@@ -0,0 +1,214 @@
+#include "redo_log.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <boost/crc.hpp>
+
+#include <array>
+#include <cerrno>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "redo_log_records.hpp"
+#include "utils/assert.hpp"
+#include "utils/filesystem.hpp"
+
+namespace {
+
+uint32_t checksum(const std::string& data) {
+  auto crc = boost::crc_32_type{};
+  crc.process_bytes(data.data(), data.size());
+  return crc.checksum();
+}
+
+template <typename T>
+void write_raw(std::string& buffer, const T& value) {
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+constexpr auto FRAME_HEADER_SIZE = sizeof(uint32_t) * 2;
+
+}  // namespace
+
+namespace opossum {
+
+RedoLog::~RedoLog() { disable(); }
+
+void RedoLog::enable(const std::string& directory) {
+  Assert(!_enabled, "RedoLog is already enabled");
+
+  filesystem::create_directories(directory);
+  const auto filename = (filesystem::path{directory} / FILE_NAME).string();
+
+  _file_descriptor = open(filename.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  Assert(_file_descriptor >= 0, "RedoLog: Could not open " + filename);
+
+  const auto file_size = lseek(_file_descriptor, 0, SEEK_END);
+  Assert(file_size >= 0, "RedoLog: Could not determine the size of " + filename);
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _appended_position = static_cast<uint64_t>(file_size);
+    _durable_position = _appended_position;
+    _stop_requested = false;
+  }
+
+  _logger_thread = std::thread{&RedoLog::_run_logger, this};
+  _enabled = true;
+}
+
+void RedoLog::disable() {
+  if (!_enabled) return;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop_requested = true;
+  }
+  _logger_condition_variable.notify_one();
+  _logger_thread.join();
+
+  close(_file_descriptor);
+  _file_descriptor = -1;
+  _enabled = false;
+}
+
+bool RedoLog::is_enabled() const { return _enabled; }
+
+uint64_t RedoLog::append(const std::vector<const RedoLogRecords*>& transactions) {
+  DebugAssert(_enabled, "RedoLog is not enabled");
+
+  // Compute the checksums before taking the lock, which the logger thread needs to pick up the next frames
+  auto checksums = std::vector<uint32_t>(transactions.size());
+  for (auto transaction_index = size_t{0}; transaction_index < transactions.size(); ++transaction_index) {
+    const auto& data = transactions[transaction_index]->data();
+    Assert(data.size() <= std::numeric_limits<uint32_t>::max(), "Redo log records of a transaction are too large");
+    if (!data.empty()) checksums[transaction_index] = checksum(data);
+  }
+
+  auto position = uint64_t{0};
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto transaction_index = size_t{0}; transaction_index < transactions.size(); ++transaction_index) {
+      const auto& data = transactions[transaction_index]->data();
+      if (data.empty()) continue;
+
+      write_raw(_buffer, static_cast<uint32_t>(data.size()));
+      write_raw(_buffer, checksums[transaction_index]);
+      _buffer.append(data);
+      _appended_position += FRAME_HEADER_SIZE + data.size();
+    }
+    position = _appended_position;
+  }
+  _logger_condition_variable.notify_one();
+
+  return position;
+}
+
+uint64_t RedoLog::appended_position() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _appended_position;
+}
+
+uint64_t RedoLog::durable_position() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _durable_position;
+}
+
+void RedoLog::call_when_durable(const uint64_t position, const std::function<void()>& callback) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (position > _durable_position) {
+      DebugAssert(_durable_callbacks.empty() || _durable_callbacks.back().first <= position,
+                  "Callbacks have to be registered in the order of their positions");
+      _durable_callbacks.emplace_back(position, callback);
+      return;
+    }
+  }
+  callback();
+}
+
+void RedoLog::flush() {
+  std::unique_lock<std::mutex> lock(_mutex);
+  const auto position = _appended_position;
+  _durable_condition_variable.wait(lock, [&]() { return _durable_position >= position; });
+}
+
+std::pair<std::vector<std::string>, uint64_t> RedoLog::read_frames(const std::string& filename,
+                                                                   const uint64_t begin_position) {
+  auto payloads = std::vector<std::string>{};
+  auto position = begin_position;
+
+  std::ifstream file;
+  file.open(filename, std::ios::binary);
+  if (!file.is_open()) return {payloads, position};
+  const auto file_size = static_cast<uint64_t>(filesystem::file_size(filename));
+  file.seekg(static_cast<std::streamoff>(begin_position));
+
+  while (file) {
+    auto header = std::array<uint32_t, 2>{};
+    file.read(reinterpret_cast<char*>(header.data()), FRAME_HEADER_SIZE);
+    if (file.gcount() != static_cast<std::streamsize>(FRAME_HEADER_SIZE)) break;
+
+    // The size of a torn frame might be garbage
+    const auto [payload_size, payload_checksum] = header;
+    if (position + FRAME_HEADER_SIZE + payload_size > file_size) break;
+
+    auto payload = std::string(payload_size, '\0');
+    file.read(payload.data(), payload_size);
+    if (checksum(payload) != payload_checksum) break;
+
+    payloads.emplace_back(std::move(payload));
+    position += FRAME_HEADER_SIZE + payload_size;
+  }
+
+  return {payloads, position};
+}
+
+void RedoLog::_run_logger() {
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  while (true) {
+    _logger_condition_variable.wait(lock, [&]() { return !_buffer.empty() || _stop_requested; });
+
+    // On shutdown, the remaining frames are written first
+    if (_buffer.empty()) return;
+
+    _write_buffer.clear();
+    _write_buffer.swap(_buffer);
+    const auto position = _appended_position;
+    lock.unlock();
+
+    // A log that cannot be written cannot guarantee durability, so failing to write it is fatal
+    auto written_bytes = size_t{0};
+    while (written_bytes < _write_buffer.size()) {
+      const auto result =
+          write(_file_descriptor, _write_buffer.data() + written_bytes, _write_buffer.size() - written_bytes);
+      if (result < 0 && errno == EINTR) continue;
+      Assert(result >= 0, "RedoLog: Could not write to the log file");
+      written_bytes += static_cast<size_t>(result);
+    }
+    Assert(fsync(_file_descriptor) == 0, "RedoLog: Could not sync the log file");
+
+    auto callbacks = std::vector<std::function<void()>>{};
+    lock.lock();
+    _durable_position = position;
+    while (!_durable_callbacks.empty() && _durable_callbacks.front().first <= position) {
+      callbacks.emplace_back(std::move(_durable_callbacks.front().second));
+      _durable_callbacks.pop_front();
+    }
+    _durable_condition_variable.notify_all();
+    lock.unlock();
+
+    for (const auto& callback : callbacks) {
+      callback();
+    }
+
+    lock.lock();
+  }
+}
+
+}  // namespace opossum
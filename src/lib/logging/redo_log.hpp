@@ -0,0 +1,116 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class RedoLogRecords;
+
+/**
+ * Write-ahead redo log for durability. Each committed transaction that modified data is appended as one frame, which
+ * holds its RedoLogRecords:
+ *
+ * Description           | Type                                  | Size in bytes
+ * -----------------------------------------------------------------------------------------
+ * Payload size          | uint32_t                              |   4
+ * Checksum (CRC-32)     | uint32_t                              |   4
+ * Payload               | see RedoLogRecords                    |   Payload size
+ *
+ * Frames are appended by the committer of the TransactionManager in commit order, a group of transactions at a time,
+ * before the group becomes visible. Appending only copies the frames into an in-memory buffer. A dedicated logger
+ * thread writes the buffer to disk and syncs it, so that all transactions appended in the meantime are flushed
+ * together (group flush). Only then does the group become visible and are the commit callbacks of its transactions
+ * called, i.e., no transaction can read data that might be lost in a crash, and commit() returns once the transaction
+ * is durable. The committer does not wait for the disk.
+ *
+ * The log position of a frame is its end offset in the log file. Frames are never removed, see Recovery for how the
+ * log is used together with checkpoints.
+ *
+ * Usage:
+ *   Recovery::recover(directory);    // Optional, restores the state of a previous run
+ *   RedoLog::get().enable(directory);
+ *   ... execute transactions ...
+ *   RedoLog::get().disable();
+ */
+class RedoLog : public Singleton<RedoLog> {
+ public:
+  static constexpr auto FILE_NAME = "redo.log";
+
+  ~RedoLog();
+
+  // Opens (or creates) the log file in the given directory, appends to its end, and starts the logger thread
+  void enable(const std::string& directory);
+
+  // Flushes the log, stops the logger thread, and closes the log file
+  void disable();
+
+  bool is_enabled() const;
+
+  // Appends one frame per non-empty RedoLogRecords and returns the position after the last one. Must only be called
+  // by the committer.
+  uint64_t append(const std::vector<const RedoLogRecords*>& transactions);
+
+  // Position after the last appended frame
+  uint64_t appended_position() const;
+
+  // Position up to which the log has been synced to disk
+  uint64_t durable_position() const;
+
+  // Calls the callback (on the logger thread) once the log is durable up to the given position, or right away if it
+  // already is
+  void call_when_durable(const uint64_t position, const std::function<void()>& callback);
+
+  // Blocks until all frames appended so far are durable
+  void flush();
+
+  /**
+   * Reads the payloads of the frames in the given log file, starting at the given position. Stops at the end of the
+   * file or at the first incomplete or corrupted frame, which is the result of a crash while writing the log. Returns
+   * the payloads and the position after the last valid frame.
+   */
+  static std::pair<std::vector<std::string>, uint64_t> read_frames(const std::string& filename,
+                                                                   const uint64_t begin_position);
+
+ protected:
+  friend class Singleton;
+
+  RedoLog() = default;
+
+  void _run_logger();
+
+  std::atomic_bool _enabled{false};
+  int _file_descriptor{-1};
+  std::thread _logger_thread;
+
+  // The frames that are being written by the logger thread. Swapped with _buffer, so that its memory is reused.
+  std::string _write_buffer;
+
+  // Protects all members below
+  mutable std::mutex _mutex;
+  std::condition_variable _logger_condition_variable;
+  std::condition_variable _durable_condition_variable;
+
+  // Frames that have been appended but not yet written by the logger thread
+  std::string _buffer;
+
+  uint64_t _appended_position{0};
+  uint64_t _durable_position{0};
+
+  // Callbacks waiting for the log to be durable up to their position, ordered by position
+  std::deque<std::pair<uint64_t, std::function<void()>>> _durable_callbacks;
+
+  bool _stop_requested{false};
+};
+
+}  // namespace opossum
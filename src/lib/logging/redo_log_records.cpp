@@ -0,0 +1,223 @@
+#include "redo_log_records.hpp"
+
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename T>
+void write_raw(std::string& buffer, const T& value) {
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void write_string(std::string& buffer, const std::string& value) {
+  write_raw(buffer, static_cast<uint32_t>(value.size()));
+  buffer.append(value);
+}
+
+template <typename T>
+void write_value(std::string& buffer, const std::optional<T>& value) {
+  buffer.push_back(value ? 0 : 1);
+  if (!value) return;
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    write_string(buffer, *value);
+  } else {
+    write_raw(buffer, *value);
+  }
+}
+
+// Reads the records of a transaction. As frames are checksummed by the RedoLog, malformed data is a bug.
+class RecordReader {
+ public:
+  explicit RecordReader(const std::string& data) : _data{data} {}
+
+  bool at_end() const { return _position == _data.size(); }
+
+  size_t position() const { return _position; }
+
+  template <typename T>
+  T read() {
+    Assert(_position + sizeof(T) <= _data.size(), "Redo log record is truncated");
+    auto value = T{};
+    std::memcpy(&value, _data.data() + _position, sizeof(T));
+    _position += sizeof(T);
+    return value;
+  }
+
+  std::string read_string() {
+    const auto length = read<uint32_t>();
+    Assert(_position + length <= _data.size(), "Redo log record is truncated");
+    auto value = _data.substr(_position, length);
+    _position += length;
+    return value;
+  }
+
+  // Reads a value of the given type and returns it, or NULL_VALUE if it is NULL
+  AllTypeVariant read_value(const DataType data_type) {
+    if (read<uint8_t>() != 0) return NULL_VALUE;
+
+    auto value = AllTypeVariant{};
+    resolve_data_type(data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+        value = read_string();
+      } else {
+        value = read<ColumnDataType>();
+      }
+    });
+    return value;
+  }
+
+ protected:
+  const std::string& _data;
+  size_t _position{0};
+};
+
+}  // namespace
+
+namespace opossum {
+
+void RedoLogRecords::add_rows(const RedoLogRecordType type, const std::string& table_name, const Table& table,
+                              const PosList& row_ids) {
+  if (row_ids.empty()) return;
+
+  _add_header(type, table_name);
+  write_raw(_data, static_cast<uint16_t>(table.column_count()));
+  for (const auto data_type : table.column_data_types()) {
+    write_raw(_data, data_type);
+  }
+  write_raw(_data, static_cast<uint32_t>(row_ids.size()));
+
+  write_row_images(table, row_ids, _data);
+}
+
+void RedoLogRecords::add_create_table(const std::string& table_name,
+                                      const TableColumnDefinitions& column_definitions) {
+  _add_header(RedoLogRecordType::CreateTable, table_name);
+  write_raw(_data, static_cast<uint16_t>(column_definitions.size()));
+  for (const auto& column_definition : column_definitions) {
+    write_raw(_data, column_definition.data_type);
+  }
+  for (const auto& column_definition : column_definitions) {
+    write_string(_data, column_definition.name);
+  }
+  for (const auto& column_definition : column_definitions) {
+    write_raw(_data, column_definition.nullable);
+  }
+}
+
+void RedoLogRecords::add_drop_table(const std::string& table_name) {
+  _add_header(RedoLogRecordType::DropTable, table_name);
+}
+
+void RedoLogRecords::append(const RedoLogRecords& records) { _data.append(records._data); }
+
+void RedoLogRecords::clear() { _data.clear(); }
+
+bool RedoLogRecords::empty() const { return _data.empty(); }
+
+const std::string& RedoLogRecords::data() const { return _data; }
+
+void RedoLogRecords::write_row_images(const Table& table, const PosList& row_ids, std::string& buffer) {
+  // Write the value of a column at a given offset. They are created once per chunk, as consecutive rows are usually
+  // located in the same chunk.
+  auto value_writers = std::vector<std::function<void(ChunkOffset)>>(table.column_count());
+  auto current_chunk_id = INVALID_CHUNK_ID;
+
+  for (const auto& row_id : row_ids) {
+    if (row_id.chunk_id != current_chunk_id) {
+      current_chunk_id = row_id.chunk_id;
+      const auto chunk = table.get_chunk(current_chunk_id);
+
+      for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+        resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          const auto accessor = std::shared_ptr<BaseSegmentAccessor<ColumnDataType>>{
+              create_segment_accessor<ColumnDataType>(chunk->get_segment(column_id))};
+          value_writers[column_id] = [accessor, &buffer](const ChunkOffset chunk_offset) {
+            write_value(buffer, accessor->access(chunk_offset));
+          };
+        });
+      }
+    }
+
+    for (const auto& value_writer : value_writers) {
+      value_writer(row_id.chunk_offset);
+    }
+  }
+}
+
+void RedoLogRecords::_add_header(const RedoLogRecordType type, const std::string& table_name) {
+  write_raw(_data, type);
+  write_string(_data, table_name);
+}
+
+std::vector<RedoLogRecord> RedoLogRecords::parse(const std::string& data) {
+  auto records = std::vector<RedoLogRecord>{};
+  auto reader = RecordReader{data};
+
+  while (!reader.at_end()) {
+    auto& record = records.emplace_back();
+    record.type = reader.read<RedoLogRecordType>();
+    record.table_name = reader.read_string();
+    if (record.type == RedoLogRecordType::DropTable) continue;
+
+    const auto column_count = reader.read<uint16_t>();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      record.column_data_types.emplace_back(reader.read<DataType>());
+    }
+
+    if (record.type == RedoLogRecordType::CreateTable) {
+      record.column_definitions.resize(column_count);
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        record.column_definitions[column_id].data_type = record.column_data_types[column_id];
+        record.column_definitions[column_id].name = reader.read_string();
+      }
+      for (auto& column_definition : record.column_definitions) {
+        column_definition.nullable = reader.read<bool>();
+      }
+      continue;
+    }
+
+    const auto row_count = reader.read<uint32_t>();
+    record.row_images.reserve(row_count);
+    for (auto row_index = uint32_t{0}; row_index < row_count; ++row_index) {
+      const auto begin = reader.position();
+      for (const auto data_type : record.column_data_types) {
+        reader.read_value(data_type);
+      }
+      record.row_images.emplace_back(data.substr(begin, reader.position() - begin));
+    }
+  }
+
+  return records;
+}
+
+std::vector<AllTypeVariant> RedoLogRecords::decode_row_image(const std::string& row_image,
+                                                             const std::vector<DataType>& column_data_types) {
+  auto values = std::vector<AllTypeVariant>{};
+  values.reserve(column_data_types.size());
+
+  auto reader = RecordReader{row_image};
+  for (const auto data_type : column_data_types) {
+    values.emplace_back(reader.read_value(data_type));
+  }
+  Assert(reader.at_end(), "Row image does not match the column types");
+
+  return values;
+}
+
+}  // namespace opossum
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/pos_list.hpp"
+#include "storage/table_column_definition.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+enum class RedoLogRecordType : uint8_t { Insert, Delete, CreateTable, DropTable };
+
+// A parsed record, see RedoLogRecords::parse()
+struct RedoLogRecord {
+  RedoLogRecordType type{RedoLogRecordType::Insert};
+  std::string table_name;
+  std::vector<DataType> column_data_types;
+
+  // One row image per inserted or deleted row, in the format described in RedoLogRecords
+  std::vector<std::string> row_images;
+
+  // Only set for CreateTable
+  TableColumnDefinitions column_definitions;
+};
+
+/**
+ * The redo records of a single transaction, i.e., the payload of one frame of the RedoLog. The records are written by
+ * the Insert and Delete operators (and thus by Update) when they commit their records, so that the serialization is
+ * done by the committing thread and not by the committer or the logger thread.
+ *
+ * Rows are logged as logical row images, i.e., as their values, because RowIDs are not stable across recoveries (the
+ * chunks of a checkpoint are laid out differently). A Delete is replayed by deleting a row with the same image.
+ *
+ * Tables created or dropped by CREATE TABLE and DROP TABLE are logged as well, so that the rows logged for tables
+ * that are not part of the checkpoint can be replayed. As these statements take effect right away, they are logged in
+ * a transaction of their own (see TransactionContext::add_redo_log_records()).
+ *
+ * Each record starts with its type and the name of its table:
+ *
+ * Description           | Type                                  | Size in bytes
+ * -----------------------------------------------------------------------------------------
+ * Record type           | RedoLogRecordType                     |   1
+ * Table name length     | uint32_t                              |   4
+ * Table name            | char array                            |   Table name length
+ *
+ * Insert and Delete records continue with the logged rows:
+ *
+ * Description           | Type                                  | Size in bytes
+ * -----------------------------------------------------------------------------------------
+ * Column count          | uint16_t                              |   2
+ * Column types          | DataType array                        |   Column count * 1
+ * Row count             | uint32_t                              |   4
+ * Row images            | see below                             |   variable
+ *
+ * CreateTable records continue with the column definitions, DropTable records end after the table name:
+ *
+ * Description           | Type                                  | Size in bytes
+ * -----------------------------------------------------------------------------------------
+ * Column count          | uint16_t                              |   2
+ * Column types          | DataType array                        |   Column count * 1
+ * Column names          | uint32_t length + char array          |   variable
+ * Column nullabilities  | bool array                            |   Column count * 1
+ *
+ * A row image consists of a null flag (1 byte) per column, followed by the value unless it is NULL. Values are stored
+ * in their binary representation, strings as their length (uint32_t) followed by their characters.
+ */
+class RedoLogRecords {
+ public:
+  // Logs the given rows of the table. Does nothing if there are no rows.
+  void add_rows(const RedoLogRecordType type, const std::string& table_name, const Table& table,
+                const PosList& row_ids);
+
+  void add_create_table(const std::string& table_name, const TableColumnDefinitions& column_definitions);
+  void add_drop_table(const std::string& table_name);
+
+  // Appends the records of another transaction
+  void append(const RedoLogRecords& records);
+
+  // Discards all records, e.g., if the transaction is rolled back
+  void clear();
+
+  bool empty() const;
+  const std::string& data() const;
+
+  // Appends the images of the given rows to the buffer. Also used by the recovery to find the rows to delete.
+  static void write_row_images(const Table& table, const PosList& row_ids, std::string& buffer);
+
+  static std::vector<RedoLogRecord> parse(const std::string& data);
+
+  static std::vector<AllTypeVariant> decode_row_image(const std::string& row_image,
+                                                      const std::vector<DataType>& column_data_types);
+
+ protected:
+  void _add_header(const RedoLogRecordType type, const std::string& table_name);
+
+  std::string _data;
+};
+
+}  // namespace opossum
@@ -118,11 +118,11 @@ std::shared_ptr<AbstractExpression> JoinNode::join_predicate() const {
 }
 
 std::shared_ptr<AbstractLQPNode> JoinNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
-  if (join_predicate()) {
-    return JoinNode::make(join_mode, expression_copy_and_adapt_to_different_lqp(*join_predicate(), node_mapping));
-  } else {
-    return JoinNode::make(join_mode);
-  }
+  const auto copy = join_predicate() ? JoinNode::make(join_mode, expression_copy_and_adapt_to_different_lqp(
+                                                                     *join_predicate(), node_mapping))
+                                     : JoinNode::make(join_mode);
+  copy->join_type = join_type;
+  return copy;
 }
 
 bool JoinNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
@@ -130,6 +130,7 @@ bool JoinNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMappi
 
   if ((join_predicate() == nullptr) != (join_node.join_predicate() == nullptr)) return false;
   if (join_mode != join_node.join_mode) return false;
+  if (join_type != join_node.join_type) return false;
   if (!join_predicate() && !join_node.join_predicate()) return true;
 
   return expression_equal_to_expression_in_different_lqp(*join_predicate(), *join_node.join_predicate(), node_mapping);
@@ -14,6 +14,10 @@
 
 namespace opossum {
 
+// If set to Index, the LQPTranslator creates a JoinIndex that probes an index of the right input. Otherwise, the join
+// operator is chosen by the translator depending on the predicate and the JoinMode. Set by the JoinIndexRule.
+enum class JoinType : uint8_t { Default, Index };
+
 /**
  * This node type is used to represent any type of Join, including cross products.
  */
@@ -36,6 +40,8 @@ class JoinNode : public EnableMakeForLQPNode<JoinNode>, public AbstractLQPNode {
 
   const JoinMode join_mode;
 
+  JoinType join_type{JoinType::Default};
+
  protected:
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
   bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
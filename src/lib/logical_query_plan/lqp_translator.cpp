@@ -3,6 +3,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "abstract_lqp_node.hpp"
@@ -37,6 +38,7 @@
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
@@ -143,9 +145,18 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_stored_table_node(
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_node = node->left_input();
-  const auto input_operator = translate_node(input_node);
   const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
 
+  // Validate and the predicate commute. For an IndexScan on top of a ValidateNode (see IndexScanRule), the IndexScan is
+  // executed on the stored table and only its result is validated. This way, point queries in transactions can use the
+  // index, which also covers freshly inserted rows in the case of table indexes.
+  if (predicate_node->scan_type == ScanType::IndexScan && input_node->type == LQPNodeType::Validate) {
+    const auto stored_table_operator = translate_node(input_node->left_input());
+    return std::make_shared<Validate>(_translate_predicate_node_to_index_scan(predicate_node, stored_table_operator));
+  }
+
+  const auto input_operator = translate_node(input_node);
+
   switch (predicate_node->scan_type) {
     case ScanType::TableScan:
       return _translate_predicate_node_to_table_scan(predicate_node, input_operator);
@@ -158,6 +169,63 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_index_scan(
     const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
+  auto indexed_chunks = std::optional<std::vector<ChunkID>>{};
+  const auto index_scan = _create_index_scan(node, input_operator, indexed_chunks);
+
+  // A table index covers all chunks, so no TableScan is needed
+  if (!indexed_chunks) return index_scan;
+
+  // All chunks that have an index on column_ids are handled by an IndexScan. All other chunks are handled by
+  // TableScan(s).
+  const auto table_scan = _translate_predicate_node_to_table_scan(node, input_operator);
+
+  // An IndexScan without included chunks would scan all chunks
+  if (indexed_chunks->empty()) return table_scan;
+
+  index_scan->set_included_chunk_ids(*indexed_chunks);
+  table_scan->set_excluded_chunk_ids(*indexed_chunks);
+
+  return std::make_shared<UnionPositions>(index_scan, table_scan);
+}
+
+std::shared_ptr<IndexScan> LQPTranslator::_translate_predicate_node_to_index_only_scan(
+    const std::shared_ptr<AbstractLQPNode>& node, const IndexScanOutput output) const {
+  if (node->type != LQPNodeType::Predicate) return nullptr;
+  const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
+  if (predicate_node->scan_type != ScanType::IndexScan) return nullptr;
+
+  // Index-only scans do not check the MVCC data, so they are not used on top of a ValidateNode
+  if (node->left_input()->type != LQPNodeType::StoredTable) return nullptr;
+  const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(node->left_input());
+  if (!stored_table_node->excluded_chunk_ids().empty()) return nullptr;
+
+  // If other nodes consume the output of the PredicateNode, the positions are needed anyway
+  if (node->output_count() > 1) return nullptr;
+
+  auto indexed_chunks = std::optional<std::vector<ChunkID>>{};
+  const auto index_scan = _create_index_scan(predicate_node, translate_node(stored_table_node), indexed_chunks);
+
+  // Without a table index, all chunks need an index. Chunk indexes can not map positions back to values, so they can
+  // only output the values of equality predicates.
+  if (indexed_chunks) {
+    const auto table = StorageManager::get().get_table(stored_table_node->table_name);
+    if (indexed_chunks->size() != static_cast<size_t>(table->chunk_count())) return nullptr;
+
+    const auto predicate_condition =
+        std::static_pointer_cast<AbstractPredicateExpression>(predicate_node->predicate())->predicate_condition;
+    if (output == IndexScanOutput::Values && predicate_condition != PredicateCondition::Equals &&
+        predicate_condition != PredicateCondition::In) {
+      return nullptr;
+    }
+  }
+
+  index_scan->set_output(output);
+  return index_scan;
+}
+
+std::shared_ptr<IndexScan> LQPTranslator::_create_index_scan(
+    const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator,
+    std::optional<std::vector<ChunkID>>& indexed_chunks) const {
   /**
    * Not using OperatorScanPredicate, since it splits up BETWEEN into two scans for some cases that TableScan cannot handle
    */
@@ -166,16 +234,32 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   auto value_variant = AllTypeVariant{NullValue{}};
   auto value2_variant = std::optional<AllTypeVariant>{};
 
-  // Currently, we will only use IndexScans if the predicate node directly follows a StoredTableNode.
-  // Our IndexScan implementation does not work on reference segments yet.
-  Assert(node->left_input()->type == LQPNodeType::StoredTable, "IndexScan must follow a StoredTableNode.");
+  // Currently, we will only use IndexScans if the predicate node directly follows a StoredTableNode (or a ValidateNode
+  // on top of it, see _translate_predicate_node()). Our IndexScan implementation does not work on reference segments
+  // yet.
+  auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input());
+  if (node->left_input()->type == LQPNodeType::Validate) {
+    stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input()->left_input());
+  }
+  Assert(stored_table_node, "IndexScan must follow a StoredTableNode.");
 
   const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(node->predicate());
   Assert(predicate, "Expected predicate");
   Assert(!predicate->arguments.empty(), "Expected arguments");
 
-  column_id = node->left_input()->get_column_id(*predicate->arguments[0]);
-  if (predicate->arguments.size() > 1) {
+  column_id = stored_table_node->get_column_id(*predicate->arguments[0]);
+
+  // For IN, the IndexScan expects the elements of the list as right_values
+  auto in_list_values = std::vector<AllTypeVariant>{};
+  if (predicate->predicate_condition == PredicateCondition::In) {
+    const auto list_expression = std::dynamic_pointer_cast<ListExpression>(predicate->arguments[1]);
+    Assert(list_expression, "Expected list as second argument for IndexScan");
+    for (const auto& element : list_expression->elements()) {
+      const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(element);
+      Assert(value_expression, "Expected list of values for IndexScan");
+      in_list_values.emplace_back(value_expression->value);
+    }
+  } else if (predicate->arguments.size() > 1) {
     const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate->arguments[1]);
     // This is necessary because we currently support single column indexes only
     Assert(value_expression, "Expected value as second argument for IndexScan");
@@ -189,33 +273,51 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   }
 
   const std::vector<ColumnID> column_ids = {column_id};
-  const std::vector<AllTypeVariant> right_values = {value_variant};
+  const auto is_in = predicate->predicate_condition == PredicateCondition::In;
+  const auto right_values = is_in ? in_list_values : std::vector<AllTypeVariant>{value_variant};
   std::vector<AllTypeVariant> right_values2 = {};
   if (value2_variant) right_values2.emplace_back(*value2_variant);
 
-  auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input());
   const auto table_name = stored_table_node->table_name;
   const auto table = StorageManager::get().get_table(table_name);
-  std::vector<ChunkID> indexed_chunks;
 
-  for (ChunkID chunk_id{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
-    const auto chunk = table->get_chunk(chunk_id);
-    if (chunk->get_index(SegmentIndexType::GroupKey, column_ids)) {
-      indexed_chunks.emplace_back(chunk_id);
-    }
+  // The table index holds the RowIDs of the stored table. If chunks were pruned, GetTable outputs a copy of the table
+  // without the table indexes, whose ChunkIDs do not match the stored table.
+  const auto& excluded_chunk_ids = stored_table_node->excluded_chunk_ids();
+  if (excluded_chunk_ids.empty() && table->get_table_index(column_id)) {
+    indexed_chunks = std::nullopt;
+    return std::make_shared<IndexScan>(input_operator, SegmentIndexType::GroupKey, column_ids,
+                                       predicate->predicate_condition, right_values, right_values2);
   }
 
-  // All chunks that have an index on column_ids are handled by an IndexScan. All other chunks are handled by
-  // TableScan(s).
-  auto index_scan = std::make_shared<IndexScan>(input_operator, SegmentIndexType::GroupKey, column_ids,
-                                                predicate->predicate_condition, right_values, right_values2);
+  // For equality predicates, a HashIndex is preferred since a lookup takes a single probe. It cannot be used for range
+  // predicates, see HashIndex.
+  auto index_type = SegmentIndexType::GroupKey;
+  if (predicate->predicate_condition == PredicateCondition::Equals ||
+      predicate->predicate_condition == PredicateCondition::In) {
+    for (const auto& index_info : table->get_indexes()) {
+      if (index_info.type == SegmentIndexType::Hash && index_info.column_ids == column_ids) {
+        index_type = SegmentIndexType::Hash;
+      }
+    }
+  }
 
-  const auto table_scan = _translate_predicate_node_to_table_scan(node, input_operator);
+  // The ChunkIDs refer to the output of GetTable, in which the pruned chunks are left out
+  const auto excluded_chunk_set = std::unordered_set<ChunkID>{excluded_chunk_ids.cbegin(), excluded_chunk_ids.cend()};
+  indexed_chunks.emplace();
+  auto input_chunk_id = ChunkID{0};
+  for (ChunkID chunk_id{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
+    if (excluded_chunk_set.count(chunk_id)) continue;
 
-  index_scan->set_included_chunk_ids(indexed_chunks);
-  table_scan->set_excluded_chunk_ids(indexed_chunks);
+    const auto chunk = table->get_chunk(chunk_id);
+    if (chunk->get_index(index_type, column_ids)) {
+      indexed_chunks->emplace_back(input_chunk_id);
+    }
+    ++input_chunk_id;
+  }
 
-  return std::make_shared<UnionPositions>(index_scan, table_scan);
+  return std::make_shared<IndexScan>(input_operator, index_type, column_ids, predicate->predicate_condition,
+                                     right_values, right_values2);
 }
 
 std::shared_ptr<TableScan> LQPTranslator::_translate_predicate_node_to_table_scan(
@@ -243,6 +345,17 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_projection_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_node = node->left_input();
   const auto projection_node = std::dynamic_pointer_cast<ProjectionNode>(node);
+
+  // A projection of only the scanned column of an IndexScan can be answered from the index alone
+  if (input_node->type == LQPNodeType::Predicate && projection_node->node_expressions.size() == 1) {
+    const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(
+        std::static_pointer_cast<PredicateNode>(input_node)->predicate());
+    if (predicate && *predicate->arguments[0] == *projection_node->node_expressions[0]) {
+      const auto index_scan = _translate_predicate_node_to_index_only_scan(input_node, IndexScanOutput::Values);
+      if (index_scan) return index_scan;
+    }
+  }
+
   const auto input_operator = translate_node(input_node);
 
   return std::make_shared<Projection>(input_operator,
@@ -306,6 +419,11 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
 
   const auto predicate_condition = operator_join_predicate->predicate_condition;
 
+  if (join_node->join_type == JoinType::Index) {
+    return std::make_shared<JoinIndex>(input_left_operator, input_right_operator, join_node->join_mode,
+                                       operator_join_predicate->column_ids, predicate_condition);
+  }
+
   if (predicate_condition == PredicateCondition::Equals && join_node->join_mode != JoinMode::Outer) {
     return std::make_shared<JoinHash>(input_left_operator, input_right_operator, join_node->join_mode,
                                       operator_join_predicate->column_ids, predicate_condition);
@@ -319,6 +437,17 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto aggregate_node = std::dynamic_pointer_cast<AggregateNode>(node);
 
+  // A COUNT(*) without GROUP BY on top of an IndexScan can be answered from the index alone
+  if (aggregate_node->aggregate_expressions_begin_idx == 0 && aggregate_node->node_expressions.size() == 1) {
+    const auto aggregate_expression =
+        std::dynamic_pointer_cast<AggregateExpression>(aggregate_node->node_expressions[0]);
+    if (aggregate_expression && aggregate_expression->aggregate_function == AggregateFunction::Count &&
+        !aggregate_expression->argument()) {
+      const auto index_scan = _translate_predicate_node_to_index_only_scan(node->left_input(), IndexScanOutput::Count);
+      if (index_scan) return index_scan;
+    }
+  }
+
   const auto input_operator = translate_node(node->left_input());
 
   // Create AggregateColumnDefinitions from AggregateExpressions
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <unordered_map>
+#include <vector>
 
 #include "abstract_lqp_node.hpp"
 #include "all_type_variant.hpp"
@@ -12,8 +14,10 @@ namespace opossum {
 class AbstractOperator;
 class TransactionContext;
 class AbstractExpression;
+class IndexScan;
 class PredicateNode;
 class TableScan;
+enum class IndexScanOutput : uint8_t;
 struct OperatorScanPredicate;
 struct OperatorJoinPredicate;
 
@@ -35,6 +39,15 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_predicate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_predicate_node_to_index_scan(
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
+  // Returns an IndexScan with the given index-only output for a PredicateNode translated to an IndexScan, or nullptr if
+  // the index alone is not sufficient
+  std::shared_ptr<IndexScan> _translate_predicate_node_to_index_only_scan(const std::shared_ptr<AbstractLQPNode>& node,
+                                                                          const IndexScanOutput output) const;
+  // Creates an IndexScan for the predicate. Unless the table index is used, indexed_chunks is set to the chunks that
+  // have a suitable chunk index.
+  std::shared_ptr<IndexScan> _create_index_scan(const std::shared_ptr<PredicateNode>& node,
+                                                const std::shared_ptr<AbstractOperator>& input_operator,
+                                                std::optional<std::vector<ChunkID>>& indexed_chunks) const;
   std::shared_ptr<TableScan> _translate_predicate_node_to_table_scan(
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
   std::shared_ptr<AbstractOperator> _translate_alias_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -1,18 +1,24 @@
 #include "abstract_operator.hpp"
 
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
 #include "concurrency/transaction_context.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/query_context.hpp"
+#include "scheduler/worker.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 #include "utils/format_duration.hpp"
+#include "utils/numa_memory_resource.hpp"
 #include "utils/print_directed_acyclic_graph.hpp"
-#include "utils/timer.hpp"
 #include "utils/tracing/probes.hpp"
+#include "utils/tracing/trace_recorder.hpp"
 
 namespace opossum {
 
@@ -29,7 +35,7 @@ void AbstractOperator::execute() {
   DebugAssert(!_input_right || _input_right->get_output(), "Right input has not yet been executed");
   DebugAssert(!_output, "Operator has already been executed");
 
-  Timer performance_timer;
+  _execution_begin = std::chrono::steady_clock::now();
 
   auto transaction_context = this->transaction_context();
 
@@ -43,20 +49,25 @@ void AbstractOperator::execute() {
       return;
     }
     transaction_context->on_operator_started();
+  }
+
+  {
+    const auto memory_resource_scope = ScopedDefaultMemoryResource{_execution_memory_resource()};
     _output = _on_execute(transaction_context);
-    transaction_context->on_operator_finished();
-  } else {
-    _output = _on_execute(nullptr);
   }
 
-  // release any temporary data if possible
-  _on_cleanup();
+  // The continuation of an operator that yielded finishes the execution, see _continue_after_tasks()
+  if (_is_yielded) return;
 
-  _performance_data->walltime = performance_timer.lap();
+  _finish_execution();
+}
 
-  DTRACE_PROBE5(HYRISE, OPERATOR_EXECUTED, name().c_str(), _performance_data->walltime.count(),
-                _output ? _output->row_count() : 0, _output ? _output->chunk_count() : 0,
-                reinterpret_cast<uintptr_t>(this));
+void AbstractOperator::execute_then(const std::function<void()>& on_executed) {
+  _on_executed = on_executed;
+  execute();
+
+  // Unless the operator yielded and took over the callback, it is done now
+  if (_on_executed) std::exchange(_on_executed, nullptr)();
 }
 
 // returns the result of the operator
@@ -86,10 +97,71 @@ std::shared_ptr<AbstractOperator> AbstractOperator::deep_copy() const {
   return _deep_copy_impl(copied_ops);
 }
 
+std::shared_ptr<AbstractOperator> AbstractOperator::deep_copy(
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
+  return _deep_copy_impl(copied_ops);
+}
+
 std::shared_ptr<const Table> AbstractOperator::input_table_left() const { return _input_left->get_output(); }
 
 std::shared_ptr<const Table> AbstractOperator::input_table_right() const { return _input_right->get_output(); }
 
+std::shared_ptr<const Table> AbstractOperator::_continue_after_tasks(
+    const std::vector<std::shared_ptr<AbstractTask>>& tasks,
+    const std::function<std::shared_ptr<const Table>()>& continuation) {
+  // Only operators executed by execute_then() from within a task can yield. Everyone else (e.g., an operator that
+  // executes other operators itself) expects the output to be there once execute() returns.
+  if (tasks.empty() || !_on_executed || !AbstractTask::get_this_thread_task()) {
+    CurrentScheduler::wait_for_tasks(tasks);
+    return continuation();
+  }
+
+  _is_yielded = true;
+  const auto on_executed = std::exchange(_on_executed, nullptr);
+  CurrentScheduler::continue_after_tasks(tasks, [this, continuation, on_executed]() {
+    // Like wait_for_tasks(), do not continue with the results of tasks that stopped because the query was cancelled
+    QueryContext::throw_if_current_query_cancelled();
+
+    {
+      const auto memory_resource_scope = ScopedDefaultMemoryResource{_execution_memory_resource()};
+      _output = continuation();
+    }
+    _is_yielded = false;
+
+    _finish_execution();
+    on_executed();
+  });
+
+  return nullptr;
+}
+
+void AbstractOperator::_finish_execution() {
+  const auto transaction_context = this->transaction_context();
+  if (transaction_context) transaction_context->on_operator_finished();
+
+  // release any temporary data if possible
+  _on_cleanup();
+
+  const auto end = std::chrono::steady_clock::now();
+  _performance_data->walltime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - _execution_begin);
+
+  auto& trace_recorder = TraceRecorder::get();
+  if (trace_recorder.is_enabled()) {
+    trace_recorder.record(TraceEventCategory::Operator, name(), _execution_begin, end,
+                          _output ? std::optional<uint64_t>{_output->row_count()} : std::nullopt);
+  }
+
+  DTRACE_PROBE5(HYRISE, OPERATOR_EXECUTED, name().c_str(), _performance_data->walltime.count(),
+                _output ? _output->row_count() : 0, _output ? _output->chunk_count() : 0,
+                reinterpret_cast<uintptr_t>(this));
+}
+
+boost::container::pmr::memory_resource* AbstractOperator::_execution_memory_resource() const {
+  // Stored data is allocated from the global resource, intermediates on the node of the worker (if any)
+  const auto worker = Worker::get_this_thread_worker();
+  return _creates_stored_data() ? nullptr : worker ? worker->memory_resource() : ScopedDefaultMemoryResource::current();
+}
+
 bool AbstractOperator::transaction_context_is_set() const { return _transaction_context.has_value(); }
 
 std::shared_ptr<TransactionContext> AbstractOperator::transaction_context() const {
@@ -158,6 +230,8 @@ void AbstractOperator::set_parameters(const std::unordered_map<ParameterID, AllT
 
 void AbstractOperator::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {}
 
+bool AbstractOperator::_creates_stored_data() const { return false; }
+
 void AbstractOperator::_on_cleanup() {}
 
 std::shared_ptr<AbstractOperator> AbstractOperator::_deep_copy_impl(
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -11,6 +13,7 @@
 
 namespace opossum {
 
+class AbstractTask;
 class OperatorTask;
 class Table;
 class TransactionContext;
@@ -83,6 +86,14 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Overriding implementations need to call on_operator_started/finished() on the _transaction_context as well
   virtual void execute();
 
+  /**
+   * Executes the operator and calls @param on_executed once its output is set. Operators that wait for their JobTasks
+   * (see _continue_after_tasks()) make the calling task yield instead of blocking its worker. In that case, this
+   * returns before the operator is done and @param on_executed is called from the continuation. Thus, this has to be
+   * the last action of the calling task's step (see CurrentScheduler::continue_after_tasks()). Used by OperatorTask.
+   */
+  void execute_then(const std::function<void()>& on_executed);
+
   // returns the result of the operator
   // When using OperatorTasks, they automatically clear this once all successors are done. This reduces the number of
   // temporary tables.
@@ -108,6 +119,12 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // An operator needs to implement this method in order to be cacheable.
   std::shared_ptr<AbstractOperator> deep_copy() const;
 
+  // Same as deep_copy(), but operators that already are in @param copied_ops are not copied. Instead, the given
+  // operators are used in the copy, e.g., to replace an input (see ChunkPipeline). Afterwards, @param copied_ops maps
+  // all operators of the plan to their copies.
+  std::shared_ptr<AbstractOperator> deep_copy(
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const;
+
   // Get the input operators.
   std::shared_ptr<const AbstractOperator> input_left() const;
   std::shared_ptr<const AbstractOperator> input_right() const;
@@ -146,6 +163,21 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // override this if the Operator uses Expressions and set the transaction context in the SubqueryExpressions
   virtual void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context);
 
+  /**
+   * For an _on_execute() that schedules JobTasks and builds its output from their results: returns the output built
+   * by @param continuation once @param tasks are done. If the operator is executed by execute_then(), the calling task
+   * yields instead of waiting: this returns nullptr right away, and the continuation runs as a task of its own once the
+   * tasks are done. Its result then becomes the output. _on_execute() has to return the result of this call right away
+   * and everything the continuation or the tasks use has to outlive _on_execute(), e.g., as members of the operator
+   * that are released in _on_cleanup().
+   */
+  std::shared_ptr<const Table> _continue_after_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks,
+                                                     const std::function<std::shared_ptr<const Table>()>& continuation);
+
+  // Whether the operator creates data that outlives the query, e.g., the chunks of a stored table. On worker threads,
+  // all other operators allocate their intermediates on the worker's NUMA node (see ScopedDefaultMemoryResource).
+  virtual bool _creates_stored_data() const;
+
   void _print_impl(std::ostream& out, std::vector<bool>& levels,
                    std::unordered_map<const AbstractOperator*, size_t>& id_by_operator, size_t& id_counter) const;
 
@@ -166,10 +198,25 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Is nullptr until the operator is executed
   std::shared_ptr<const Table> _output;
 
+  // ChunkPipeline::execute_into_root() sets the output of the root of its chain
+  friend class ChunkPipeline;
+
   // Weak pointer breaks cyclical dependency between operators and context
   std::optional<std::weak_ptr<TransactionContext>> _transaction_context;
 
   const std::unique_ptr<OperatorPerformanceData> _performance_data;
+
+ private:
+  // Everything that happens after _on_execute() returned the output, e.g., the cleanup and the performance data
+  void _finish_execution();
+
+  boost::container::pmr::memory_resource* _execution_memory_resource() const;
+
+  std::chrono::steady_clock::time_point _execution_begin;
+
+  // Set by execute_then() until the operator is done or yields
+  std::function<void()> _on_executed;
+  bool _is_yielded{false};
 };
 
 }  // namespace opossum
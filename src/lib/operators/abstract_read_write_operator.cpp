@@ -58,6 +58,8 @@ bool AbstractReadWriteOperator::execute_failed() const {
 
 ReadWriteOperatorState AbstractReadWriteOperator::state() const { return _state; }
 
+bool AbstractReadWriteOperator::_creates_stored_data() const { return true; }
+
 void AbstractReadWriteOperator::_mark_as_failed() {
   Assert(_state == ReadWriteOperatorState::Pending, "Operator can only be marked as failed if pending.");
 
@@ -88,6 +88,9 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   void _mark_as_failed();
 
+  // The modified tables are stored, see AbstractOperator::_creates_stored_data()
+  bool _creates_stored_data() const override;
+
  private:
   ReadWriteOperatorState _state;
 };
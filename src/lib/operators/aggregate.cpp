@@ -16,6 +16,7 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/query_context.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
@@ -417,6 +418,8 @@ void Aggregate::_aggregate() {
 
   // Process Chunks and perform aggregations
   for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    QueryContext::throw_if_current_query_cancelled();
+
     auto chunk_in = input_table->get_chunk(chunk_id);
 
     const auto& hash_keys = keys_per_chunk[chunk_id];
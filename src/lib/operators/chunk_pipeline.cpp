@@ -0,0 +1,233 @@
+#include "chunk_pipeline.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/morsel_queue.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool contains_subquery(const std::vector<std::shared_ptr<AbstractExpression>>& expressions) {
+  auto found_subquery = false;
+  for (const auto& expression : expressions) {
+    visit_expression(expression, [&](const auto& sub_expression) {
+      if (sub_expression->type == ExpressionType::PQPSubquery) found_subquery = true;
+      return found_subquery ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+    });
+  }
+  return found_subquery;
+}
+
+// Appends a chunk to @param batch_table that references the rows of the given chunk. Chunks of reference tables are
+// forwarded as they are, so that no multi-level references are created.
+void append_referencing_chunk(const std::shared_ptr<const Table>& table, const ChunkID chunk_id, Table& batch_table) {
+  const auto chunk = table->get_chunk(chunk_id);
+
+  if (table->type() == TableType::References) {
+    batch_table.append_chunk(chunk->segments());
+    return;
+  }
+
+  const auto pos_list = std::make_shared<PosList>(chunk->size());
+  pos_list->guarantee_single_chunk();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+    (*pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
+  }
+
+  auto segments = Segments{};
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, pos_list));
+  }
+  batch_table.append_chunk(segments);
+}
+
+}  // namespace
+
+namespace opossum {
+
+ChunkPipeline::ChunkPipeline(const std::shared_ptr<AbstractOperator>& root,
+                             const std::unordered_set<std::shared_ptr<AbstractOperator>>& pipeline_breakers) {
+  Assert(is_pipelineable(*root), "The root of a ChunkPipeline has to be pipelineable");
+
+  auto op = root;
+  do {
+    _operators.emplace_back(op);
+    op = op->mutable_input_left();
+  } while (is_pipelineable(*op) && !pipeline_breakers.count(op));
+  _source = op;
+}
+
+bool ChunkPipeline::is_pipelineable(const AbstractOperator& op) {
+  switch (op.type()) {
+    case OperatorType::Validate:
+      return true;
+    case OperatorType::TableScan:
+      return !contains_subquery({static_cast<const TableScan&>(op).predicate()});
+    case OperatorType::Projection:
+      return !contains_subquery(static_cast<const Projection&>(op).expressions);
+    default:
+      return false;
+  }
+}
+
+bool ChunkPipeline::is_enabled() { return _enabled; }
+
+void ChunkPipeline::set_enabled(const bool enabled) { _enabled = enabled; }
+
+const std::vector<std::shared_ptr<AbstractOperator>>& ChunkPipeline::operators() const { return _operators; }
+
+const std::shared_ptr<AbstractOperator>& ChunkPipeline::source() const { return _source; }
+
+size_t ChunkPipeline::min_batch_size() const { return _min_batch_size; }
+
+void ChunkPipeline::set_min_batch_size(const size_t min_batch_size) { _min_batch_size = min_batch_size; }
+
+void ChunkPipeline::execute(const BatchConsumer& consumer) const {
+  if (!_source->get_output()) {
+    OperatorTask::execute_tasks(OperatorTask::make_tasks_from_operator(_source, CleanupTemporaries::No));
+  }
+  const auto source_table = _source->get_output();
+
+  // Each batch ends after the chunk with which it reaches the minimum size, the last one with the last chunk
+  auto batch_end_chunk_ids = std::vector<ChunkID>{};
+  auto batch_row_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < source_table->chunk_count(); ++chunk_id) {
+    batch_row_count += source_table->get_chunk(chunk_id)->size();
+    if (batch_row_count >= _min_batch_size || chunk_id + 1 == source_table->chunk_count()) {
+      batch_end_chunk_ids.emplace_back(ChunkID{chunk_id + 1});
+      batch_row_count = 0;
+    }
+  }
+  const auto batch_count = batch_end_chunk_ids.size();
+
+  // Results of batches that finished before all previous batches were consumed wait here. Consumed results are reset,
+  // so that their tables can be freed as soon as the consumer does not need them anymore.
+  std::mutex consumer_mutex;
+  auto pending_batch_results = std::vector<std::shared_ptr<const Table>>(batch_count);
+  auto is_batch_finished = std::vector<bool>(batch_count);
+  auto next_batch_to_consume = size_t{0};
+
+  auto next_batch_id = std::atomic<size_t>{0};
+  const auto process_batches = [&]() {
+    const auto chain_copy = _copy_chain();
+
+    for (auto batch_id = next_batch_id++; batch_id < batch_count; batch_id = next_batch_id++) {
+      const auto batch_table = std::make_shared<Table>(source_table->column_definitions(), TableType::References);
+      const auto begin_chunk_id = batch_id == 0 ? ChunkID{0} : batch_end_chunk_ids[batch_id - 1];
+      for (auto chunk_id = begin_chunk_id; chunk_id < batch_end_chunk_ids[batch_id]; ++chunk_id) {
+        append_referencing_chunk(source_table, chunk_id, *batch_table);
+      }
+
+      const auto batch_result = _execute_chain_copy(chain_copy, batch_table);
+
+      std::lock_guard<std::mutex> lock(consumer_mutex);
+      pending_batch_results[batch_id] = batch_result;
+      is_batch_finished[batch_id] = true;
+      while (next_batch_to_consume < batch_count && is_batch_finished[next_batch_to_consume]) {
+        auto& result = pending_batch_results[next_batch_to_consume];
+        if (result->row_count() > 0) consumer(result);
+        result = nullptr;
+        ++next_batch_to_consume;
+      }
+    }
+  };
+
+  // Batches are assigned to the jobs one at a time, so that the batches in flight are roughly consecutive and few
+  // results have to wait for their predecessors
+  const auto job_count = std::min(batch_count, MorselQueue::worker_count());
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>(process_batches));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+}
+
+std::shared_ptr<const Table> ChunkPipeline::execute() const {
+  // The segments of the batch results are collected instead of the results themselves, so that the tables of the
+  // batches are freed right away
+  auto result_segments = std::vector<Segments>{};
+  auto nullable_column_ids = std::unordered_set<ColumnID>{};
+  execute([&](const auto& batch_result) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < batch_result->chunk_count(); ++chunk_id) {
+      result_segments.emplace_back(batch_result->get_chunk(chunk_id)->segments());
+    }
+    for (auto column_id = ColumnID{0}; column_id < batch_result->column_count(); ++column_id) {
+      if (batch_result->column_is_nullable(column_id)) nullable_column_ids.emplace(column_id);
+    }
+  });
+
+  // The layout of the output does not depend on the data, except for the nullability of computed columns (see
+  // Projection). Thus, it is taken from a run on an empty input, which also covers the case of an empty result.
+  const auto empty_output = _execute_chain_copy(
+      _copy_chain(), std::make_shared<Table>(_source->get_output()->column_definitions(), TableType::References));
+  auto column_definitions = empty_output->column_definitions();
+  for (const auto column_id : nullable_column_ids) {
+    column_definitions[column_id].nullable = true;
+  }
+
+  const auto output = std::make_shared<Table>(column_definitions, empty_output->type(), std::nullopt,
+                                              empty_output->has_mvcc());
+  for (const auto& segments : result_segments) {
+    output->append_chunk(segments);
+  }
+  return output;
+}
+
+void ChunkPipeline::execute_into_root() const {
+  const auto& root = _operators.front();
+  DebugAssert(!root->_output, "Operator has already been executed");
+  root->_output = execute();
+}
+
+ChunkPipeline::ChainCopy ChunkPipeline::_copy_chain() const {
+  auto chain_copy = ChainCopy{};
+  chain_copy.input = std::make_shared<TableWrapper>(
+      std::make_shared<Table>(_source->get_output()->column_definitions(), TableType::References));
+
+  auto copied_operators = std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>{};
+  copied_operators.emplace(_source.get(), chain_copy.input);
+  _operators.front()->deep_copy(copied_operators);
+
+  for (auto op_iter = _operators.rbegin(); op_iter != _operators.rend(); ++op_iter) {
+    chain_copy.operators.emplace_back(copied_operators.at(op_iter->get()));
+  }
+  return chain_copy;
+}
+
+std::shared_ptr<const Table> ChunkPipeline::_execute_chain_copy(const ChainCopy& chain_copy,
+                                                                const std::shared_ptr<const Table>& input_table) const {
+  // The pipelineable operators do not keep any state between executions, so they can be executed again once their
+  // output is cleared
+  chain_copy.input->_output = input_table;
+  for (const auto& copied_operator : chain_copy.operators) {
+    copied_operator->execute();
+  }
+  const auto output = chain_copy.operators.back()->get_output();
+
+  chain_copy.input->clear_output();
+  for (const auto& copied_operator : chain_copy.operators) {
+    copied_operator->clear_output();
+  }
+  return output;
+}
+
+}  // namespace opossum
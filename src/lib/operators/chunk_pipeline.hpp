@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+namespace opossum {
+
+class AbstractOperator;
+class Table;
+
+/**
+ * Executes a chain of chunk-local operators (TableScan, Validate, and Projection, see is_pipelineable()) batch by
+ * batch instead of operator by operator.
+ *
+ * Usually, every operator materializes its complete output before the operator on top of it starts. For example, the
+ * PosLists of a TableScan cover all chunks before the Validate on top of it looks at the first row. In a ChunkPipeline,
+ * the chunks of the pipeline's input are grouped into batches of consecutive chunks. Each batch is pushed through all
+ * operators of the chain and its result is handed to a consumer. Thus, of the intermediates within the chain, only
+ * those of the batches in flight exist at any point in time, and they are still in the cache when the next operator
+ * processes them. The consumer receives the results in the order of the input chunks, so the chunks of the combined
+ * result are in the same order as in the output of an operator-by-operator execution.
+ *
+ * The input of the bottommost operator of the chain is a pipeline breaker (e.g., a GetTable, a join, or an aggregate)
+ * and is executed as usual. Its batches are processed in parallel by one JobTask per worker. Each job copies the chain
+ * once (see AbstractOperator::deep_copy()) and then executes the copy for one batch after another, with a table
+ * referencing the batch's chunks as its input. A batch holds at least min_batch_size() rows (unless it is the last
+ * one), so that the per-batch overhead is small compared to the work done on the batch. As the rows are referenced and
+ * not copied, RowIDs in the results still point to the original tables.
+ *
+ * The pipeline ends at the root of the chain: its output is materialized completely, like the output of any other
+ * operator, because the operators on top of it (including the probe side of a JoinHash) need their complete input.
+ * Streaming the batches into such operators would require them to process their input incrementally, which they do not
+ * support. Thus, what is saved are the intermediates within the chain, not the output of its root.
+ *
+ * Operators with subqueries are not pipelined, as the subqueries would be executed once per batch.
+ *
+ * If enabled (see set_enabled()), OperatorTask::make_tasks_from_operator() executes chains of at least two
+ * pipelineable operators as a ChunkPipeline in a single OperatorTask.
+ */
+class ChunkPipeline {
+ public:
+  // Called for each non-empty result of a batch, in the order of the batches. Calls are not concurrent, but may happen
+  // from different threads.
+  using BatchConsumer = std::function<void(const std::shared_ptr<const Table>& batch_result)>;
+
+  static constexpr size_t DEFAULT_MIN_BATCH_SIZE = 10'000;
+
+  /**
+   * The chain starts at root and extends downwards as long as the operators are pipelineable. Operators in
+   * @param pipeline_breakers end the chain, e.g., because their output is needed by other operators as well.
+   */
+  explicit ChunkPipeline(const std::shared_ptr<AbstractOperator>& root,
+                         const std::unordered_set<std::shared_ptr<AbstractOperator>>& pipeline_breakers = {});
+
+  static bool is_pipelineable(const AbstractOperator& op);
+
+  // Whether OperatorTasks execute chains of pipelineable operators as ChunkPipelines. Disabled by default.
+  static bool is_enabled();
+  static void set_enabled(const bool enabled);
+
+  // The operators of the chain, from top to bottom
+  const std::vector<std::shared_ptr<AbstractOperator>>& operators() const;
+
+  // The input of the bottommost operator of the chain
+  const std::shared_ptr<AbstractOperator>& source() const;
+
+  size_t min_batch_size() const;
+  void set_min_batch_size(const size_t min_batch_size);
+
+  // Executes the source (if it has not been executed yet) and pushes its batches through the chain
+  void execute(const BatchConsumer& consumer) const;
+
+  // Collects the results of the batches in a single table, which has the same rows as the output of root->execute()
+  std::shared_ptr<const Table> execute() const;
+
+  // Same as execute(), but the result becomes the output of the root, as if it had been executed. The other operators
+  // of the chain are not executed.
+  void execute_into_root() const;
+
+ protected:
+  // A copy of the chain, which is executed once per batch. The output of its input is set to the batch.
+  struct ChainCopy {
+    std::shared_ptr<AbstractOperator> input;
+
+    // From bottom to top, i.e., in the reverse order of _operators
+    std::vector<std::shared_ptr<AbstractOperator>> operators;
+  };
+
+  ChainCopy _copy_chain() const;
+
+  // Executes the copy of the chain on top of the given table and returns the output of the copy of the root. The
+  // outputs of the copies are cleared afterwards, so that the intermediates are freed and the copy can be reused.
+  std::shared_ptr<const Table> _execute_chain_copy(const ChainCopy& chain_copy,
+                                                   const std::shared_ptr<const Table>& input_table) const;
+
+  std::vector<std::shared_ptr<AbstractOperator>> _operators;
+  std::shared_ptr<AbstractOperator> _source;
+  size_t _min_batch_size{DEFAULT_MIN_BATCH_SIZE};
+
+  inline static std::atomic_bool _enabled{false};
+};
+
+}  // namespace opossum
@@ -2,9 +2,12 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 #include "concurrency/transaction_context.hpp"
 #include "concurrency/transaction_manager.hpp"
+#include "logging/redo_log.hpp"
+#include "logging/redo_log_records.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/reference_segment.hpp"
@@ -87,6 +90,17 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
 }
 
 void Delete::_on_commit_records(const CommitID cid) {
+  const auto is_logged = RedoLog::get().is_enabled();
+
+  // The Delete only knows the referenced tables, so their names are looked up for the redo log, once for all chunks.
+  // Tables that are not in the StorageManager are not persisted and thus not logged.
+  auto table_names = std::unordered_map<std::shared_ptr<const Table>, std::string>{};
+  if (is_logged) {
+    for (const auto& [table_name, table] : StorageManager::get().tables()) {
+      table_names.emplace(table, table_name);
+    }
+  }
+
   for (ChunkID referencing_chunk_id{0}; referencing_chunk_id < _referencing_table->chunk_count();
        ++referencing_chunk_id) {
     const auto referencing_chunk = _referencing_table->get_chunk(referencing_chunk_id);
@@ -94,6 +108,12 @@ void Delete::_on_commit_records(const CommitID cid) {
         std::static_pointer_cast<const ReferenceSegment>(referencing_chunk->get_segment(ColumnID{0}));
     const auto referenced_table = referencing_segment->referenced_table();
 
+    const auto table_name = table_names.find(referenced_table);
+    if (table_name != table_names.end()) {
+      transaction_context()->redo_log_records().add_rows(RedoLogRecordType::Delete, table_name->second,
+                                                         *referenced_table, *referencing_segment->pos_list());
+    }
+
     for (const auto& row_id : *referencing_segment->pos_list()) {
       auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
 
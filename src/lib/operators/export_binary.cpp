@@ -8,6 +8,8 @@
 
 #include "import_export/binary.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/vector_compression/compressed_vector_type.hpp"
@@ -127,6 +129,21 @@ void ExportBinary::write_binary(const Table& table, const std::string& filename)
   for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); chunk_id++) {
     _write_chunk(table, ofstream, chunk_id);
   }
+
+  auto has_sort_orders = false;
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    has_sort_orders |= table.get_chunk(chunk_id)->ordered_by().has_value();
+  }
+
+  // Files of tables without indexes and sorted chunks are not changed by the trailing sections, see _write_indexes().
+  // As the sort order section follows the index section, the (possibly empty) index section is written in front of it.
+  if (!table.get_indexes().empty() || !table.table_indexes().empty() || has_sort_orders) {
+    _write_indexes(table, ofstream);
+  }
+
+  if (has_sort_orders) {
+    _write_sort_orders(table, ofstream);
+  }
 }
 
 const std::string ExportBinary::name() const { return "ExportBinary"; }
@@ -181,6 +198,51 @@ void ExportBinary::_write_chunk(const Table& table, std::ofstream& ofstream, con
   }
 }
 
+void ExportBinary::_write_indexes(const Table& table, std::ofstream& ofstream) {
+  const auto indexes = table.get_indexes();
+  export_value(ofstream, static_cast<uint32_t>(indexes.size()));
+
+  for (const auto& index_info : indexes) {
+    export_value(ofstream, index_info.type);
+    export_value(ofstream, static_cast<ColumnID::base_type>(index_info.column_ids.size()));
+    export_values(ofstream, index_info.column_ids);
+    export_string_values(ofstream, std::vector<std::string>{index_info.name});
+
+    if (index_info.type != SegmentIndexType::GroupKey) continue;
+
+    // Building a GroupKeyIndex takes two passes over the attribute vector, reading it only one pass over its postings
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto index = std::static_pointer_cast<const GroupKeyIndex>(
+          table.get_chunk(chunk_id)->get_index(SegmentIndexType::GroupKey, index_info.column_ids));
+      export_value(ofstream, static_cast<BoolAsByteType>(index != nullptr));
+      if (!index) continue;
+
+      export_value(ofstream, index->index_offsets().size());
+      export_values(ofstream, index->index_offsets());
+      export_values(ofstream, index->index_postings());
+    }
+  }
+
+  const auto& table_indexes = table.table_indexes();
+  auto table_index_column_ids = std::vector<ColumnID>{};
+  for (const auto& table_index : table_indexes) {
+    table_index_column_ids.emplace_back(table_index->column_id());
+  }
+  export_value(ofstream, static_cast<ColumnID::base_type>(table_index_column_ids.size()));
+  export_values(ofstream, table_index_column_ids);
+}
+
+void ExportBinary::_write_sort_orders(const Table& table, std::ofstream& ofstream) {
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& ordered_by = table.get_chunk(chunk_id)->ordered_by();
+    export_value(ofstream, static_cast<BoolAsByteType>(ordered_by.has_value()));
+    if (!ordered_by) continue;
+
+    export_value(ofstream, static_cast<ColumnID::base_type>(ordered_by->first));
+    export_value(ofstream, ordered_by->second);
+  }
+}
+
 template <typename T>
 void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const BaseValueSegment& base_segment,
                                                           std::shared_ptr<SegmentVisitorContext> base_context) {
@@ -82,6 +82,56 @@ class ExportBinary : public AbstractReadOnlyOperator {
    */
   static void _write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id);
 
+  /**
+   * Writes the definitions of the table's indexes, so that ImportBinary can recreate them. This section is only
+   * written if the table has indexes or sorted chunks. It has the following layout:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Index count           | uint32_t                              |   4
+   * Indexes               | see below                             |   Index count * ...
+   * Table index count     | ColumnID                              |   2
+   * Table index columns   | ColumnID array                        |   Table index count * 2
+   *
+   * Each (chunk) index is written as follows:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Index type            | SegmentIndexType                      |   1
+   * Column count          | ColumnID                              |   2
+   * Column IDs            | ColumnID array                        |   Column count * 2
+   * Name length           | size_t                                |   8
+   * Name                  | std::string                           |   Name length
+   * Chunk indexes°        | see below                             |   Chunk count * ...
+   *
+   * °: Only written for GroupKeyIndexes. Other index types are rebuilt when the table is imported. For each chunk, a
+   *    GroupKeyIndex is dumped with the following layout:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Has index             | bool (stored as BoolAsByteType)       |   1
+   * Index offset count'   | size_t                                |   8
+   * Index offsets'        | size_t array                          |   Index offset count * 8
+   * Index postings'       | ChunkOffset array                     |   rows * 4
+   *
+   * ': These fields are only written if the chunk has the index.
+   */
+  static void _write_indexes(const Table& table, std::ofstream& ofstream);
+
+  /**
+   * Writes the sort order of each chunk (see Chunk::ordered_by()). This section follows the index section and is only
+   * written if at least one chunk is sorted. For each chunk, it contains:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Is sorted             | bool (stored as BoolAsByteType)       |   1
+   * Sort column'          | ColumnID                              |   2
+   * Order by mode'        | OrderByMode                           |   4
+   *
+   * ': These fields are only written if the chunk is sorted.
+   */
+  static void _write_sort_orders(const Table& table, std::ofstream& ofstream);
+
   template <typename T>
   class ExportBinaryVisitor;
 
@@ -32,6 +32,8 @@ void GetTable::set_excluded_chunk_ids(const std::vector<ChunkID>& excluded_chunk
   _excluded_chunk_ids = excluded_chunk_ids;
 }
 
+const std::vector<ChunkID>& GetTable::excluded_chunk_ids() const { return _excluded_chunk_ids; }
+
 std::shared_ptr<AbstractOperator> GetTable::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
@@ -20,6 +20,7 @@ class GetTable : public AbstractReadOnlyOperator {
   const std::string& table_name() const;
 
   void set_excluded_chunk_ids(const std::vector<ChunkID>& excluded_chunk_ids);
+  const std::vector<ChunkID>& excluded_chunk_ids() const;
 
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
@@ -15,6 +15,8 @@
 #include "import_export/binary.hpp"
 #include "resolve_type.hpp"
 #include "storage/chunk.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
 #include "utils/assert.hpp"
@@ -41,6 +43,9 @@ std::shared_ptr<Table> ImportBinary::read_binary(const std::string& filename) {
     _import_chunk(file, table);
   }
 
+  _import_indexes(file, *table);
+  _import_sort_orders(file, *table);
+
   return table;
 }
 
@@ -102,6 +107,8 @@ std::shared_ptr<const Table> ImportBinary::_on_execute() {
   return table;
 }
 
+bool ImportBinary::_creates_stored_data() const { return true; }
+
 std::shared_ptr<AbstractOperator> ImportBinary::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
@@ -140,6 +147,57 @@ void ImportBinary::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& ta
   table->append_chunk(output_segments);
 }
 
+void ImportBinary::_import_indexes(std::ifstream& file, Table& table) {
+  // The index section is optional, see ExportBinary::_write_indexes()
+  if (file.peek() == std::ifstream::traits_type::eof()) return;
+
+  const auto index_count = _read_value<uint32_t>(file);
+  for (auto index_id = uint32_t{0}; index_id < index_count; ++index_id) {
+    const auto index_type = _read_value<SegmentIndexType>(file);
+    const auto column_count = _read_value<ColumnID>(file);
+    const auto column_id_values = _read_values<ColumnID>(file, column_count);
+    const auto column_ids = std::vector<ColumnID>(column_id_values.begin(), column_id_values.end());
+    const auto name = _read_string_values(file, 1)[0];
+
+    if (index_type == SegmentIndexType::GroupKey) {
+      for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+        const auto has_index = _read_value<BoolAsByteType>(file);
+        if (!has_index) continue;
+
+        const auto chunk = table.get_chunk(chunk_id);
+        const auto index_offset_count = _read_value<size_t>(file);
+        const auto index_offsets = _read_values<size_t>(file, index_offset_count);
+        const auto index_postings = _read_values<ChunkOffset>(file, chunk->size());
+        chunk->create_index<GroupKeyIndex>(column_ids, std::vector<size_t>(index_offsets.begin(), index_offsets.end()),
+                                           std::vector<ChunkOffset>(index_postings.begin(), index_postings.end()));
+      }
+    }
+
+    // Builds the chunk indexes that were not loaded above
+    table.create_index(index_type, column_ids, name);
+  }
+
+  const auto table_index_count = _read_value<ColumnID>(file);
+  for (const auto column_id : _read_values<ColumnID>(file, table_index_count)) {
+    table.create_table_index(column_id);
+  }
+}
+
+void ImportBinary::_import_sort_orders(std::ifstream& file, Table& table) {
+  // The sort order section is optional, see ExportBinary::_write_sort_orders(). If the index section was missing, too,
+  // the end of the file was already reached and peeking again would fail.
+  if (file.eof() || file.peek() == std::ifstream::traits_type::eof()) return;
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto is_sorted = _read_value<BoolAsByteType>(file);
+    if (!is_sorted) continue;
+
+    const auto column_id = _read_value<ColumnID>(file);
+    const auto order_by_mode = _read_value<OrderByMode>(file);
+    table.get_chunk(chunk_id)->set_ordered_by({column_id, order_by_mode});
+  }
+}
+
 std::shared_ptr<BaseSegment> ImportBinary::_import_segment(std::ifstream& file, ChunkOffset row_count,
                                                            DataType data_type, bool is_nullable) {
   std::shared_ptr<BaseSegment> result;
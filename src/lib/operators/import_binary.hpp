@@ -35,12 +35,18 @@ class ImportBinary : public AbstractReadOnlyOperator {
    * |   Header   |
    * |------------|
    * |   Chunks¹  |
+   * |------------|
+   * |  Indexes²  |
    * --------------
    *
    * ¹ Zero or more chunks
+   * ² Optional, see ExportBinary::_write_indexes()
    */
   std::shared_ptr<const Table> _on_execute() final;
 
+  // Imported tables are usually stored, even if the operator does not add them to the StorageManager itself
+  bool _creates_stored_data() const final;
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
@@ -83,6 +89,15 @@ class ImportBinary : public AbstractReadOnlyOperator {
    */
   static void _import_chunk(std::ifstream& file, std::shared_ptr<Table>& table);
 
+  /*
+   * Recreates the indexes written by ExportBinary::_write_indexes(), if any. Stored GroupKeyIndexes are loaded, all
+   * other chunk indexes are rebuilt in parallel.
+   */
+  static void _import_indexes(std::ifstream& file, Table& table);
+
+  // Restores the sort orders of the chunks written by ExportBinary::_write_sort_orders(), if any.
+  static void _import_sort_orders(std::ifstream& file, Table& table);
+
   // Calls the right _import_column<ColumnDataType> depending on the given data_type.
   static std::shared_ptr<BaseSegment> _import_segment(std::ifstream& file, ChunkOffset row_count, DataType data_type,
                                                       bool is_nullable);
@@ -42,6 +42,8 @@ std::shared_ptr<const Table> ImportCsv::_on_execute() {
   return table;
 }
 
+bool ImportCsv::_creates_stored_data() const { return true; }
+
 std::shared_ptr<AbstractOperator> ImportCsv::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
@@ -39,6 +39,9 @@ class ImportCsv : public AbstractReadOnlyOperator {
   // Returns the table that was created from the csv file.
   std::shared_ptr<const Table> _on_execute() override;
 
+  // Imported tables are usually stored, even if the operator does not add them to the StorageManager itself
+  bool _creates_stored_data() const override;
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
@@ -1,13 +1,20 @@
 #include "index_scan.hpp"
 
 #include <algorithm>
+#include <iterator>
+#include <optional>
+#include <unordered_set>
 
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 
+#include "resolve_type.hpp"
 #include "storage/index/base_index.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
 
 #include "utils/assert.hpp"
 
@@ -27,13 +34,31 @@ const std::string IndexScan::name() const { return "IndexScan"; }
 
 void IndexScan::set_included_chunk_ids(const std::vector<ChunkID>& chunk_ids) { _included_chunk_ids = chunk_ids; }
 
+const std::vector<ChunkID>& IndexScan::included_chunk_ids() const { return _included_chunk_ids; }
+
+void IndexScan::set_output(const IndexScanOutput output) { _output = output; }
+
+IndexScanOutput IndexScan::output() const { return _output; }
+
 std::shared_ptr<const Table> IndexScan::_on_execute() {
   _in_table = input_table_left();
 
   _validate_input();
 
+  if (_predicate_condition == PredicateCondition::In) _collect_distinct_in_values();
+
+  if (_output != IndexScanOutput::Positions) return _scan_index_only();
+
   _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
 
+  if (_left_column_ids.size() == 1) {
+    const auto table_index = _in_table->get_table_index(_left_column_ids[0]);
+    if (table_index) {
+      _scan_table_index(*table_index);
+      return _out_table;
+    }
+  }
+
   std::mutex output_mutex;
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
@@ -57,8 +82,10 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 std::shared_ptr<AbstractOperator> IndexScan::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<IndexScan>(copied_input_left, _index_type, _left_column_ids, _predicate_condition,
-                                     _right_values, _right_values2);
+  const auto copy = std::make_shared<IndexScan>(copied_input_left, _index_type, _left_column_ids,
+                                                _predicate_condition, _right_values, _right_values2);
+  copy->set_output(_output);
+  return copy;
 }
 
 void IndexScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -91,80 +118,240 @@ void IndexScan::_validate_input() {
   Assert(_predicate_condition != PredicateCondition::Like, "Predicate condition not supported by index scan.");
   Assert(_predicate_condition != PredicateCondition::NotLike, "Predicate condition not supported by index scan.");
 
-  Assert(_left_column_ids.size() == _right_values.size(),
-         "Count mismatch: left column IDs and right values don’t have same size.");
+  if (_predicate_condition == PredicateCondition::In) {
+    Assert(_left_column_ids.size() == 1, "IN is only supported for a single column.");
+  } else {
+    Assert(_left_column_ids.size() == _right_values.size(),
+           "Count mismatch: left column IDs and right values don’t have same size.");
+  }
   if (_predicate_condition == PredicateCondition::Between) {
     Assert(_left_column_ids.size() == _right_values2.size(),
            "Count mismatch: left column IDs and right values don’t have same size.");
   }
 
   Assert(_in_table->type() == TableType::Data, "IndexScan only supports persistent tables right now.");
+
+  // The HashIndex is not ordered and thus cannot answer range queries, see HashIndex
+  Assert(_index_type != SegmentIndexType::Hash || _predicate_condition == PredicateCondition::Equals ||
+             _predicate_condition == PredicateCondition::NotEquals || _predicate_condition == PredicateCondition::In,
+         "Predicate condition not supported by hash index.");
+}
+
+void IndexScan::_scan_table_index(const BaseTableIndex& table_index) {
+  const auto value2 =
+      _right_values2.empty() ? std::optional<AllTypeVariant>{} : std::optional<AllTypeVariant>{_right_values2[0]};
+  auto matches = PosList{};
+  if (_predicate_condition == PredicateCondition::In) {
+    for (const auto& value : _distinct_in_values) {
+      const auto value_matches = table_index.lookup(PredicateCondition::Equals, value);
+      matches.insert(matches.end(), value_matches.begin(), value_matches.end());
+    }
+  } else {
+    matches = table_index.lookup(_predicate_condition, _right_values[0], value2);
+  }
+
+  if (!_included_chunk_ids.empty()) {
+    const auto included_chunk_ids =
+        std::unordered_set<ChunkID>{_included_chunk_ids.begin(), _included_chunk_ids.end()};
+    matches.erase(std::remove_if(matches.begin(), matches.end(),
+                                 [&](const auto& row_id) { return !included_chunk_ids.count(row_id.chunk_id); }),
+                  matches.end());
+  }
+
+  // The index returns the matches ordered by value. To get the same output as the chunk-wise scan, i.e., one output
+  // chunk per input chunk, the matches are sorted by their RowID and split at chunk boundaries.
+  std::sort(matches.begin(), matches.end());
+
+  auto run_begin = matches.cbegin();
+  while (run_begin != matches.cend()) {
+    const auto chunk_id = run_begin->chunk_id;
+    const auto run_end = std::find_if(run_begin, matches.cend(),
+                                      [&](const auto& row_id) { return row_id.chunk_id != chunk_id; });
+
+    const auto matches_out = std::make_shared<PosList>(run_begin, run_end);
+    matches_out->guarantee_single_chunk();
+
+    Segments segments;
+    for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+      segments.push_back(std::make_shared<ReferenceSegment>(_in_table, column_id, matches_out));
+    }
+
+    const auto chunk = _in_table->get_chunk(chunk_id);
+    _out_table->append_chunk(segments, chunk->get_allocator(), chunk->access_counter());
+
+    run_begin = run_end;
+  }
 }
 
 PosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
   const auto to_row_id = [chunk_id](ChunkOffset chunk_offset) { return RowID{chunk_id, chunk_offset}; };
 
-  auto range_begin = BaseIndex::Iterator{};
-  auto range_end = BaseIndex::Iterator{};
-
   const auto chunk = _in_table->get_chunk_with_access_counting(chunk_id);
   auto matches_out = PosList{};
 
   const auto index = chunk->get_index(_index_type, _left_column_ids);
   Assert(index != nullptr, "Index of specified type not found for segment (vector).");
 
+  _for_each_matching_range(*index, [&](const auto& range_begin, const auto& range_end) {
+    const auto previous_size = matches_out.size();
+    matches_out.resize(previous_size + std::distance(range_begin, range_end));
+    std::transform(range_begin, range_end, matches_out.begin() + previous_size, to_row_id);
+  });
+
+  // The ranges of the elements of an IN list are not ordered, restore the order of the chunk
+  if (_predicate_condition == PredicateCondition::In) std::sort(matches_out.begin(), matches_out.end());
+
+  return matches_out;
+}
+
+template <typename Functor>
+void IndexScan::_for_each_matching_range(const BaseIndex& index, const Functor& functor) const {
   switch (_predicate_condition) {
-    case PredicateCondition::Equals: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->upper_bound(_right_values);
-      break;
-    }
-    case PredicateCondition::NotEquals: {
-      // first, get all values less than the search value
-      range_begin = index->cbegin();
-      range_end = index->lower_bound(_right_values);
-
-      matches_out.reserve(std::distance(range_begin, range_end));
-      std::transform(range_begin, range_end, std::back_inserter(matches_out), to_row_id);
-
-      // set range for second half to all values greater than the search value
-      range_begin = index->upper_bound(_right_values);
-      range_end = index->cend();
-      break;
-    }
-    case PredicateCondition::LessThan: {
-      range_begin = index->cbegin();
-      range_end = index->lower_bound(_right_values);
-      break;
-    }
-    case PredicateCondition::LessThanEquals: {
-      range_begin = index->cbegin();
-      range_end = index->upper_bound(_right_values);
-      break;
-    }
-    case PredicateCondition::GreaterThan: {
-      range_begin = index->upper_bound(_right_values);
-      range_end = index->cend();
-      break;
-    }
-    case PredicateCondition::GreaterThanEquals: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->cend();
-      break;
-    }
+    case PredicateCondition::Equals:
+      functor(index.lower_bound(_right_values), index.upper_bound(_right_values));
+      return;
+    case PredicateCondition::NotEquals:
+      // All values less than the search value and all values greater than the search value
+      functor(index.cbegin(), index.lower_bound(_right_values));
+      functor(index.upper_bound(_right_values), index.cend());
+      return;
+    case PredicateCondition::LessThan:
+      functor(index.cbegin(), index.lower_bound(_right_values));
+      return;
+    case PredicateCondition::LessThanEquals:
+      functor(index.cbegin(), index.upper_bound(_right_values));
+      return;
+    case PredicateCondition::GreaterThan:
+      functor(index.upper_bound(_right_values), index.cend());
+      return;
+    case PredicateCondition::GreaterThanEquals:
+      functor(index.lower_bound(_right_values), index.cend());
+      return;
     case PredicateCondition::Between: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->upper_bound(_right_values2);
-      break;
+      // For right_values > right_values2, the upper bound is located before the lower bound
+      const auto range_begin = index.lower_bound(_right_values);
+      functor(range_begin, std::max(range_begin, index.upper_bound(_right_values2)));
+      return;
     }
+    case PredicateCondition::In:
+      // The values are distinct, so the ranges do not overlap
+      for (const auto& value : _distinct_in_values) {
+        functor(index.lower_bound({value}), index.upper_bound({value}));
+      }
+      return;
     default:
       Fail("Unsupported comparison type encountered");
   }
+}
 
-  matches_out.reserve(matches_out.size() + std::distance(range_begin, range_end));
-  std::transform(range_begin, range_end, std::back_inserter(matches_out), to_row_id);
+void IndexScan::_collect_distinct_in_values() {
+  // Cast the values to the column type first, so that, e.g., 1 and 1L are recognized as duplicates. NULL never matches.
+  resolve_data_type(_in_table->column_data_type(_left_column_ids[0]), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
 
-  return matches_out;
+    auto typed_values = std::vector<ColumnDataType>{};
+    typed_values.reserve(_right_values.size());
+    for (const auto& value : _right_values) {
+      if (variant_is_null(value)) continue;
+      typed_values.emplace_back(type_cast_variant<ColumnDataType>(value));
+    }
+
+    std::sort(typed_values.begin(), typed_values.end());
+    typed_values.erase(std::unique(typed_values.begin(), typed_values.end()), typed_values.end());
+
+    _distinct_in_values.assign(typed_values.begin(), typed_values.end());
+  });
+}
+
+std::shared_ptr<const Table> IndexScan::_scan_index_only() const {
+  Assert(_left_column_ids.size() == 1, "Index-only scans are only supported for a single column.");
+  Assert(_included_chunk_ids.empty(), "Index-only scans cover all chunks.");
+
+  const auto column_id = _left_column_ids[0];
+  const auto table_index = _in_table->get_table_index(column_id);
+  const auto value2 =
+      _right_values2.empty() ? std::optional<AllTypeVariant>{} : std::optional<AllTypeVariant>{_right_values2[0]};
+
+  // For equality predicates, each matching row has the search value. Thus, the output can be generated from the
+  // number of matches per search value.
+  const auto is_equality_predicate =
+      _predicate_condition == PredicateCondition::Equals || _predicate_condition == PredicateCondition::In;
+  auto equality_values = std::vector<AllTypeVariant>{};
+  if (_predicate_condition == PredicateCondition::In) {
+    equality_values = _distinct_in_values;
+  } else if (_predicate_condition == PredicateCondition::Equals && !variant_is_null(_right_values[0])) {
+    equality_values = _right_values;
+  }
+
+  const auto count_chunk_index_matches = [&](const auto& functor_for_index) {
+    auto count = size_t{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < _in_table->chunk_count(); ++chunk_id) {
+      const auto index = _in_table->get_chunk(chunk_id)->get_index(_index_type, _left_column_ids);
+      Assert(index, "Index-only scans require an index on every chunk.");
+      count += functor_for_index(*index);
+    }
+    return count;
+  };
+
+  if (_output == IndexScanOutput::Count) {
+    auto count = size_t{0};
+    if (table_index && _predicate_condition == PredicateCondition::In) {
+      for (const auto& value : equality_values) {
+        count += table_index->count(PredicateCondition::Equals, value);
+      }
+    } else if (table_index) {
+      count = table_index->count(_predicate_condition, _right_values[0], value2);
+    } else {
+      count = count_chunk_index_matches([&](const BaseIndex& index) {
+        auto chunk_count = size_t{0};
+        _for_each_matching_range(index, [&](const auto& range_begin, const auto& range_end) {
+          chunk_count += std::distance(range_begin, range_end);
+        });
+        return chunk_count;
+      });
+    }
+
+    // Same schema as the output of the Aggregate operator for COUNT(*)
+    auto output_table =
+        std::make_shared<Table>(TableColumnDefinitions{{"COUNT(*)", DataType::Long, false}}, TableType::Data);
+    output_table->append({static_cast<int64_t>(count)});
+    return output_table;
+  }
+
+  const auto data_type = _in_table->column_data_type(column_id);
+  auto output_table = std::make_shared<Table>(
+      TableColumnDefinitions{{_in_table->column_name(column_id), data_type, false}}, TableType::Data);
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto values = std::vector<ColumnDataType>{};
+    if (table_index) {
+      const auto& typed_table_index = static_cast<const TableIndex<ColumnDataType>&>(*table_index);
+      if (_predicate_condition == PredicateCondition::In) {
+        for (const auto& value : equality_values) {
+          const auto value_matches = typed_table_index.lookup_values(PredicateCondition::Equals, value);
+          values.insert(values.end(), value_matches.begin(), value_matches.end());
+        }
+      } else {
+        values = typed_table_index.lookup_values(_predicate_condition, _right_values[0], value2);
+      }
+    } else {
+      // Chunk indexes only map values to ChunkOffsets, not the other way around
+      Assert(is_equality_predicate, "Index-only scans of chunk indexes can only output values for = and IN.");
+      for (const auto& value : equality_values) {
+        const auto count = count_chunk_index_matches([&](const BaseIndex& index) {
+          return static_cast<size_t>(std::distance(index.lower_bound({value}), index.upper_bound({value})));
+        });
+        values.insert(values.end(), count, type_cast_variant<ColumnDataType>(value));
+      }
+    }
+
+    if (values.empty()) return;
+    output_table->append_chunk({std::make_shared<ValueSegment<ColumnDataType>>(std::move(values))});
+  });
+
+  return output_table;
 }
 
 }  // namespace opossum
@@ -13,10 +13,28 @@ namespace opossum {
 
 class Table;
 class AbstractTask;
+class BaseIndex;
+class BaseTableIndex;
+
+/**
+ * By default, the IndexScan outputs references to the matching rows. The index-only outputs are computed from the
+ * index alone, without accessing the segments of the input table:
+ *   Values: A single column with the value of the scanned column for each matching row. Requires a table index or an
+ *           equality predicate (= or IN), as chunk indexes can not map ChunkOffsets back to values.
+ *   Count:  A single row holding the number of matching rows, as returned by COUNT(*).
+ * Index-only scans do not check the MVCC data of the matching rows and always scan all chunks.
+ */
+enum class IndexScanOutput : uint8_t { Positions, Values, Count };
 
 /**
  * Operator that performs a predicate search using indices
  *
+ * If the input table has a table index (see Table::create_table_index()) on the (single) scanned column, it is used
+ * instead of the chunk indexes, so that the scan takes a single index probe. Otherwise, the chunk indexes of the given
+ * index_type are probed chunk by chunk.
+ *
+ * For PredicateCondition::In, a single column is scanned and right_values holds the elements of the IN list.
+ *
  * Note: Scans only the set of chunks passed to the constructor
  */
 class IndexScan : public AbstractReadOnlyOperator {
@@ -35,6 +53,10 @@ class IndexScan : public AbstractReadOnlyOperator {
    * @see TableScan::set_excluded_chunk_ids for usage
    */
   void set_included_chunk_ids(const std::vector<ChunkID>& chunk_ids);
+  const std::vector<ChunkID>& included_chunk_ids() const;
+
+  void set_output(const IndexScanOutput output);
+  IndexScanOutput output() const;
 
  protected:
   std::shared_ptr<const Table> _on_execute() final;
@@ -47,6 +69,14 @@ class IndexScan : public AbstractReadOnlyOperator {
   void _validate_input();
   std::shared_ptr<AbstractTask> _create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex);
   PosList _scan_chunk(const ChunkID chunk_id);
+  void _scan_table_index(const BaseTableIndex& table_index);
+  std::shared_ptr<const Table> _scan_index_only() const;
+
+  // Calls functor(range_begin, range_end) for each range of ChunkOffsets in the index that matches the predicate
+  template <typename Functor>
+  void _for_each_matching_range(const BaseIndex& index, const Functor& functor) const;
+
+  void _collect_distinct_in_values();
 
  private:
   const SegmentIndexType _index_type;
@@ -56,6 +86,10 @@ class IndexScan : public AbstractReadOnlyOperator {
   const std::vector<AllTypeVariant> _right_values2;
 
   std::vector<ChunkID> _included_chunk_ids;
+  IndexScanOutput _output{IndexScanOutput::Positions};
+
+  // For IN, the elements of the list without NULLs and duplicates
+  std::vector<AllTypeVariant> _distinct_in_values;
 
   std::shared_ptr<const Table> _in_table;
   std::shared_ptr<Table> _out_table;
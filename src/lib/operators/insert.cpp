@@ -1,14 +1,19 @@
 #include "insert.hpp"
 
 #include <algorithm>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "logging/redo_log.hpp"
+#include "logging/redo_log_records.hpp"
 #include "resolve_type.hpp"
 #include "storage/base_encoded_segment.hpp"
 #include "storage/constraints/unique_checker.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/partitioning/abstract_partition_schema.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/value_segment.hpp"
 #include "type_cast.hpp"
@@ -119,6 +124,12 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
         make_unique_by_data_type<AbstractTypedSegmentProcessor, TypedSegmentProcessor>(column_type));
   }
 
+  if (_target_table->partition_schema()) {
+    _insert_into_partitions(context, typed_segment_processors);
+    _insert_into_table_indexes();
+    return nullptr;
+  }
+
   auto total_rows_to_insert = static_cast<uint32_t>(input_table_left()->row_count());
 
   // First, allocate space for all the rows to insert. Do so while locking the table to prevent multiple threads
@@ -228,9 +239,120 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
     start_index = 0u;
   }
 
+  _insert_into_table_indexes();
+
   return nullptr;
 }
 
+void Insert::_insert_into_partitions(
+    const std::shared_ptr<TransactionContext>& context,
+    const std::vector<std::unique_ptr<AbstractTypedSegmentProcessor>>& typed_segment_processors) {
+  const auto& partition_schema = *_target_table->partition_schema();
+  const auto input_table = input_table_left();
+
+  // Group the rows to insert by their partition
+  auto source_rows_by_partition = std::vector<std::vector<RowID>>(partition_schema.partition_count());
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    const auto& segment = *input_table->get_chunk(chunk_id)->get_segment(partition_schema.column_id());
+    for (ChunkOffset chunk_offset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+      const auto partition_id = partition_schema.get_matching_partition(segment[chunk_offset]);
+      source_rows_by_partition[partition_id].emplace_back(chunk_id, chunk_offset);
+    }
+  }
+
+  // Allocate space in the chunks of each partition while holding the append mutex. The target position of each row
+  // is stored next to its source position.
+  auto source_and_target_rows = std::vector<std::pair<RowID, RowID>>{};
+  source_and_target_rows.reserve(input_table->row_count());
+  {
+    auto scoped_lock = _target_table->acquire_append_mutex();
+
+    for (auto partition_id = PartitionID{0}; partition_id < partition_schema.partition_count(); ++partition_id) {
+      const auto& source_rows = source_rows_by_partition[partition_id];
+
+      auto source_row_idx = size_t{0};
+      while (source_row_idx < source_rows.size()) {
+        const auto target_chunk_id = _target_table->mutable_chunk_of_partition(partition_id);
+        const auto target_chunk = _target_table->get_chunk(target_chunk_id);
+
+        const auto old_size = target_chunk->size();
+        const auto rows_to_insert_this_loop = std::min(static_cast<size_t>(_target_table->max_chunk_size() - old_size),
+                                                       source_rows.size() - source_row_idx);
+
+        target_chunk->get_scoped_mvcc_data_lock()->grow_by(rows_to_insert_this_loop, MvccData::MAX_COMMIT_ID);
+        for (ColumnID column_id{0}; column_id < target_chunk->column_count(); ++column_id) {
+          typed_segment_processors[column_id]->resize_vector(target_chunk->get_segment(column_id),
+                                                             old_size + rows_to_insert_this_loop);
+        }
+
+        for (auto row_idx = size_t{0}; row_idx < rows_to_insert_this_loop; ++row_idx) {
+          const auto target_chunk_offset = static_cast<ChunkOffset>(old_size + row_idx);
+          source_and_target_rows.emplace_back(source_rows[source_row_idx + row_idx],
+                                              RowID{target_chunk_id, target_chunk_offset});
+        }
+        source_row_idx += rows_to_insert_this_loop;
+      }
+    }
+  }
+
+  // Check unique constraints. As in _on_execute(), this happens after the chunks were allocated, so that the chunks
+  // created for this insert are included in the ones checked again on commit.
+  const auto& [constraints_satisfied, chunk_id] = check_constraints_for_values(
+      _target_table_name, input_table, transaction_context()->snapshot_commit_id(),
+      transaction_context()->transaction_id());
+  _first_chunk_to_check = chunk_id;
+  if (!constraints_satisfied) {
+    _mark_as_failed();
+  }
+
+  // Then, actually insert the data. The rows of a partition are scattered across the input, so they are copied one by
+  // one.
+  for (const auto& [source_row, target_row] : source_and_target_rows) {
+    const auto source_chunk = input_table->get_chunk(source_row.chunk_id);
+    const auto target_chunk = _target_table->get_chunk(target_row.chunk_id);
+
+    for (ColumnID column_id{0}; column_id < target_chunk->column_count(); ++column_id) {
+      typed_segment_processors[column_id]->copy_data(source_chunk->get_segment(column_id), source_row.chunk_offset,
+                                                     target_chunk->get_segment(column_id), target_row.chunk_offset, 1);
+    }
+
+    // See _on_execute() for why the transaction ID is set here
+    target_chunk->get_scoped_mvcc_data_lock()->tids[target_row.chunk_offset] = context->transaction_id();
+    _inserted_rows.emplace_back(target_row);
+  }
+}
+
+void Insert::_for_each_run_of_inserted_rows(
+    const std::function<void(const Chunk&, ChunkID, ChunkOffset, ChunkOffset)>& functor) const {
+  // The inserted rows of a chunk are stored consecutively in _inserted_rows. Each such run is passed to the functor at
+  // once.
+  auto run_begin = size_t{0};
+  while (run_begin < _inserted_rows.size()) {
+    const auto chunk_id = _inserted_rows[run_begin].chunk_id;
+    auto run_end = run_begin + 1;
+    while (run_end < _inserted_rows.size() && _inserted_rows[run_end].chunk_id == chunk_id &&
+           _inserted_rows[run_end].chunk_offset == _inserted_rows[run_end - 1].chunk_offset + 1) {
+      ++run_end;
+    }
+
+    functor(*_target_table->get_chunk(chunk_id), chunk_id, _inserted_rows[run_begin].chunk_offset,
+            _inserted_rows[run_end - 1].chunk_offset + 1);
+    run_begin = run_end;
+  }
+}
+
+void Insert::_insert_into_table_indexes() {
+  const auto& table_indexes = _target_table->table_indexes();
+  if (table_indexes.empty()) return;
+
+  _for_each_run_of_inserted_rows([&](const auto& chunk, const auto chunk_id, const auto begin, const auto end) {
+    for (const auto& table_index : table_indexes) {
+      table_index->insert_rows(chunk, chunk_id, begin, end);
+    }
+  });
+  _inserted_into_table_indexes = true;
+}
+
 void Insert::_on_commit_records(const CommitID cid) {
   for (auto row_id : _inserted_rows) {
     auto chunk = _target_table->get_chunk(row_id.chunk_id);
@@ -239,6 +361,11 @@ void Insert::_on_commit_records(const CommitID cid) {
     mvcc_data->begin_cids[row_id.chunk_offset] = cid;
     mvcc_data->tids[row_id.chunk_offset] = 0u;
   }
+
+  if (RedoLog::get().is_enabled()) {
+    transaction_context()->redo_log_records().add_rows(RedoLogRecordType::Insert, _target_table_name, *_target_table,
+                                                       _inserted_rows);
+  }
 }
 
 void Insert::_on_rollback_records() {
@@ -252,6 +379,18 @@ void Insert::_on_rollback_records() {
 
     chunk->get_scoped_mvcc_data_lock()->tids[row_id.chunk_offset] = 0u;
   }
+
+  // The rows are invisible now, but would still be returned by index lookups and filtered only by the Validate
+  // operator. As they will never become visible, remove them from the table indexes right away. If the Insert failed
+  // while copying the data, the rows have not been indexed yet.
+  const auto& table_indexes = _target_table->table_indexes();
+  if (table_indexes.empty() || !_inserted_into_table_indexes) return;
+
+  _for_each_run_of_inserted_rows([&](const auto& chunk, const auto chunk_id, const auto begin, const auto end) {
+    for (const auto& table_index : table_indexes) {
+      table_index->erase_rows(chunk, chunk_id, begin, end);
+    }
+  });
 }
 
 std::shared_ptr<AbstractOperator> Insert::_on_deep_copy(
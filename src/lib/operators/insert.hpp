@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -10,6 +11,8 @@
 
 namespace opossum {
 
+class AbstractTypedSegmentProcessor;
+class Chunk;
 class TransactionContext;
 
 /**
@@ -17,6 +20,8 @@ class TransactionContext;
  * Expects the table name of the table to insert into as a string and
  * the values to insert in a separate table using the same column layout.
  *
+ * If the target table is partitioned (see AbstractPartitionSchema), each row is inserted into a chunk of its partition.
+ *
  * Assumption: The input has been validated before.
  * Note: Insert does not support null values at the moment
  */
@@ -46,12 +51,27 @@ class Insert : public AbstractReadWriteOperator {
   void _on_commit_records(const CommitID cid) override;
   void _on_rollback_records() override;
 
+  // Used instead of the regular, contiguous insertion if the target table is partitioned
+  void _insert_into_partitions(
+      const std::shared_ptr<TransactionContext>& context,
+      const std::vector<std::unique_ptr<AbstractTypedSegmentProcessor>>& typed_segment_processors);
+
+  // Calls the functor for each range of consecutive inserted rows within a chunk
+  void _for_each_run_of_inserted_rows(
+      const std::function<void(const Chunk&, ChunkID, ChunkOffset, ChunkOffset)>& functor) const;
+
+  // Adds the inserted rows to the table indexes of the target table (see Table::create_table_index())
+  void _insert_into_table_indexes();
+
  private:
   const std::string _target_table_name;
   std::shared_ptr<Table> _target_table;
 
   PosList _inserted_rows;
 
+  // Set once _inserted_rows have been added to the table indexes, so that a rollback only removes indexed rows
+  bool _inserted_into_table_indexes{false};
+
   ChunkID _first_chunk_to_check;
 };
 
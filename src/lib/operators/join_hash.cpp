@@ -15,10 +15,12 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/morsel_queue.hpp"
+#include "scheduler/topology.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "type_cast.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
-#include "utils/timer.hpp"
 
 namespace opossum {
 
@@ -86,7 +88,7 @@ void JoinHash::_on_cleanup() { _impl.reset(); }
 template <typename LeftType, typename RightType>
 class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
  public:
-  JoinHashImpl(const JoinHash& join_hash, const std::shared_ptr<const AbstractOperator>& left,
+  JoinHashImpl(JoinHash& join_hash, const std::shared_ptr<const AbstractOperator>& left,
                const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                const ColumnIDPair& column_ids, const PredicateCondition predicate_condition, const bool inputs_swapped,
                const std::optional<size_t>& radix_bits = std::nullopt)
@@ -105,7 +107,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   }
 
  protected:
-  const JoinHash& _join_hash;
+  JoinHash& _join_hash;
   const std::shared_ptr<const AbstractOperator> _left, _right;
   const JoinMode _mode;
   const ColumnIDPair _column_ids;
@@ -119,6 +121,41 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   // Determine correct type for hashing
   using HashedType = typename JoinHashTraits<LeftType, RightType>::HashType;
 
+  // State of the pre-probing phase, which is shared with the jobs that materialize and partition the inputs
+  std::shared_ptr<const Table> _left_in_table;
+  std::shared_ptr<const Table> _right_in_table;
+
+  /*
+   * This flag is used in the materialization and probing phases.
+   * When dealing with an OUTER join, we need to make sure that we keep the NULL values for the outer relation.
+   * In the current implementation, the relation on the right is always the outer relation.
+   */
+  bool _keep_nulls{false};
+
+  std::vector<Morsel> _left_morsels;
+  std::vector<Morsel> _right_morsels;
+  std::vector<size_t> _left_morsel_offsets;
+  std::vector<size_t> _right_morsel_offsets;
+
+  // Containers used to store histograms for (potentially subsequent) radix
+  // partitioning phase (in cases _radix_bits > 0). Created during materialization phase.
+  std::vector<std::vector<size_t>> _histograms_left;
+  std::vector<std::vector<size_t>> _histograms_right;
+
+  // Output containers of materialization phase. Type similar to the output
+  // of radix partitioning phase to allow short cut for _radix_bits == 0
+  // (in this case, we can skip the partitioning alltogether).
+  RadixContainer<LeftType> _materialized_left;
+  RadixContainer<RightType> _materialized_right;
+
+  // Containers for potential (skipped when left side small) radix partitioning phase
+  RadixContainer<LeftType> _radix_left;
+  RadixContainer<RightType> _radix_right;
+  std::vector<std::optional<HashTable<HashedType>>> _hashtables;
+  std::vector<NodeID> _hashtable_node_ids;
+
+  std::vector<bool> _right_chunks_to_skip;
+
   size_t _calculate_radix_bits() const {
     /*
       Setting number of bits for radix clustering:
@@ -166,48 +203,74 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     return static_cast<size_t>(std::ceil(std::log2(cluster_count)));
   }
 
-  std::shared_ptr<const Table> _on_execute() override {
-    auto right_in_table = _right->get_output();
-    auto left_in_table = _left->get_output();
+  // The statistics of the probe relation are only used if both join columns have the same type, so that the values of
+  // the build relation can be passed to the filters without any conversion.
+  bool _has_statistics_for_pruning(const Table& table, const ColumnID column_id) const {
+    if constexpr (!std::is_same_v<LeftType, RightType>) {
+      return false;
+    } else {
+      for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+        if (get_segment_statistics_for_pruning(table, chunk_id, column_id)) return true;
+      }
+      return false;
+    }
+  }
 
-    _output_table = _join_hash._initialize_output_table();
+  // Uses the minimum and maximum of the materialized build relation to find the chunks of the probe relation that
+  // cannot contain any join partners.
+  std::vector<bool> _determine_prunable_right_chunks(const RadixContainer<LeftType>& materialized_left,
+                                                     const Table& right_in_table) const {
+    auto chunks_to_skip = std::vector<bool>(right_in_table.chunk_count(), false);
 
-    /*
-     * This flag is used in the materialization and probing phases.
-     * When dealing with an OUTER join, we need to make sure that we keep the NULL values for the outer relation.
-     * In the current implementation, the relation on the right is always the outer relation.
-     */
-    const auto keep_nulls = (_mode == JoinMode::Left || _mode == JoinMode::Right);
+    auto min = std::optional<LeftType>{};
+    auto max = std::optional<LeftType>{};
+    for (const auto& element : *materialized_left.elements) {
+      // NULL_ROW_IDs mark NULL values and unused slots (see materialize_input)
+      if (element.row_id == NULL_ROW_ID) continue;
 
-    // Pre-partitioning:
-    // Save chunk offsets into the input relation.
-    const auto left_chunk_offsets = determine_chunk_offsets(left_in_table);
-    const auto right_chunk_offsets = determine_chunk_offsets(right_in_table);
+      if (!min || element.value < *min) min = element.value;
+      if (!max || *max < element.value) max = element.value;
+    }
+
+    // An empty build relation cannot produce any output. Nothing to gain from pruning here.
+    if (!min) return chunks_to_skip;
+
+    for (ChunkID chunk_id{0}; chunk_id < right_in_table.chunk_count(); ++chunk_id) {
+      const auto segment_statistics = get_segment_statistics_for_pruning(right_in_table, chunk_id, _column_ids.second);
+      if (segment_statistics && segment_statistics->can_prune(PredicateCondition::Between, AllTypeVariant{*min},
+                                                              AllTypeVariant{*max})) {
+        chunks_to_skip[chunk_id] = true;
+      }
+    }
 
-    Timer performance_timer;
+    return chunks_to_skip;
+  }
 
-    // Containers used to store histograms for (potentially subsequent) radix
-    // partitioning phase (in cases _radix_bits > 0). Created during materialization phase.
-    std::vector<std::vector<size_t>> histograms_left;
-    std::vector<std::vector<size_t>> histograms_right;
+  std::shared_ptr<const Table> _on_execute() override {
+    _right_in_table = _right->get_output();
+    _left_in_table = _left->get_output();
 
-    // Output containers of materialization phase. Type similar to the output
-    // of radix partitioning phase to allow short cut for _radix_bits == 0
-    // (in this case, we can skip the partitioning alltogether).
-    RadixContainer<LeftType> materialized_left;
-    RadixContainer<RightType> materialized_right;
+    _output_table = _join_hash._initialize_output_table();
+
+    _keep_nulls = (_mode == JoinMode::Left || _mode == JoinMode::Right);
 
-    // Containers for potential (skipped when left side small) radix partitioning phase
-    RadixContainer<LeftType> radix_left;
-    RadixContainer<RightType> radix_right;
-    std::vector<std::optional<HashTable<HashedType>>> hashtables;
+    // Pre-partitioning:
+    // Split the input relations into morsels (see MorselQueue), which are materialized in parallel, and save their
+    // offsets into the materialized relations. Large chunks are split into several morsels, so that the workers are
+    // kept busy even if the inputs have only few chunks.
+    _left_morsels =
+        MorselQueue::split_table(*_left_in_table, MorselQueue::morsel_size_for(_left_in_table->row_count()));
+    _right_morsels =
+        MorselQueue::split_table(*_right_in_table, MorselQueue::morsel_size_for(_right_in_table->row_count()));
+    _left_morsel_offsets = determine_morsel_offsets(_left_morsels);
+    _right_morsel_offsets = determine_morsel_offsets(_right_morsels);
 
     // Depiction of the hash join parallelization (radix partitioning can be skipped when radix_bits = 0)
     // ===============================================================================================
     // We have two data paths, one for left side and one for right input side. We can prepare (i.e.,
     // materialize(), build(), etc.) both sides in parallel until the actual join takes place.
     // All tasks might spawn concurrent tasks themselves. For example, materialize parallelizes over
-    // the input chunks and the following steps over the radix clusters.
+    // the input morsels and the following steps over the radix clusters.
     //
     //           Relation Left                       Relation Right
     //                 |                                    |
@@ -223,65 +286,96 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     //                           \                 /
     //                          Probing (actual Join)
 
+    // Dynamic chunk pruning: In inner and semi joins, rows of the probe relation only make it into the output if they
+    // have a join partner. Chunks of the probe relation whose statistics rule out all values of the build relation are
+    // thus not materialized. As this requires the build relation to be materialized first, the two sides are only
+    // serialized if the probe relation has statistics that could be used.
+    const auto prune_right_chunks = (_mode == JoinMode::Inner || _mode == JoinMode::Semi) &&
+                                    _has_statistics_for_pruning(*_right_in_table, _column_ids.second);
+
+    if (prune_right_chunks) {
+      _materialized_left = materialize_input<LeftType, HashedType, false>(
+          _left_in_table, _column_ids.first, _histograms_left, _radix_bits, {}, _left_morsels);
+      _right_chunks_to_skip = _determine_prunable_right_chunks(_materialized_left, *_right_in_table);
+    }
+
     std::vector<std::shared_ptr<AbstractTask>> jobs;
 
     // Pre-Probing path of left relation
-    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+    jobs.emplace_back(std::make_shared<JobTask>([this, prune_right_chunks]() {
       // materialize left table (NULLs are always discarded for the build side)
-      materialized_left = materialize_input<LeftType, HashedType, false>(left_in_table, _column_ids.first,
-                                                                         histograms_left, _radix_bits);
+      if (!prune_right_chunks) {
+        _materialized_left = materialize_input<LeftType, HashedType, false>(
+            _left_in_table, _column_ids.first, _histograms_left, _radix_bits, {}, _left_morsels);
+      }
 
       if (_radix_bits > 0) {
         // radix partition the left table
-        radix_left = partition_radix_parallel<LeftType, HashedType, false>(materialized_left, left_chunk_offsets,
-                                                                           histograms_left, _radix_bits);
+        _radix_left = partition_radix_parallel<LeftType, HashedType, false>(_materialized_left, _left_morsel_offsets,
+                                                                            _histograms_left, _radix_bits);
       } else {
         // short cut: skip radix partitioning and use materialized data directly
-        radix_left = std::move(materialized_left);
+        _radix_left = std::move(_materialized_left);
       }
 
       // build hash tables
-      hashtables = build<LeftType, HashedType>(radix_left);
+      _hashtables = build<LeftType, HashedType>(_radix_left, &_hashtable_node_ids);
     }));
     jobs.back()->schedule();
 
-    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+    jobs.emplace_back(std::make_shared<JobTask>([this]() {
       // Materialize right table. The third template parameter signals if the relation on the right (probe
       // relation) materializes NULL values when executing OUTER joins (default is to discard NULL values).
-      if (keep_nulls) {
-        materialized_right = materialize_input<RightType, HashedType, true>(right_in_table, _column_ids.second,
-                                                                            histograms_right, _radix_bits);
+      if (_keep_nulls) {
+        _materialized_right = materialize_input<RightType, HashedType, true>(
+            _right_in_table, _column_ids.second, _histograms_right, _radix_bits, {}, _right_morsels);
       } else {
-        materialized_right = materialize_input<RightType, HashedType, false>(right_in_table, _column_ids.second,
-                                                                             histograms_right, _radix_bits);
+        _materialized_right =
+            materialize_input<RightType, HashedType, false>(_right_in_table, _column_ids.second, _histograms_right,
+                                                            _radix_bits, _right_chunks_to_skip, _right_morsels);
       }
 
       if (_radix_bits > 0) {
         // radix partition the right table. 'keep_nulls' makes sure that the
         // relation on the right keeps NULL values when executing an OUTER join.
-        if (keep_nulls) {
-          radix_right = partition_radix_parallel<RightType, HashedType, true>(materialized_right, right_chunk_offsets,
-                                                                              histograms_right, _radix_bits);
+        if (_keep_nulls) {
+          _radix_right = partition_radix_parallel<RightType, HashedType, true>(
+              _materialized_right, _right_morsel_offsets, _histograms_right, _radix_bits);
         } else {
-          radix_right = partition_radix_parallel<RightType, HashedType, false>(materialized_right, right_chunk_offsets,
-                                                                               histograms_right, _radix_bits);
+          _radix_right = partition_radix_parallel<RightType, HashedType, false>(
+              _materialized_right, _right_morsel_offsets, _histograms_right, _radix_bits);
         }
       } else {
         // short cut: skip radix partitioning and use materialized data directly
-        radix_right = std::move(materialized_right);
+        _radix_right = std::move(_materialized_right);
       }
     }));
     jobs.back()->schedule();
 
-    CurrentScheduler::wait_for_tasks(jobs);
+    // Instead of blocking the worker until both sides are prepared, the task that executes the join yields (see
+    // AbstractOperator::_continue_after_tasks()). The impl lives until JoinHash::_on_cleanup(), i.e., until the probe
+    // phase is done.
+    return _join_hash._continue_after_tasks(jobs, [this]() { return _probe_and_write_output(); });
+  }
 
+  std::shared_ptr<const Table> _probe_and_write_output() {
     // Probe phase
     std::vector<PosList> left_pos_lists;
     std::vector<PosList> right_pos_lists;
-    const size_t partition_count = radix_right.partition_offsets.size();
-    left_pos_lists.resize(partition_count);
-    right_pos_lists.resize(partition_count);
+    const size_t partition_count = _radix_right.partition_offsets.size();
+    left_pos_lists.reserve(partition_count);
+    right_pos_lists.reserve(partition_count);
     for (size_t i = 0; i < partition_count; i++) {
+      // Allocate the PosLists on the node that probes the partition. Thus, the PosLists of the probe, which are
+      // allocated on the worker's node (see ScopedDefaultMemoryResource), are moved into them without being copied.
+      auto allocator = PolymorphicAllocator<RowID>{};
+      if (i < _hashtable_node_ids.size() && _hashtable_node_ids[i] != CURRENT_NODE_ID) {
+        const auto node_id = static_cast<int>(_hashtable_node_ids[i]);
+        allocator = PolymorphicAllocator<RowID>{Topology::get().get_memory_resource(node_id)};
+      }
+      left_pos_lists.emplace_back(allocator);
+      right_pos_lists.emplace_back(allocator);
+
       // simple heuristic: half of the rows of the right relation will match
       const size_t result_rows_per_partition = _right->get_output()->row_count() / partition_count / 2;
 
@@ -291,15 +385,17 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     /*
     NUMA notes:
     The workers for each radix partition P should be scheduled on the same node as the input data:
-    leftP, rightP and hashtableP.
+    leftP, rightP and hashtableP. We schedule them on the node of hashtableP, which is usually the largest of the three.
     */
     if (_mode == JoinMode::Semi || _mode == JoinMode::Anti) {
-      probe_semi_anti<RightType, HashedType>(radix_right, hashtables, right_pos_lists, _mode);
+      probe_semi_anti<RightType, HashedType>(_radix_right, _hashtables, right_pos_lists, _mode, _hashtable_node_ids);
     } else {
       if (_mode == JoinMode::Left || _mode == JoinMode::Right) {
-        probe<RightType, HashedType, true>(radix_right, hashtables, left_pos_lists, right_pos_lists, _mode);
+        probe<RightType, HashedType, true>(_radix_right, _hashtables, left_pos_lists, right_pos_lists, _mode,
+                                           _hashtable_node_ids);
       } else {
-        probe<RightType, HashedType, false>(radix_right, hashtables, left_pos_lists, right_pos_lists, _mode);
+        probe<RightType, HashedType, false>(_radix_right, _hashtables, left_pos_lists, right_pos_lists, _mode,
+                                            _hashtable_node_ids);
       }
     }
 
@@ -321,13 +417,13 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     PosListsBySegment right_pos_lists_by_segment;
 
     // left_pos_lists_by_segment will only be needed if left is a reference table and being output
-    if (left_in_table->type() == TableType::References && !only_output_right_input) {
-      left_pos_lists_by_segment = setup_pos_lists_by_segment(left_in_table);
+    if (_left_in_table->type() == TableType::References && !only_output_right_input) {
+      left_pos_lists_by_segment = setup_pos_lists_by_segment(_left_in_table);
     }
 
     // right_pos_lists_by_segment will only be needed if right is a reference table
-    if (right_in_table->type() == TableType::References) {
-      right_pos_lists_by_segment = setup_pos_lists_by_segment(right_in_table);
+    if (_right_in_table->type() == TableType::References) {
+      right_pos_lists_by_segment = setup_pos_lists_by_segment(_right_in_table);
     }
 
     for (size_t partition_id = 0; partition_id < left_pos_lists.size(); ++partition_id) {
@@ -344,15 +440,15 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
       // we need to swap back the inputs, so that the order of the output columns is not harmed
       if (_inputs_swapped) {
-        write_output_segments(output_segments, right_in_table, right_pos_lists_by_segment, right);
+        write_output_segments(output_segments, _right_in_table, right_pos_lists_by_segment, right);
 
         // Semi/Anti joins are always swapped but do not need the outer relation
         if (!only_output_right_input) {
-          write_output_segments(output_segments, left_in_table, left_pos_lists_by_segment, left);
+          write_output_segments(output_segments, _left_in_table, left_pos_lists_by_segment, left);
         }
       } else {
-        write_output_segments(output_segments, left_in_table, left_pos_lists_by_segment, left);
-        write_output_segments(output_segments, right_in_table, right_pos_lists_by_segment, right);
+        write_output_segments(output_segments, _left_in_table, left_pos_lists_by_segment, left);
+        write_output_segments(output_segments, _right_in_table, right_pos_lists_by_segment, right);
       }
 
       _output_table->append_chunk(output_segments);
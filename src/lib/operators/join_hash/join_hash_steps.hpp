@@ -8,7 +8,12 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/morsel_queue.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/worker.hpp"
+#include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_cast.hpp"
 #include "type_comparison.hpp"
@@ -86,9 +91,32 @@ inline std::vector<size_t> determine_chunk_offsets(std::shared_ptr<const Table>
   return chunk_offsets;
 }
 
+// Same as determine_chunk_offsets(), but for the morsels that materialize_input() was called with
+inline std::vector<size_t> determine_morsel_offsets(const std::vector<Morsel>& morsels) {
+  auto morsel_offsets = std::vector<size_t>(morsels.size());
+
+  size_t offset = 0;
+  for (auto morsel_index = size_t{0}; morsel_index < morsels.size(); ++morsel_index) {
+    morsel_offsets[morsel_index] = offset;
+    offset += morsels[morsel_index].size();
+  }
+  return morsel_offsets;
+}
+
+/*
+Materializes the join column of in_table. Chunks for which chunks_to_skip holds true are not materialized, i.e., their
+slots remain filled with NULL_ROW_ID elements and their histograms are empty. This is used for pruning probe-side
+chunks that cannot have join partners (see JoinHash). An empty chunks_to_skip means that all chunks are materialized.
+
+The work is distributed across the workers in morsels (see MorselQueue), which have to cover all rows of in_table in
+the order of the table. If no morsels are given, every chunk is a morsel. One histogram is created per morsel, and the
+morsels determine the offsets that have to be passed to partition_radix_parallel() (see determine_morsel_offsets()).
+*/
 template <typename T, typename HashedType, bool consider_null_values>
 RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table, ColumnID column_id,
-                                    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits) {
+                                    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
+                                    const std::vector<bool>& chunks_to_skip = {},
+                                    const std::vector<Morsel>& morsels = {}) {
   const std::hash<HashedType> hash_function;
   // list of all elements that will be partitioned
   auto elements = std::make_shared<Partition<T>>(in_table->row_count());
@@ -105,46 +133,60 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
   size_t pass = 0;
   size_t mask = static_cast<uint32_t>(pow(2, radix_bits * (pass + 1)) - 1);
 
-  auto chunk_offsets = std::vector<size_t>(in_table->chunk_count());
-
   // fill work queue
-  {
-    size_t output_offset = 0;
-    for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); chunk_id++) {
-      auto segment = in_table->get_chunk(chunk_id)->get_segment(column_id);
-
-      chunk_offsets[chunk_id] = output_offset;
-      output_offset += segment->size();
+  auto morsel_queue = MorselQueue{morsels.empty() ? MorselQueue::split_table(*in_table, Chunk::MAX_SIZE) : morsels};
+  const auto& input_morsels = morsel_queue.morsels();
+  const auto morsel_offsets = determine_morsel_offsets(input_morsels);
+  DebugAssert(input_morsels.empty() || morsel_offsets.back() + input_morsels.back().size() == in_table->row_count(),
+              "Morsels have to cover the entire table");
+
+  // create histograms per morsel
+  histograms.resize(input_morsels.size());
+
+  morsel_queue.process([&](const size_t morsel_index) {
+    const auto& morsel = input_morsels[morsel_index];
+    const auto chunk_id = morsel.chunk_id;
+    const auto skip_chunk = !chunks_to_skip.empty() && chunks_to_skip[chunk_id];
+
+    // Get information from work queue
+    auto output_offset = morsel_offsets[morsel_index];
+    auto output_iterator = elements->begin() + output_offset;
+    auto segment = in_table->get_chunk(chunk_id)->get_segment(column_id);
+
+    [[maybe_unused]] auto null_value_bitvector_iterator = null_value_bitvector->begin();
+    if constexpr (consider_null_values) {
+      null_value_bitvector_iterator += output_offset;
     }
-  }
-
-  // create histograms per chunk
-  histograms.resize(chunk_offsets.size());
 
-  std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(in_table->chunk_count());
-
-  for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
-    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
-      // Get information from work queue
-      auto output_offset = chunk_offsets[chunk_id];
-      auto output_iterator = elements->begin() + output_offset;
-      auto segment = in_table->get_chunk(chunk_id)->get_segment(column_id);
-
-      [[maybe_unused]] auto null_value_bitvector_iterator = null_value_bitvector->begin();
-      if constexpr (consider_null_values) {
-        null_value_bitvector_iterator += output_offset;
+    // prepare histogram
+    auto histogram = std::vector<size_t>(num_partitions);
+
+    auto reference_chunk_offset = morsel.begin_offset;
+
+    if (!skip_chunk) {
+      // If the morsel covers only a part of the chunk, its rows are passed as a position filter. Advancing the
+      // iterators of some encodings (e.g., RunLength, FrameOfReference, or SimdBp128) to the begin of the morsel takes
+      // time linear in the offset, while their point access does not. ReferenceSegments only support sequential
+      // iteration, but advancing their iterators is cheap. Offsets of filtered iterators are relative to the filter.
+      auto position_filter = std::shared_ptr<PosList>{};
+      if (morsel.size() != segment->size() && !std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+        position_filter = std::make_shared<PosList>(morsel.size());
+        for (auto chunk_offset = morsel.begin_offset; chunk_offset < morsel.end_offset; ++chunk_offset) {
+          (*position_filter)[chunk_offset - morsel.begin_offset] = RowID{chunk_id, chunk_offset};
+        }
+        position_filter->guarantee_single_chunk();
       }
+      const auto filter_begin_offset = position_filter ? morsel.begin_offset : ChunkOffset{0};
 
-      // prepare histogram
-      auto histogram = std::vector<size_t>(num_partitions);
-
-      auto reference_chunk_offset = ChunkOffset{0};
-
-      segment_with_iterators<T>(*segment, [&](auto it, const auto end) {
+      segment_with_iterators_filtered<T>(*segment, position_filter, [&](auto it, [[maybe_unused]] const auto end) {
         using IterableType = typename decltype(it)::IterableType;
 
-        while (it != end) {
+        // Only iterate over the rows of the morsel
+        it += morsel.begin_offset - filter_begin_offset;
+        auto morsel_end = it;
+        morsel_end += morsel.size();
+
+        while (it != morsel_end) {
           const auto& value = *it;
           ++it;
 
@@ -159,7 +201,8 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
             if constexpr (std::is_same_v<IterableType, ReferenceSegmentIterable<T>>) {
               *(output_iterator++) = PartitionedElement<T>{RowID{chunk_id, reference_chunk_offset}, value.value()};
             } else {
-              *(output_iterator++) = PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, value.value()};
+              *(output_iterator++) =
+                  PartitionedElement<T>{RowID{chunk_id, filter_begin_offset + value.chunk_offset()}, value.value()};
             }
 
             // In case we care about NULL values, store the NULL flag
@@ -179,29 +222,32 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
           }
         }
       });
+    }
 
-      if constexpr (std::is_same_v<Partition<T>, uninitialized_vector<PartitionedElement<T>>>) {  // NOLINT
-        // Because the vector is uninitialized, we need to manually fill up all slots that we did not use
-        auto output_offset_end = chunk_id < chunk_offsets.size() - 1 ? chunk_offsets[chunk_id + 1] : elements->size();
-        while (output_iterator != elements->begin() + output_offset_end) {
-          *(output_iterator++) = PartitionedElement<T>{};
-        }
+    if constexpr (std::is_same_v<Partition<T>, uninitialized_vector<PartitionedElement<T>>>) {  // NOLINT
+      // Because the vector is uninitialized, we need to manually fill up all slots that we did not use
+      auto output_offset_end =
+          morsel_index < morsel_offsets.size() - 1 ? morsel_offsets[morsel_index + 1] : elements->size();
+      while (output_iterator != elements->begin() + output_offset_end) {
+        *(output_iterator++) = PartitionedElement<T>{};
       }
+    }
 
-      histograms[chunk_id] = std::move(histogram);
-    }));
-    jobs.back()->schedule();
-  }
-  CurrentScheduler::wait_for_tasks(jobs);
+    histograms[morsel_index] = std::move(histogram);
+  });
 
   return RadixContainer<T>{elements, std::vector<size_t>{elements->size()}, null_value_bitvector};
 }
 
 /*
-Build all the hash tables for the partitions of Left. We parallelize this process for all partitions of Left
+Build all the hash tables for the partitions of Left. We parallelize this process for all partitions of Left.
+
+If hashtable_node_ids is given, it receives the NUMA node that each hash table was built on (CURRENT_NODE_ID if it
+was not built by a worker), so that the probe of the partition can be scheduled on that node.
 */
 template <typename LeftType, typename HashedType>
-std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<LeftType>& radix_container) {
+std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<LeftType>& radix_container,
+                                                        std::vector<NodeID>* hashtable_node_ids = nullptr) {
   /*
   NUMA notes:
   The hashtables for each partition P should also reside on the same node as the two vectors leftP and rightP.
@@ -209,6 +255,8 @@ std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<Lef
   std::vector<std::optional<HashTable<HashedType>>> hashtables;
   hashtables.resize(radix_container.partition_offsets.size());
 
+  if (hashtable_node_ids) hashtable_node_ids->assign(radix_container.partition_offsets.size(), CURRENT_NODE_ID);
+
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(radix_container.partition_offsets.size());
 
@@ -249,6 +297,11 @@ std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<Lef
       }
 
       hashtables[current_partition_id] = std::move(hashtable);
+
+      if (hashtable_node_ids) {
+        const auto worker = Worker::get_this_thread_worker();
+        if (worker) (*hashtable_node_ids)[current_partition_id] = worker->queue()->node_id();
+      }
     }));
     jobs.back()->schedule();
   }
@@ -258,6 +311,10 @@ std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<Lef
   return hashtables;
 }
 
+/*
+Radix partitions the output of materialize_input(). chunk_offsets and histograms refer to the morsels that the input
+was materialized in (see determine_chunk_offsets() and determine_morsel_offsets()).
+*/
 template <typename T, typename HashedType, bool consider_null_values>
 RadixContainer<T> partition_radix_parallel(const RadixContainer<T>& radix_container,
                                            const std::vector<size_t>& chunk_offsets,
@@ -357,11 +414,16 @@ RadixContainer<T> partition_radix_parallel(const RadixContainer<T>& radix_contai
   In the probe phase we take all partitions from the right partition, iterate over them and compare each join candidate
   with the values in the hash table. Since Left and Right are hashed using the same hash function, we can reduce the
   number of hash tables that need to be looked into to just 1.
+
+  If hashtable_node_ids (see build()) is given, each partition is probed on the node its hash table was built on. As
+  the probe waits for these jobs, the scheduler prefers them over the tasks of queries that have just arrived (see
+  NodeQueueScheduler::schedule()).
   */
 template <typename RightType, typename HashedType, bool consider_null_values>
 void probe(const RadixContainer<RightType>& radix_container,
            const std::vector<std::optional<HashTable<HashedType>>>& hashtables, std::vector<PosList>& pos_lists_left,
-           std::vector<PosList>& pos_lists_right, const JoinMode mode) {
+           std::vector<PosList>& pos_lists_right, const JoinMode mode,
+           const std::vector<NodeID>& hashtable_node_ids = {}) {
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(radix_container.partition_offsets.size());
 
@@ -486,7 +548,7 @@ void probe(const RadixContainer<RightType>& radix_container,
         pos_lists_right[current_partition_id] = std::move(pos_list_right_local);
       }
     }));
-    jobs.back()->schedule();
+    jobs.back()->schedule(hashtable_node_ids.empty() ? CURRENT_NODE_ID : hashtable_node_ids[current_partition_id]);
   }
 
   CurrentScheduler::wait_for_tasks(jobs);
@@ -495,7 +557,8 @@ void probe(const RadixContainer<RightType>& radix_container,
 template <typename RightType, typename HashedType>
 void probe_semi_anti(const RadixContainer<RightType>& radix_container,
                      const std::vector<std::optional<HashTable<HashedType>>>& hashtables,
-                     std::vector<PosList>& pos_lists, const JoinMode mode) {
+                     std::vector<PosList>& pos_lists, const JoinMode mode,
+                     const std::vector<NodeID>& hashtable_node_ids = {}) {
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(radix_container.partition_offsets.size());
 
@@ -548,7 +611,7 @@ void probe_semi_anti(const RadixContainer<RightType>& radix_container,
         pos_lists[current_partition_id] = std::move(pos_list_local);
       }
     }));
-    jobs.back()->schedule();
+    jobs.back()->schedule(hashtable_node_ids.empty() ? CURRENT_NODE_ID : hashtable_node_ids[current_partition_id]);
   }
 
   CurrentScheduler::wait_for_tasks(jobs);
@@ -12,6 +12,7 @@
 #include "join_nested_loop.hpp"
 #include "resolve_type.hpp"
 #include "storage/index/base_index.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
@@ -76,46 +77,73 @@ void JoinIndex::_perform_join() {
 
   auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
 
-  // Scan all chunks for right input
-  for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < input_table_right()->chunk_count(); ++chunk_id_right) {
-    const auto chunk_right = input_table_right()->get_chunk(chunk_id_right);
-    const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_column_ids.second});
-    if (track_right_matches) _right_matches[chunk_id_right].resize(chunk_right->size());
+  if (track_right_matches) {
+    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < input_table_right()->chunk_count(); ++chunk_id_right) {
+      _right_matches[chunk_id_right].resize(input_table_right()->get_chunk(chunk_id_right)->size());
+    }
+  }
 
-    std::shared_ptr<BaseIndex> index = nullptr;
+  // A table index on the right column covers all chunks of the right input, so each left value needs a single probe.
+  // As the index returns RowIDs of the indexed table, it can only be used if the right input is that table.
+  const auto table_index = input_table_right()->type() == TableType::Data
+                               ? input_table_right()->get_table_index(_column_ids.second)
+                               : nullptr;
+
+  if (table_index) {
+    for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
+      const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
 
-    if (!indices.empty()) {
-      // We assume the first index to be efficient for our join
-      // as we do not want to spend time on evaluating the best index inside of this join loop
-      index = indices.front();
+      segment_with_iterators(*segment_left, [&](auto it, const auto end) {
+        _join_segment_using_table_index(it, end, chunk_id_left, *table_index);
+      });
     }
+    performance_data.chunks_scanned_with_index = input_table_right()->chunk_count();
+  } else {
+    // Scan all chunks for right input
+    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < input_table_right()->chunk_count(); ++chunk_id_right) {
+      const auto chunk_right = input_table_right()->get_chunk(chunk_id_right);
+      const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_column_ids.second});
+
+      std::shared_ptr<BaseIndex> index = nullptr;
+
+      // We assume the first index to be efficient for our join as we do not want to spend time on evaluating the best
+      // index inside of this join loop. Only HashIndexes are preferred for equi joins, but cannot be used otherwise as
+      // they are not ordered.
+      const auto is_equi_join = _predicate_condition == PredicateCondition::Equals;
+      for (const auto& candidate_index : indices) {
+        const auto is_hash_index = candidate_index->type() == SegmentIndexType::Hash;
+        if (is_hash_index && !is_equi_join && _predicate_condition != PredicateCondition::NotEquals) continue;
+        if (!index || (is_hash_index && is_equi_join)) index = candidate_index;
+      }
 
-    // Scan all chunks from left input
-    if (index != nullptr) {
-      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
-        const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
+      // Scan all chunks from left input
+      if (index != nullptr) {
+        for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
+          const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
 
-        segment_with_iterators(*segment_left, [&](auto it, const auto end) {
-          _join_two_segments_using_index(it, end, chunk_id_left, chunk_id_right, index);
-        });
-      }
-      performance_data.chunks_scanned_with_index++;
-    } else {
-      // Fall back to NestedLoopJoin
-      const auto segment_right = input_table_right()->get_chunk(chunk_id_right)->get_segment(_column_ids.second);
-      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
-        const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
-        JoinNestedLoop::JoinParams params{*_pos_list_left,
-                                          *_pos_list_right,
-                                          _left_matches[chunk_id_left],
-                                          _right_matches[chunk_id_right],
-                                          track_left_matches,
-                                          track_right_matches,
-                                          _mode,
-                                          _predicate_condition};
-        JoinNestedLoop::_join_two_untyped_segments(segment_left, segment_right, chunk_id_left, chunk_id_right, params);
+          segment_with_iterators(*segment_left, [&](auto it, const auto end) {
+            _join_two_segments_using_index(it, end, chunk_id_left, chunk_id_right, index);
+          });
+        }
+        performance_data.chunks_scanned_with_index++;
+      } else {
+        // Fall back to NestedLoopJoin
+        const auto segment_right = input_table_right()->get_chunk(chunk_id_right)->get_segment(_column_ids.second);
+        for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
+          const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
+          JoinNestedLoop::JoinParams params{*_pos_list_left,
+                                            *_pos_list_right,
+                                            _left_matches[chunk_id_left],
+                                            _right_matches[chunk_id_right],
+                                            track_left_matches,
+                                            track_right_matches,
+                                            _mode,
+                                            _predicate_condition};
+          JoinNestedLoop::_join_two_untyped_segments(segment_left, segment_right, chunk_id_left, chunk_id_right,
+                                                     params);
+        }
+        performance_data.chunks_scanned_without_index++;
       }
-      performance_data.chunks_scanned_without_index++;
     }
   }
 
@@ -219,6 +247,36 @@ void JoinIndex::_join_two_segments_using_index(LeftIterator left_it, LeftIterato
   }
 }
 
+// join loop that joins a segment of the left column with the entire right column using a table index
+template <typename LeftIterator>
+void JoinIndex::_join_segment_using_table_index(LeftIterator left_it, LeftIterator left_end,
+                                                const ChunkID chunk_id_left, const BaseTableIndex& table_index) {
+  // The table index is probed for `right <flipped condition> left_value`
+  const auto flipped_predicate_condition = flip_predicate_condition(_predicate_condition);
+
+  for (; left_it != left_end; ++left_it) {
+    const auto left_value = *left_it;
+    if (left_value.is_null()) continue;
+
+    const auto right_matches = table_index.lookup(flipped_predicate_condition, left_value.value());
+    if (right_matches.empty()) continue;
+
+    if (_mode == JoinMode::Left || _mode == JoinMode::Outer) {
+      _left_matches[chunk_id_left][left_value.chunk_offset()] = true;
+    }
+
+    std::fill_n(std::back_inserter(*_pos_list_left), right_matches.size(),
+                RowID{chunk_id_left, left_value.chunk_offset()});
+    _pos_list_right->insert(_pos_list_right->end(), right_matches.begin(), right_matches.end());
+
+    if (_mode == JoinMode::Outer || _mode == JoinMode::Right) {
+      for (const auto& row_id : right_matches) {
+        _right_matches[row_id.chunk_id][row_id.chunk_offset] = true;
+      }
+    }
+  }
+}
+
 // join loop that joins two segments of two columns via their iterators
 template <typename BinaryFunctor, typename LeftIterator, typename RightIterator>
 void JoinIndex::_join_two_segments_nested_loop(const BinaryFunctor& func, LeftIterator left_it, LeftIterator left_end,
@@ -2,9 +2,14 @@
 
 #include <sstream>
 
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
 #include "constant_mappings.hpp"
+#include "logging/redo_log.hpp"
+#include "logging/redo_log_records.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -44,11 +49,26 @@ std::shared_ptr<const Table> CreateTable::_on_execute() {
   // TODO(anybody) chunk size and mvcc not yet specifiable
   const auto table = std::make_shared<Table>(column_definitions, TableType::Data, Chunk::DEFAULT_SIZE, UseMvcc::Yes);
 
+  // The table is logged before it is added, so that no rows can be logged for it before the table itself. As it is not
+  // removed if the surrounding transaction is rolled back, it is logged in a transaction of its own.
+  if (RedoLog::get().is_enabled()) {
+    Assert(!StorageManager::get().has_table(table_name), "A table with the name " + table_name + " already exists");
+
+    auto records = RedoLogRecords{};
+    records.add_create_table(table_name, column_definitions);
+
+    const auto transaction_context = TransactionManager::get().new_transaction_context();
+    transaction_context->add_redo_log_records(records);
+    transaction_context->commit();
+  }
+
   StorageManager::get().add_table(table_name, table);
 
   return std::make_shared<Table>(TableColumnDefinitions{{"OK", DataType::Int}}, TableType::Data);  // Dummy table
 }
 
+bool CreateTable::_creates_stored_data() const { return true; }
+
 std::shared_ptr<AbstractOperator> CreateTable::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
@@ -1,5 +1,9 @@
 #include "drop_table.hpp"
 
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "logging/redo_log.hpp"
+#include "logging/redo_log_records.hpp"
 #include "storage/storage_manager.hpp"
 
 namespace opossum {
@@ -16,6 +20,16 @@ const std::string DropTable::description(DescriptionMode description_mode) const
 std::shared_ptr<const Table> DropTable::_on_execute() {
   StorageManager::get().drop_table(table_name);
 
+  // Rows of the table that are committed after this are skipped by the recovery, as the table no longer exists
+  if (RedoLog::get().is_enabled()) {
+    auto records = RedoLogRecords{};
+    records.add_drop_table(table_name);
+
+    const auto transaction_context = TransactionManager::get().new_transaction_context();
+    transaction_context->add_redo_log_records(records);
+    transaction_context->commit();
+  }
+
   return std::make_shared<Table>(TableColumnDefinitions{{"OK", DataType::Int}}, TableType::Data);  // Dummy table
 }
 
@@ -7,6 +7,7 @@
 #include <utility>
 #include <vector>
 
+#include "scheduler/query_context.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/segment_accessor.hpp"
 #include "storage/segment_iterate.hpp"
@@ -51,8 +52,12 @@ class Sort::SortImplMaterializeOutput {
   // creates a new table with reference segments
   SortImplMaterializeOutput(const std::shared_ptr<const Table>& in,
                             const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>>& id_value_map,
-                            const size_t output_chunk_size)
-      : _table_in(in), _output_chunk_size(output_chunk_size), _row_id_value_vector(id_value_map) {}
+                            const ColumnID column_id, const OrderByMode order_by_mode, const size_t output_chunk_size)
+      : _table_in(in),
+        _column_id(column_id),
+        _order_by_mode(order_by_mode),
+        _output_chunk_size(output_chunk_size),
+        _row_id_value_vector(id_value_map) {}
 
   std::shared_ptr<const Table> execute() {
     // First we create a new table as the output
@@ -144,8 +149,11 @@ class Sort::SortImplMaterializeOutput {
       });
     }
 
+    // Each output chunk holds a contiguous range of the sorted rows, so all of them are sorted by the sort column. Mark
+    // them as such so that later scans (e.g., if the output is stored as a table) can use binary search.
     for (auto& segments : output_segments_by_chunk) {
       output->append_chunk(segments);
+      output->get_chunk(static_cast<ChunkID>(output->chunk_count() - 1))->set_ordered_by({_column_id, _order_by_mode});
     }
 
     return output;
@@ -153,6 +161,8 @@ class Sort::SortImplMaterializeOutput {
 
  protected:
   const std::shared_ptr<const Table> _table_in;
+  const ColumnID _column_id;
+  const OrderByMode _order_by_mode;
   const size_t _output_chunk_size;
   const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>> _row_id_value_vector;
 };
@@ -199,8 +209,8 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
 
     // 3. Materialization of the result: We take the sorted ValueRowID Vector, create chunks fill them until they are
     // full and create the next one. Each chunk is filled row by row.
-    auto materialization = std::make_shared<SortImplMaterializeOutput<SortColumnType>>(_table_in, _row_id_value_vector,
-                                                                                       _output_chunk_size);
+    auto materialization = std::make_shared<SortImplMaterializeOutput<SortColumnType>>(
+        _table_in, _row_id_value_vector, _column_id, _order_by_mode, _output_chunk_size);
     return materialization->execute();
   }
 
@@ -212,6 +222,8 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
     auto& null_value_rows = *_null_value_rows;
 
     for (ChunkID chunk_id{0}; chunk_id < _table_in->chunk_count(); ++chunk_id) {
+      QueryContext::throw_if_current_query_cancelled();
+
       auto chunk = _table_in->get_chunk(chunk_id);
 
       auto base_segment = chunk->get_segment(_column_id);
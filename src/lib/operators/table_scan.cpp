@@ -1,5 +1,6 @@
 #include "table_scan.hpp"
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -20,9 +21,7 @@
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "operators/operator_scan_predicate.hpp"
-#include "scheduler/abstract_task.hpp"
-#include "scheduler/current_scheduler.hpp"
-#include "scheduler/job_task.hpp"
+#include "scheduler/morsel_queue.hpp"
 #include "storage/base_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/proxy_chunk.hpp"
@@ -59,6 +58,10 @@ const std::string TableScan::description(DescriptionMode description_mode) const
   stream << "Impl: " << _impl_description;
   stream << separator << _predicate->as_column_name();
 
+  if (_pruned_chunk_count > 0) {
+    stream << separator << "(" << _pruned_chunk_count << " Chunks pruned at runtime)";
+  }
+
   return stream.str();
 }
 
@@ -77,97 +80,179 @@ std::shared_ptr<AbstractOperator> TableScan::_on_deep_copy(
 }
 
 std::shared_ptr<const Table> TableScan::_on_execute() {
-  const auto in_table = input_table_left();
+  // Everything the morsel jobs use. The jobs might outlive this call (see _continue_after_tasks()).
+  struct ScanState {
+    std::shared_ptr<const Table> in_table;
+    std::shared_ptr<Table> output_table;
+    std::mutex output_mutex;
+
+    std::vector<Morsel> morsels;
+    std::vector<size_t> first_morsel_index_by_chunk;
+    std::vector<size_t> morsel_count_by_chunk;
+    std::vector<std::atomic<size_t>> pending_morsel_count_by_chunk;
+    std::vector<std::shared_ptr<PosList>> matches_by_morsel;
+
+    std::optional<MorselQueue> morsel_queue;
+  };
+  const auto state = std::make_shared<ScanState>();
 
-  const auto output_table = std::make_shared<Table>(in_table->column_definitions(), TableType::References);
+  const auto in_table = input_table_left();
+  state->in_table = in_table;
+  state->output_table = std::make_shared<Table>(in_table->column_definitions(), TableType::References);
 
   _impl = create_impl();
   _impl_description = _impl->description();
 
-  std::mutex output_mutex;
-
   const auto excluded_chunk_set = std::unordered_set<ChunkID>{_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend()};
 
-  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  jobs.reserve(in_table->chunk_count() - excluded_chunk_set.size());
+  _pruned_chunk_count = 0;
+
+  /**
+   * The scan is parallelized using morsels (see MorselQueue). Chunks that are larger than the morsel size are split
+   * into several morsels if the impl supports this, so that tables with few, large chunks keep all workers busy. The
+   * matches of a chunk are combined by the worker that finishes its last morsel. Thus, the output still has one chunk
+   * per input chunk with matches.
+   */
+  const auto morsel_size = MorselQueue::morsel_size_for(in_table->row_count());
+
+  auto& morsels = state->morsels;
+  morsels.reserve(in_table->chunk_count() - excluded_chunk_set.size());
+
+  // The morsels of a chunk are consecutive. For each chunk, the index of its first morsel, the number of its morsels,
+  // and the number of morsels that have not been scanned yet are stored.
+  auto& first_morsel_index_by_chunk = state->first_morsel_index_by_chunk;
+  auto& morsel_count_by_chunk = state->morsel_count_by_chunk;
+  auto& pending_morsel_count_by_chunk = state->pending_morsel_count_by_chunk;
+  first_morsel_index_by_chunk.resize(in_table->chunk_count());
+  morsel_count_by_chunk.resize(in_table->chunk_count());
+  pending_morsel_count_by_chunk = std::vector<std::atomic<size_t>>(in_table->chunk_count());
 
   for (ChunkID chunk_id{0u}; chunk_id < in_table->chunk_count(); ++chunk_id) {
     if (excluded_chunk_set.count(chunk_id)) continue;
 
-    auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
-      const auto chunk_guard = in_table->get_chunk_with_access_counting(chunk_id);
-      // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = _impl->scan_chunk(chunk_id);
-      if (matches_out->empty()) return;
-
-      // The ChunkAccessCounter is reused to track accesses of the output chunk. Accesses of derived chunks are counted
-      // towards the original chunk.
-      Segments out_segments;
-
-      /**
-       * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
-       * directly use the matches to construct the reference segments of the output. If it is a reference segment,
-       * we need to resolve the row IDs so that they reference the physical data segments (value, dictionary) instead,
-       * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
-       * between segments as much as possible. Position lists can be shared between two segments iff
-       * (a) they point to the same table and
-       * (b) the reference segments of the input table point to the same positions in the same order
-       *     (i.e. they share their position list).
-       */
-      if (in_table->type() == TableType::References) {
-        const auto chunk_in = in_table->get_chunk(chunk_id);
-
-        auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
-
-        for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-          auto segment_in = chunk_in->get_segment(column_id);
-
-          auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
-          DebugAssert(ref_segment_in != nullptr, "All segments should be of type ReferenceSegment.");
-
-          const auto pos_list_in = ref_segment_in->pos_list();
-
-          const auto table_out = ref_segment_in->referenced_table();
-          const auto column_id_out = ref_segment_in->referenced_column_id();
-
-          auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
-
-          if (!filtered_pos_list) {
-            filtered_pos_list = std::make_shared<PosList>(matches_out->size());
-            if (pos_list_in->references_single_chunk()) {
-              filtered_pos_list->guarantee_single_chunk();
-            }
-
-            size_t offset = 0;
-            for (const auto& match : *matches_out) {
-              const auto row_id = (*pos_list_in)[match.chunk_offset];
-              (*filtered_pos_list)[offset] = row_id;
-              ++offset;
-            }
+    // The ChunkPruningRule can only consider literal values. Now that placeholders are bound and uncorrelated
+    // subqueries are resolved, the impl might be able to rule out further chunks.
+    if (_impl->can_prune_chunk(chunk_id)) {
+      ++_pruned_chunk_count;
+      continue;
+    }
+
+    first_morsel_index_by_chunk[chunk_id] = morsels.size();
+
+    const auto chunk_size = in_table->get_chunk(chunk_id)->size();
+    if (chunk_size > morsel_size && _impl->can_split_chunk(chunk_id)) {
+      MorselQueue::split_chunk(morsels, chunk_id, chunk_size, morsel_size);
+    } else {
+      morsels.emplace_back(Morsel{chunk_id, ChunkOffset{0}, chunk_size});
+    }
+
+    morsel_count_by_chunk[chunk_id] = morsels.size() - first_morsel_index_by_chunk[chunk_id];
+    pending_morsel_count_by_chunk[chunk_id] = morsel_count_by_chunk[chunk_id];
+  }
+
+  state->matches_by_morsel.resize(morsels.size());
+
+  const auto add_output_chunk = [state](const ChunkID chunk_id, const std::shared_ptr<PosList>& matches_out,
+                                        const ProxyChunk& chunk_guard) {
+    const auto& in_table = state->in_table;
+
+    // The ChunkAccessCounter is reused to track accesses of the output chunk. Accesses of derived chunks are counted
+    // towards the original chunk.
+    Segments out_segments;
+
+    /**
+     * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
+     * directly use the matches to construct the reference segments of the output. If it is a reference segment,
+     * we need to resolve the row IDs so that they reference the physical data segments (value, dictionary) instead,
+     * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
+     * between segments as much as possible. Position lists can be shared between two segments iff
+     * (a) they point to the same table and
+     * (b) the reference segments of the input table point to the same positions in the same order
+     *     (i.e. they share their position list).
+     */
+    if (in_table->type() == TableType::References) {
+      const auto chunk_in = in_table->get_chunk(chunk_id);
+
+      auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+
+      for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+        auto segment_in = chunk_in->get_segment(column_id);
+
+        auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
+        DebugAssert(ref_segment_in != nullptr, "All segments should be of type ReferenceSegment.");
+
+        const auto pos_list_in = ref_segment_in->pos_list();
+
+        const auto table_out = ref_segment_in->referenced_table();
+        const auto column_id_out = ref_segment_in->referenced_column_id();
+
+        auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+
+        if (!filtered_pos_list) {
+          filtered_pos_list = std::make_shared<PosList>(matches_out->size());
+          if (pos_list_in->references_single_chunk()) {
+            filtered_pos_list->guarantee_single_chunk();
           }
 
-          auto ref_segment_out = std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
-          out_segments.push_back(ref_segment_out);
-        }
-      } else {
-        matches_out->guarantee_single_chunk();
-        for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-          auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, matches_out);
-          out_segments.push_back(ref_segment_out);
+          size_t offset = 0;
+          for (const auto& match : *matches_out) {
+            const auto row_id = (*pos_list_in)[match.chunk_offset];
+            (*filtered_pos_list)[offset] = row_id;
+            ++offset;
+          }
         }
+
+        auto ref_segment_out = std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
+        out_segments.push_back(ref_segment_out);
+      }
+    } else {
+      matches_out->guarantee_single_chunk();
+      for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+        auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, matches_out);
+        out_segments.push_back(ref_segment_out);
       }
+    }
 
-      std::lock_guard<std::mutex> lock(output_mutex);
-      output_table->append_chunk(out_segments, chunk_guard->get_allocator(), chunk_guard->access_counter());
-    });
+    std::lock_guard<std::mutex> lock(state->output_mutex);
+    state->output_table->append_chunk(out_segments, chunk_guard->get_allocator(), chunk_guard->access_counter());
+  };
+
+  state->morsel_queue.emplace(morsels);
+  const auto jobs = state->morsel_queue->schedule([this, state, add_output_chunk](const size_t morsel_index) {
+    auto& matches_by_morsel = state->matches_by_morsel;
+    const auto& morsel = state->morsels[morsel_index];
+    const auto chunk_id = morsel.chunk_id;
+    const auto chunk_guard = state->in_table->get_chunk_with_access_counting(chunk_id);
+
+    // The actual scan happens in the sub classes of BaseTableScanImpl
+    if (morsel.begin_offset == 0 && morsel.end_offset == chunk_guard->size()) {
+      matches_by_morsel[morsel_index] = _impl->scan_chunk(chunk_id);
+    } else {
+      matches_by_morsel[morsel_index] = _impl->scan_chunk_range(chunk_id, morsel.begin_offset, morsel.end_offset);
+    }
 
-    jobs.push_back(job_task);
-    job_task->schedule();
-  }
+    // The worker that scans the last pending morsel of the chunk creates the output chunk. The decrement orders the
+    // writes to matches_by_morsel of the other morsels before the reads below.
+    if (--state->pending_morsel_count_by_chunk[chunk_id] > 0) return;
+
+    const auto first_morsel_index = state->first_morsel_index_by_chunk[chunk_id];
+    const auto morsel_count = state->morsel_count_by_chunk[chunk_id];
+    auto matches_out = matches_by_morsel[first_morsel_index];
+    if (morsel_count > 1) {
+      // Concatenate the matches of the morsels, which keeps them ordered by their chunk offset
+      matches_out = std::make_shared<PosList>();
+      for (auto index = first_morsel_index; index < first_morsel_index + morsel_count; ++index) {
+        matches_out->insert(matches_out->end(), matches_by_morsel[index]->begin(), matches_by_morsel[index]->end());
+        matches_by_morsel[index] = nullptr;
+      }
+    }
+
+    if (matches_out->empty()) return;
 
-  CurrentScheduler::wait_for_tasks(jobs);
+    add_output_chunk(chunk_id, matches_out, chunk_guard);
+  });
 
-  return output_table;
+  return _continue_after_tasks(jobs, [state]() { return state->output_table; });
 }
 
 std::shared_ptr<AbstractExpression> TableScan::_resolve_uncorrelated_subqueries(
@@ -74,6 +74,9 @@ class TableScan : public AbstractReadOnlyOperator {
   std::string _impl_description{"Unset"};
 
   std::vector<ChunkID> _excluded_chunk_ids;
+
+  // Number of chunks that were skipped because the impl determined at runtime that they cannot contain matches
+  size_t _pruned_chunk_count{0};
 };
 
 }  // namespace opossum
@@ -1,16 +1,23 @@
 #include "abstract_single_column_table_scan_impl.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "resolve_type.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "statistics/chunk_statistics/zone_map.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/base_value_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/split_pos_list_by_chunk_id.hpp"
 #include "storage/table.hpp"
 #include "storage/value_segment.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_utils.hpp"
 
 namespace opossum {
 
@@ -28,12 +35,157 @@ std::shared_ptr<PosList> AbstractSingleColumnTableScanImpl::scan_chunk(const Chu
   if (const auto& reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment)) {
     _scan_reference_segment(*reference_segment, chunk_id, *matches);
   } else {
+    // If the chunk is sorted by the scanned column, the impl might be able to use binary search
+    if (_can_use_sorted_search(*chunk) &&
+        _scan_sorted_segment(*segment, chunk_id, *matches, chunk->ordered_by()->second)) {
+      return matches;
+    }
+
+    // Skip blocks that cannot contain matches according to the segment's zone map
+    if (const auto unpruned_positions = _get_unpruned_positions(*chunk, chunk_id)) {
+      if (unpruned_positions->empty()) return matches;
+
+      _scan_non_reference_segment(*segment, chunk_id, *matches, unpruned_positions);
+
+      // The scan has filled `matches` with offsets into `unpruned_positions`, so we need to map them back to the
+      // chunk offsets (cf. _scan_reference_segment)
+      for (auto& match : *matches) {
+        match.chunk_offset = (*unpruned_positions)[match.chunk_offset].chunk_offset;
+      }
+      return matches;
+    }
+
     _scan_non_reference_segment(*segment, chunk_id, *matches, nullptr);
   }
 
   return matches;
 }
 
+bool AbstractSingleColumnTableScanImpl::can_split_chunk(const ChunkID chunk_id) const {
+  return !_can_use_sorted_search(*_in_table->get_chunk(chunk_id));
+}
+
+std::shared_ptr<PosList> AbstractSingleColumnTableScanImpl::scan_chunk_range(const ChunkID chunk_id,
+                                                                            const ChunkOffset begin_offset,
+                                                                            const ChunkOffset end_offset) const {
+  const auto& chunk = _in_table->get_chunk(chunk_id);
+  const auto& segment = chunk->get_segment(_column_id);
+  DebugAssert(begin_offset <= end_offset && end_offset <= chunk->size(), "Invalid range of rows to scan");
+
+  auto matches = std::make_shared<PosList>();
+
+  if (const auto& reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment)) {
+    // Scan a ReferenceSegment that only holds the positions of the range. The resulting offsets are relative to the
+    // beginning of the range.
+    const auto& pos_list = *reference_segment->pos_list();
+    const auto range_pos_list =
+        std::make_shared<PosList>(pos_list.begin() + begin_offset, pos_list.begin() + end_offset);
+    if (pos_list.references_single_chunk()) range_pos_list->guarantee_single_chunk();
+
+    const auto range_segment = ReferenceSegment{reference_segment->referenced_table(),
+                                                reference_segment->referenced_column_id(), range_pos_list};
+    _scan_reference_segment(range_segment, chunk_id, *matches);
+
+    for (auto& match : *matches) {
+      match.chunk_offset += begin_offset;
+    }
+    return matches;
+  }
+
+  // The rows of the range are passed to the impl as a position filter. If the zone map allows for skipping blocks (see
+  // scan_chunk()), only the unpruned positions within the range are included.
+  auto position_filter = std::shared_ptr<PosList>{};
+  if (const auto unpruned_positions = _get_unpruned_positions(*chunk, chunk_id)) {
+    // The unpruned positions are ordered by their chunk offset
+    const auto compare_chunk_offset = [](const RowID& row_id, const ChunkOffset chunk_offset) {
+      return row_id.chunk_offset < chunk_offset;
+    };
+    const auto range_begin =
+        std::lower_bound(unpruned_positions->begin(), unpruned_positions->end(), begin_offset, compare_chunk_offset);
+    const auto range_end = std::lower_bound(range_begin, unpruned_positions->end(), end_offset, compare_chunk_offset);
+    position_filter = std::make_shared<PosList>(range_begin, range_end);
+  } else {
+    position_filter = std::make_shared<PosList>(end_offset - begin_offset);
+    for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+      (*position_filter)[chunk_offset - begin_offset] = RowID{chunk_id, chunk_offset};
+    }
+  }
+  position_filter->guarantee_single_chunk();
+
+  if (position_filter->empty()) return matches;
+
+  _scan_non_reference_segment(*segment, chunk_id, *matches, position_filter);
+
+  // The scan has filled `matches` with offsets into `position_filter`, so we need to map them back to the chunk offsets
+  for (auto& match : *matches) {
+    match.chunk_offset = (*position_filter)[match.chunk_offset].chunk_offset;
+  }
+  return matches;
+}
+
+bool AbstractSingleColumnTableScanImpl::can_prune_chunk(const ChunkID chunk_id) const {
+  const auto segment_statistics = get_segment_statistics_for_pruning(*_in_table, chunk_id, _column_id);
+  return segment_statistics && _can_prune_segment(*segment_statistics);
+}
+
+bool AbstractSingleColumnTableScanImpl::_can_prune_segment(const SegmentStatistics& segment_statistics) const {
+  return false;
+}
+
+bool AbstractSingleColumnTableScanImpl::_can_prune_block(
+    const std::shared_ptr<const AbstractFilter>& block_filter) const {
+  return false;
+}
+
+std::shared_ptr<PosList> AbstractSingleColumnTableScanImpl::_get_unpruned_positions(const Chunk& chunk,
+                                                                                     const ChunkID chunk_id) const {
+  const auto& chunk_statistics = chunk.statistics();
+  if (!chunk_statistics) return nullptr;
+
+  const auto& zone_map = chunk_statistics->statistics()[_column_id]->zone_map();
+  if (!zone_map) return nullptr;
+
+  auto unpruned_block_ids = std::vector<size_t>{};
+  for (auto block_id = size_t{0}; block_id < zone_map->block_count(); ++block_id) {
+    if (!_can_prune_block(zone_map->block_filter(block_id))) unpruned_block_ids.emplace_back(block_id);
+  }
+
+  // Scanning with a position filter uses point access, which is slower than the sequential scan. Only use the zone map
+  // if this is outweighed by the number of skipped blocks.
+  if (unpruned_block_ids.size() * 2 > zone_map->block_count()) return nullptr;
+
+  auto unpruned_positions = std::make_shared<PosList>();
+  unpruned_positions->reserve(unpruned_block_ids.size() * zone_map->block_size());
+  for (const auto block_id : unpruned_block_ids) {
+    const auto [block_begin, block_end] = zone_map->block_range(block_id);
+    for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+      unpruned_positions->emplace_back(chunk_id, chunk_offset);
+    }
+  }
+  unpruned_positions->guarantee_single_chunk();
+
+  return unpruned_positions;
+}
+
+bool AbstractSingleColumnTableScanImpl::_can_use_sorted_search(const Chunk& chunk) const {
+  // Binary search is only used for segments whose iterators can be advanced in constant time. This rules out run-length
+  // and frame-of-reference encoded segments as well as dictionary segments with SimdBp128-compressed attribute vectors,
+  // for which each probe would cost O(n) and the search would be slower than a linear scan.
+  const auto& ordered_by = chunk.ordered_by();
+  if (!ordered_by || ordered_by->first != _column_id) return false;
+
+  const auto& segment = chunk.get_segment(_column_id);
+  if (std::dynamic_pointer_cast<const BaseValueSegment>(segment)) return true;
+
+  const auto dictionary_segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(segment);
+  return dictionary_segment && is_fixed_size_byte_aligned(*dictionary_segment->compressed_vector_type());
+}
+
+bool AbstractSingleColumnTableScanImpl::_scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                             PosList& matches, const OrderByMode order_by_mode) const {
+  return false;
+}
+
 void AbstractSingleColumnTableScanImpl::_scan_reference_segment(const ReferenceSegment& segment, const ChunkID chunk_id,
                                                                 PosList& matches) const {
   const auto& pos_list = segment.pos_list();
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <iterator>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -12,9 +13,12 @@
 
 namespace opossum {
 
-class Table;
-class ReferenceSegment;
+class AbstractFilter;
 class AttributeVectorIterable;
+class Chunk;
+class ReferenceSegment;
+class SegmentStatistics;
+class Table;
 
 /**
  * @brief The base class of table scan impls that scan a single column
@@ -29,6 +33,14 @@ class AbstractSingleColumnTableScanImpl : public AbstractTableScanImpl {
 
   std::shared_ptr<PosList> scan_chunk(const ChunkID chunk_id) const override;
 
+  // Chunks that are sorted by the scanned column are not split, as the binary search is cheap anyway
+  bool can_split_chunk(const ChunkID chunk_id) const override;
+
+  std::shared_ptr<PosList> scan_chunk_range(const ChunkID chunk_id, const ChunkOffset begin_offset,
+                                            const ChunkOffset end_offset) const override;
+
+  bool can_prune_chunk(const ChunkID chunk_id) const override;
+
  protected:
   void _scan_reference_segment(const ReferenceSegment& segment, const ChunkID chunk_id, PosList& matches) const;
 
@@ -39,6 +51,47 @@ class AbstractSingleColumnTableScanImpl : public AbstractTableScanImpl {
   virtual void _scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
                                            const std::shared_ptr<const PosList>& position_filter) const = 0;
 
+  // Called instead of _scan_non_reference_segment if the chunk is sorted by the scanned column (see
+  // Chunk::ordered_by()). Impls that can make use of the order (see SortedSegmentSearch) override this and return true.
+  // If false is returned, the segment is scanned using _scan_non_reference_segment.
+  virtual bool _scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
+                                    const OrderByMode order_by_mode) const;
+
+  // Returns true if no value described by the block filter (see ZoneMap) can satisfy the predicate, i.e., if the block
+  // can be skipped. A block_filter of nullptr stands for a block that only contains NULLs. Impls that cannot make use
+  // of zone maps return false, which is the default.
+  virtual bool _can_prune_block(const std::shared_ptr<const AbstractFilter>& block_filter) const;
+
+  // Returns true if the segment statistics guarantee that no value of the segment satisfies the predicate. Impls that
+  // cannot make use of segment statistics return false, which is the default.
+  virtual bool _can_prune_segment(const SegmentStatistics& segment_statistics) const;
+
+  // Uses the zone map of the scanned segment to find the blocks that might contain matches. Returns nullptr if there
+  // is no zone map or if too few blocks can be skipped. Otherwise, the positions of all rows in the remaining blocks
+  // are returned and can be used as a position filter.
+  std::shared_ptr<PosList> _get_unpruned_positions(const Chunk& chunk, const ChunkID chunk_id) const;
+
+  // Returns true if the chunk is sorted by the scanned column and the segment allows for the binary search in
+  // _scan_sorted_segment()
+  bool _can_use_sorted_search(const Chunk& chunk) const;
+
+  // Adds the chunk offsets of the contiguous range [range_begin, range_end) to `matches`. Used for the results of
+  // SortedSegmentSearch, where the range is not filtered and the offsets are thus consecutive.
+  template <typename Iterator>
+  static void _add_sorted_range_to_matches(const Iterator& range_begin, const Iterator& range_end,
+                                           const ChunkID chunk_id, PosList& matches) {
+    const auto range_size = std::distance(range_begin, range_end);
+    if (range_size <= 0) return;
+
+    const auto first_chunk_offset = range_begin->chunk_offset();
+    const auto previous_match_count = matches.size();
+    matches.resize(previous_match_count + range_size);
+
+    for (auto index = size_t{0}; index < static_cast<size_t>(range_size); ++index) {
+      matches[previous_match_count + index] = RowID{chunk_id, static_cast<ChunkOffset>(first_chunk_offset + index)};
+    }
+  }
+
   const std::shared_ptr<const Table> _in_table;
   const ColumnID _column_id;
   const PredicateCondition _predicate_condition;
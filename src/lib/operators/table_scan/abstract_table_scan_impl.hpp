@@ -10,6 +10,7 @@
 #include "storage/segment_iterables.hpp"
 #include "storage/segment_iterables/any_segment_iterator.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
 
 namespace opossum {
@@ -25,6 +26,25 @@ class AbstractTableScanImpl {
 
   virtual std::shared_ptr<PosList> scan_chunk(ChunkID chunk_id) const = 0;
 
+  /**
+   * Returns true if scan_chunk_range() can be used for the chunk, i.e., if the TableScan may split it into morsels
+   * (see MorselQueue). Impls that can only scan entire chunks return false.
+   */
+  virtual bool can_split_chunk(const ChunkID chunk_id) const { return false; }
+
+  // Same as scan_chunk(), but only considers the rows [begin_offset, end_offset) of the chunk
+  virtual std::shared_ptr<PosList> scan_chunk_range(const ChunkID chunk_id, const ChunkOffset begin_offset,
+                                                    const ChunkOffset end_offset) const {
+    Fail("Impl cannot scan parts of a chunk");
+  }
+
+  /**
+   * Returns true if the statistics of the data underlying the chunk guarantee that scan_chunk() would not find any
+   * matches. In contrast to the ChunkPruningRule, this is evaluated at runtime, i.e., after placeholders have been
+   * bound and uncorrelated subqueries have been resolved. Impls that cannot use statistics return false.
+   */
+  virtual bool can_prune_chunk(const ChunkID chunk_id) const { return false; }
+
  protected:
   /**
    * @defgroup The hot loop of the table scan
@@ -9,6 +9,9 @@
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
+#include "sorted_segment_search.hpp"
+#include "statistics/chunk_statistics/abstract_filter.hpp"
+#include "statistics/chunk_statistics/segment_statistics.hpp"
 
 #include "utils/assert.hpp"
 
@@ -46,6 +49,37 @@ void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
   }
 }
 
+bool ColumnBetweenTableScanImpl::_scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                      PosList& matches, const OrderByMode order_by_mode) const {
+  // Comparing anything with NULL results in NULL, so no rows match
+  if (variant_is_null(_left_value) || variant_is_null(_right_value)) return true;
+
+  segment_with_iterators(segment, [&](auto it, const auto end) {
+    using ColumnDataType = typename decltype(it)::ValueType;
+    const auto typed_left_value = type_cast_variant<ColumnDataType>(_left_value);
+    const auto typed_right_value = type_cast_variant<ColumnDataType>(_right_value);
+
+    const auto sorted_segment_search = SortedSegmentSearch<decltype(it), ColumnDataType>{
+        it, end, order_by_mode, typed_left_value, typed_right_value};
+    sorted_segment_search.scan_sorted_segment([&](const auto& range_begin, const auto& range_end) {
+      _add_sorted_range_to_matches(range_begin, range_end, chunk_id, matches);
+    });
+  });
+
+  return true;
+}
+
+bool ColumnBetweenTableScanImpl::_can_prune_segment(const SegmentStatistics& segment_statistics) const {
+  return segment_statistics.can_prune(PredicateCondition::Between, _left_value, _right_value);
+}
+
+bool ColumnBetweenTableScanImpl::_can_prune_block(const std::shared_ptr<const AbstractFilter>& block_filter) const {
+  // Blocks that contain only NULLs never match a comparison
+  if (!block_filter) return true;
+
+  return block_filter->can_prune(PredicateCondition::Between, _left_value, _right_value);
+}
+
 void ColumnBetweenTableScanImpl::_scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id,
                                                        PosList& matches,
                                                        const std::shared_ptr<const PosList>& position_filter) const {
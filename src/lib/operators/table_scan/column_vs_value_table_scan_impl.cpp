@@ -9,6 +9,9 @@
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
+#include "sorted_segment_search.hpp"
+#include "statistics/chunk_statistics/abstract_filter.hpp"
+#include "statistics/chunk_statistics/segment_statistics.hpp"
 
 #include "resolve_type.hpp"
 #include "type_comparison.hpp"
@@ -43,6 +46,36 @@ void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
   }
 }
 
+bool ColumnVsValueTableScanImpl::_scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                      PosList& matches, const OrderByMode order_by_mode) const {
+  // Comparing anything with NULL results in NULL, so no rows match
+  if (variant_is_null(_value)) return true;
+
+  segment_with_iterators(segment, [&](auto it, const auto end) {
+    using ColumnDataType = typename decltype(it)::ValueType;
+    const auto typed_value = type_cast_variant<ColumnDataType>(_value);
+
+    const auto sorted_segment_search =
+        SortedSegmentSearch<decltype(it), ColumnDataType>{it, end, order_by_mode, _predicate_condition, typed_value};
+    sorted_segment_search.scan_sorted_segment([&](const auto& range_begin, const auto& range_end) {
+      _add_sorted_range_to_matches(range_begin, range_end, chunk_id, matches);
+    });
+  });
+
+  return true;
+}
+
+bool ColumnVsValueTableScanImpl::_can_prune_segment(const SegmentStatistics& segment_statistics) const {
+  return segment_statistics.can_prune(_predicate_condition, _value);
+}
+
+bool ColumnVsValueTableScanImpl::_can_prune_block(const std::shared_ptr<const AbstractFilter>& block_filter) const {
+  // Blocks that contain only NULLs never match a comparison
+  if (!block_filter) return true;
+
+  return block_filter->can_prune(_predicate_condition, _value);
+}
+
 void ColumnVsValueTableScanImpl::_scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id,
                                                        PosList& matches,
                                                        const std::shared_ptr<const PosList>& position_filter) const {
@@ -32,6 +32,13 @@ class ColumnVsValueTableScanImpl : public AbstractSingleColumnTableScanImpl {
   void _scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
                                    const std::shared_ptr<const PosList>& position_filter) const override;
 
+  bool _scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
+                            const OrderByMode order_by_mode) const override;
+
+  bool _can_prune_segment(const SegmentStatistics& segment_statistics) const override;
+
+  bool _can_prune_block(const std::shared_ptr<const AbstractFilter>& block_filter) const override;
+
   void _scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
                              const std::shared_ptr<const PosList>& position_filter) const;
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, PosList& matches,
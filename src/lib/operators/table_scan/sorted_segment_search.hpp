@@ -0,0 +1,186 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <optional>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Uses binary search to find the positions in a sorted segment that satisfy a predicate
+ *
+ * Used by the table scan impls if the scanned chunk is sorted by the scanned column (see Chunk::ordered_by()).
+ * Instead of comparing every value, the qualifying rows are determined in O(log n) and are handed to the consumer as
+ * one (or, for NotEquals, two) contiguous iterator range(s).
+ *
+ * The iterators must be the unfiltered iterators of the segment, i.e., [begin, end) covers the entire segment in the
+ * order in which it is stored. NULLs are expected to be at the position defined by the OrderByMode.
+ */
+template <typename IteratorType, typename SearchValueType>
+class SortedSegmentSearch {
+ public:
+  SortedSegmentSearch(const IteratorType& begin, const IteratorType& end, const OrderByMode order_by_mode,
+                      const PredicateCondition predicate_condition, const SearchValueType& search_value)
+      : _segment_begin(begin),
+        _end_offset(std::distance(begin, end)),
+        _predicate_condition(predicate_condition),
+        _first_search_value(search_value),
+        _is_ascending(order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::AscendingNullsLast) {
+    _exclude_nulls(order_by_mode);
+  }
+
+  // Constructor for PredicateCondition::Between (inclusive on both sides)
+  SortedSegmentSearch(const IteratorType& begin, const IteratorType& end, const OrderByMode order_by_mode,
+                      const SearchValueType& left_value, const SearchValueType& right_value)
+      : _segment_begin(begin),
+        _end_offset(std::distance(begin, end)),
+        _predicate_condition(PredicateCondition::Between),
+        _first_search_value(left_value),
+        _second_search_value(right_value),
+        _is_ascending(order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::AscendingNullsLast) {
+    _exclude_nulls(order_by_mode);
+  }
+
+  /**
+   * Calls result_consumer(range_begin, range_end) for each contiguous range of matching positions. NULLs never match.
+   */
+  template <typename ResultConsumer>
+  void scan_sorted_segment(const ResultConsumer& result_consumer) const {
+    const auto& value = _first_search_value;
+
+    const auto emit_range = [&](const std::ptrdiff_t range_begin, const std::ptrdiff_t range_end) {
+      // For an empty range (e.g., BETWEEN with left_value > right_value), range_end might be located before
+      // range_begin
+      result_consumer(_iterator_at(range_begin), _iterator_at(std::max(range_begin, range_end)));
+    };
+
+    switch (_predicate_condition) {
+      case PredicateCondition::Equals:
+        emit_range(_first_not_before(value), _first_after(value));
+        return;
+
+      case PredicateCondition::NotEquals:
+        emit_range(_begin_offset, _first_not_before(value));
+        emit_range(_first_after(value), _end_offset);
+        return;
+
+      case PredicateCondition::LessThan:
+        if (_is_ascending) {
+          emit_range(_begin_offset, _first_not_before(value));
+        } else {
+          emit_range(_first_after(value), _end_offset);
+        }
+        return;
+
+      case PredicateCondition::LessThanEquals:
+        if (_is_ascending) {
+          emit_range(_begin_offset, _first_after(value));
+        } else {
+          emit_range(_first_not_before(value), _end_offset);
+        }
+        return;
+
+      case PredicateCondition::GreaterThan:
+        if (_is_ascending) {
+          emit_range(_first_after(value), _end_offset);
+        } else {
+          emit_range(_begin_offset, _first_not_before(value));
+        }
+        return;
+
+      case PredicateCondition::GreaterThanEquals:
+        if (_is_ascending) {
+          emit_range(_first_not_before(value), _end_offset);
+        } else {
+          emit_range(_begin_offset, _first_after(value));
+        }
+        return;
+
+      case PredicateCondition::Between: {
+        DebugAssert(_second_search_value, "Between requires two search values");
+        const auto& lower_value = _is_ascending ? _first_search_value : *_second_search_value;
+        const auto& upper_value = _is_ascending ? *_second_search_value : _first_search_value;
+        emit_range(_first_not_before(lower_value), _first_after(upper_value));
+        return;
+      }
+
+      default:
+        Fail("Unsupported predicate condition encountered");
+    }
+  }
+
+ protected:
+  // Not all segment iterators are assignable, which rules out std::partition_point and friends. Thus, the search works
+  // on offsets and iterators are created from _segment_begin when needed. This requires iterators with random access
+  // in O(1), see AbstractSingleColumnTableScanImpl::_can_use_sorted_search().
+  IteratorType _iterator_at(const std::ptrdiff_t offset) const {
+    auto iterator = _segment_begin;
+    iterator += offset;
+    return iterator;
+  }
+
+  // Returns the first offset in [_begin_offset, _end_offset) for which the predicate is false. The predicate has to
+  // be true for a prefix of the range and false for the remainder.
+  template <typename Predicate>
+  std::ptrdiff_t _partition_point(std::ptrdiff_t first, const std::ptrdiff_t last, const Predicate& predicate) const {
+    auto count = last - first;
+    while (count > 0) {
+      const auto step = count / 2;
+      const auto middle = first + step;
+      if (predicate(*_iterator_at(middle))) {
+        first = middle + 1;
+        count -= step + 1;
+      } else {
+        count = step;
+      }
+    }
+    return first;
+  }
+
+  // Restricts [_begin_offset, _end_offset) to the non-NULL values
+  void _exclude_nulls(const OrderByMode order_by_mode) {
+    if (order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending) {
+      // NULLs first
+      _begin_offset =
+          _partition_point(_begin_offset, _end_offset, [](const auto& position) { return position.is_null(); });
+    } else {
+      // NULLs last
+      _end_offset =
+          _partition_point(_begin_offset, _end_offset, [](const auto& position) { return !position.is_null(); });
+    }
+  }
+
+  // In the order of the segment, returns the first offset that is not located before `value`, i.e., the first
+  // position with a value >= `value` (ascending) or <= `value` (descending)
+  std::ptrdiff_t _first_not_before(const SearchValueType& value) const {
+    if (_is_ascending) {
+      return _partition_point(_begin_offset, _end_offset,
+                              [&](const auto& position) { return position.value() < value; });
+    }
+    return _partition_point(_begin_offset, _end_offset, [&](const auto& position) { return value < position.value(); });
+  }
+
+  // In the order of the segment, returns the first offset that is located after `value`, i.e., the first position
+  // with a value > `value` (ascending) or < `value` (descending)
+  std::ptrdiff_t _first_after(const SearchValueType& value) const {
+    if (_is_ascending) {
+      return _partition_point(_begin_offset, _end_offset,
+                              [&](const auto& position) { return !(value < position.value()); });
+    }
+    return _partition_point(_begin_offset, _end_offset,
+                            [&](const auto& position) { return !(position.value() < value); });
+  }
+
+  const IteratorType _segment_begin;
+  std::ptrdiff_t _begin_offset{0};
+  std::ptrdiff_t _end_offset;
+  const PredicateCondition _predicate_condition;
+  const SearchValueType _first_search_value;
+  const std::optional<SearchValueType> _second_search_value;
+  const bool _is_ascending;
+};
+
+}  // namespace opossum
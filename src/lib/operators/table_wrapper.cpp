@@ -11,6 +11,8 @@ TableWrapper::TableWrapper(const std::shared_ptr<const Table>& table)
 
 const std::string TableWrapper::name() const { return "TableWrapper"; }
 
+const std::shared_ptr<const Table>& TableWrapper::table() const { return _table; }
+
 std::shared_ptr<AbstractOperator> TableWrapper::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
@@ -18,6 +18,8 @@ class TableWrapper : public AbstractReadOnlyOperator {
 
   const std::string name() const override;
 
+  const std::shared_ptr<const Table>& table() const;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -16,6 +16,7 @@
 #include "strategy/index_scan_rule.hpp"
 #include "strategy/insert_limit_in_exists.hpp"
 #include "strategy/join_detection_rule.hpp"
+#include "strategy/join_index_rule.hpp"
 #include "strategy/join_ordering_rule.hpp"
 #include "strategy/logical_reduction_rule.hpp"
 #include "strategy/predicate_reordering_rule.hpp"
@@ -110,6 +111,9 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
 
   optimizer->add_rule(std::make_unique<IndexScanRule>());
 
+  // Runs after the JoinOrderingRule, as the decision depends on which input is probed
+  optimizer->add_rule(std::make_unique<JoinIndexRule>());
+
   return optimizer;
 }
 
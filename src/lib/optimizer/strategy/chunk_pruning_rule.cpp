@@ -10,6 +10,7 @@
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "storage/partitioning/abstract_partition_schema.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
@@ -64,6 +65,11 @@ void ChunkPruningRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) co
   for (auto& predicate : predicate_nodes) {
     auto new_exclusions = _compute_exclude_list(statistics, predicate);
     excluded_chunk_ids.insert(new_exclusions.begin(), new_exclusions.end());
+
+    if (table->partition_schema()) {
+      const auto partition_exclusions = _compute_exclude_list_by_partitions(*table, predicate);
+      excluded_chunk_ids.insert(partition_exclusions.begin(), partition_exclusions.end());
+    }
   }
 
   // wanted side effect of usings sets: excluded_chunk_ids vector is sorted
@@ -106,4 +112,33 @@ std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(
   return result;
 }
 
+std::set<ChunkID> ChunkPruningRule::_compute_exclude_list_by_partitions(
+    const Table& table, const std::shared_ptr<PredicateNode>& predicate_node) const {
+  const auto operator_predicates =
+      OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node);
+  if (!operator_predicates) return {};
+
+  const auto& partition_schema = *table.partition_schema();
+
+  std::set<ChunkID> result;
+
+  for (const auto& operator_predicate : *operator_predicates) {
+    if (operator_predicate.column_id != partition_schema.column_id() || !is_variant(operator_predicate.value)) {
+      continue;
+    }
+    const auto& value = boost::get<AllTypeVariant>(operator_predicate.value);
+    std::optional<AllTypeVariant> value2;
+    if (static_cast<bool>(operator_predicate.value2)) value2 = boost::get<AllTypeVariant>(*operator_predicate.value2);
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& partition_id = table.get_chunk(chunk_id)->partition_id();
+      if (partition_id &&
+          partition_schema.can_prune(*partition_id, operator_predicate.predicate_condition, value, value2)) {
+        result.insert(chunk_id);
+      }
+    }
+  }
+  return result;
+}
+
 }  // namespace opossum
@@ -14,11 +14,13 @@ namespace opossum {
 class AbstractLQPNode;
 class ChunkStatistics;
 class PredicateNode;
+class Table;
 
 /**
  * This rule determines which chunks can be excluded from table scans based on
  * the predicates present in the LQP and stores that information in the stored
- * table nodes.
+ * table nodes. Chunks are excluded if either their statistics or, for partitioned
+ * tables, their partition (see AbstractPartitionSchema) rule out any matches.
  */
 class ChunkPruningRule : public AbstractRule {
  public:
@@ -28,6 +30,9 @@ class ChunkPruningRule : public AbstractRule {
  protected:
   std::set<ChunkID> _compute_exclude_list(const std::vector<std::shared_ptr<ChunkStatistics>>& statistics,
                                           const std::shared_ptr<PredicateNode>& predicate_node) const;
+
+  std::set<ChunkID> _compute_exclude_list_by_partitions(const Table& table,
+                                                        const std::shared_ptr<PredicateNode>& predicate_node) const;
 };
 
 }  // namespace opossum
@@ -8,11 +8,15 @@
 
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
+#include "expression/in_expression.hpp"
+#include "expression/list_expression.hpp"
+#include "expression/value_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
@@ -32,7 +36,11 @@ std::string IndexScanRule::name() const { return "Index Scan Rule"; }
 
 void IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
   if (node->type == LQPNodeType::Predicate) {
-    const auto& child = node->left_input();
+    auto child = node->left_input();
+
+    // Predicates on top of a ValidateNode can use an index as well. The LQPTranslator moves the Validate operator
+    // above the IndexScan, see LQPTranslator::_translate_predicate_node().
+    if (child->type == LQPNodeType::Validate) child = child->left_input();
 
     if (child->type == LQPNodeType::StoredTable) {
       const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
@@ -45,6 +53,12 @@ void IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const
           predicate_node->scan_type = ScanType::IndexScan;
         }
       }
+
+      for (const auto& table_index : table->table_indexes()) {
+        if (_is_index_scan_applicable(table_index->column_id(), predicate_node)) {
+          predicate_node->scan_type = ScanType::IndexScan;
+        }
+      }
     }
   }
 
@@ -55,7 +69,25 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
                                               const std::shared_ptr<PredicateNode>& predicate_node) const {
   if (!_is_single_segment_index(index_info)) return false;
 
-  if (index_info.type != SegmentIndexType::GroupKey) return false;
+  if (index_info.type == SegmentIndexType::Hash) {
+    // Hash indexes only support equality lookups, see HashIndex
+    const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(predicate_node->predicate());
+    if (!predicate) return false;
+    if (predicate->predicate_condition != PredicateCondition::Equals &&
+        predicate->predicate_condition != PredicateCondition::In) {
+      return false;
+    }
+  } else if (index_info.type != SegmentIndexType::GroupKey) {
+    return false;
+  }
+
+  return _is_index_scan_applicable(index_info.column_ids[0], predicate_node);
+}
+
+bool IndexScanRule::_is_index_scan_applicable(const ColumnID indexed_column_id,
+                                              const std::shared_ptr<PredicateNode>& predicate_node) const {
+  const auto in_expression = std::dynamic_pointer_cast<InExpression>(predicate_node->predicate());
+  if (in_expression) return _is_index_scan_applicable(indexed_column_id, *in_expression, predicate_node);
 
   const auto operator_predicates =
       OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node);
@@ -67,9 +99,9 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
   // Currently, we do not support two-column predicates
   if (is_column_id(operator_predicate.value)) return false;
 
-  if (index_info.column_ids[0] != operator_predicate.column_id) return false;
+  if (indexed_column_id != operator_predicate.column_id) return false;
 
-  const auto row_count_table = predicate_node->left_input()->derive_statistics_from(nullptr, nullptr)->row_count();
+  const auto row_count_table = predicate_node->left_input()->get_statistics()->row_count();
   if (row_count_table < INDEX_SCAN_ROW_COUNT_THRESHOLD) return false;
 
   const auto row_count_predicate =
@@ -79,6 +111,37 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
   return selectivity <= INDEX_SCAN_SELECTIVITY_THRESHOLD;
 }
 
+bool IndexScanRule::_is_index_scan_applicable(const ColumnID indexed_column_id, const InExpression& in_expression,
+                                              const std::shared_ptr<PredicateNode>& predicate_node) const {
+  if (in_expression.is_negated()) return false;
+
+  const auto& input_node = predicate_node->left_input();
+  const auto column_id = input_node->find_column_id(*in_expression.value());
+  if (!column_id || *column_id != indexed_column_id) return false;
+
+  // Only lists of values can be looked up in the index, not subqueries
+  if (in_expression.set()->type != ExpressionType::List) return false;
+  const auto& elements = std::static_pointer_cast<ListExpression>(in_expression.set())->elements();
+
+  const auto input_statistics = input_node->get_statistics();
+  const auto row_count_table = input_statistics->row_count();
+  if (row_count_table < INDEX_SCAN_ROW_COUNT_THRESHOLD) return false;
+
+  // The elements of the list are disjoint equality predicates, so their estimated row counts add up
+  auto row_count_predicate = 0.0f;
+  for (const auto& element : elements) {
+    if (element->type != ExpressionType::Value) return false;
+    const auto& value = std::static_pointer_cast<ValueExpression>(element)->value;
+    if (variant_is_null(value)) continue;
+    row_count_predicate +=
+        input_statistics->estimate_predicate(*column_id, PredicateCondition::Equals, value).row_count();
+  }
+
+  const float selectivity = row_count_predicate / row_count_table;
+
+  return selectivity <= INDEX_SCAN_SELECTIVITY_THRESHOLD;
+}
+
 inline bool IndexScanRule::_is_single_segment_index(const IndexInfo& index_info) const {
   return index_info.column_ids.size() == 1;
 }
@@ -11,6 +11,7 @@
 namespace opossum {
 
 class AbstractLQPNode;
+class InExpression;
 class PredicateNode;
 
 /**
@@ -22,7 +23,8 @@ class PredicateNode;
  * For now this rule is only applicable to single-column indexes. Multi-column predicates (i.e. WHERE a < b) are also
  * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
  * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
- * Currently, only GroupKeyIndexes are supported.
+ * Currently, only GroupKeyIndexes, HashIndexes and table indexes (see Table::create_table_index()) are supported.
+ * HashIndexes are only used for equality predicates, i.e., `a = 5` and `a IN (1, 2, 3)`.
  */
 
 class IndexScanRule : public AbstractRule {
@@ -33,6 +35,10 @@ class IndexScanRule : public AbstractRule {
  protected:
   bool _is_index_scan_applicable(const IndexInfo& index_info,
                                  const std::shared_ptr<PredicateNode>& predicate_node) const;
+  bool _is_index_scan_applicable(const ColumnID indexed_column_id,
+                                 const std::shared_ptr<PredicateNode>& predicate_node) const;
+  bool _is_index_scan_applicable(const ColumnID indexed_column_id, const InExpression& in_expression,
+                                 const std::shared_ptr<PredicateNode>& predicate_node) const;
   inline bool _is_single_segment_index(const IndexInfo& index_info) const;
 };
 
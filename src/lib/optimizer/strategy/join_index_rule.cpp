@@ -0,0 +1,127 @@
+#include "join_index_rule.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/operator_join_predicate.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Looking up a value in an index involves a tree traversal (or a binary search) with unpredictable memory accesses,
+// whereas the hash join accesses every row in a cache-friendly way. Thus, a single comparison during a lookup is
+// assumed to be more expensive than processing a row in the default join. The value is chosen conservatively so that
+// index joins are only used if the left input is considerably smaller than the right input.
+constexpr float INDEX_JOIN_COMPARISON_COST = 4.0f;
+
+// Only if the right input has at least this many rows, the JoinType can be set to Index. For smaller tables, building
+// a hash table is cheap anyway. The value matches the threshold used by the IndexScanRule.
+constexpr float INDEX_JOIN_ROW_COUNT_THRESHOLD = 1000.0f;
+
+std::string JoinIndexRule::name() const { return "Join Index Rule"; }
+
+void JoinIndexRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (node->type == LQPNodeType::Join) {
+    const auto join_node = std::static_pointer_cast<JoinNode>(node);
+    if (_is_index_join_applicable(join_node)) {
+      join_node->join_type = JoinType::Index;
+    }
+  }
+
+  _apply_to_inputs(node);
+}
+
+bool JoinIndexRule::_is_index_join_applicable(const std::shared_ptr<JoinNode>& join_node) const {
+  const auto join_mode = join_node->join_mode;
+  if (join_mode != JoinMode::Inner && join_mode != JoinMode::Left && join_mode != JoinMode::Right &&
+      join_mode != JoinMode::Outer) {
+    return false;
+  }
+
+  const auto& right_input = join_node->right_input();
+  if (right_input->type != LQPNodeType::StoredTable) return false;
+
+  const auto operator_join_predicate =
+      OperatorJoinPredicate::from_expression(*join_node->join_predicate(), *join_node->left_input(), *right_input);
+  if (!operator_join_predicate) return false;
+
+  switch (operator_join_predicate->predicate_condition) {
+    case PredicateCondition::Equals:
+    case PredicateCondition::NotEquals:
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      break;
+    default:
+      return false;
+  }
+
+  const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(right_input);
+  const auto table = StorageManager::get().get_table(stored_table_node->table_name);
+
+  // Pruned chunks are not forwarded by the GetTable. JoinIndex would still work, but the right input would not be
+  // the indexed table anymore and the table index could not be used.
+  if (!stored_table_node->excluded_chunk_ids().empty()) return false;
+
+  const auto probe_cost = _estimate_probe_cost(*table, operator_join_predicate->column_ids.second,
+                                               operator_join_predicate->predicate_condition);
+  if (!probe_cost) return false;
+
+  const auto left_row_count = join_node->left_input()->get_statistics()->row_count();
+  const auto right_row_count = right_input->get_statistics()->row_count();
+  if (right_row_count < INDEX_JOIN_ROW_COUNT_THRESHOLD) return false;
+
+  // The output has to be written by both joins, so it is not part of the comparison
+  const auto default_join_cost = left_row_count + right_row_count;
+  const auto index_join_cost = left_row_count * *probe_cost;
+
+  return index_join_cost < default_join_cost;
+}
+
+std::optional<float> JoinIndexRule::_estimate_probe_cost(const Table& table, const ColumnID column_id,
+                                                        const PredicateCondition predicate_condition) {
+  const auto row_count = static_cast<float>(table.row_count());
+
+  // A table index is probed once
+  if (table.get_table_index(column_id)) {
+    return INDEX_JOIN_COMPARISON_COST * std::log2(std::max(row_count, 2.0f));
+  }
+
+  // Chunk indexes are probed once per chunk. JoinIndex falls back to a nested loop for chunks without an index, so
+  // the index has to be created on all chunks via Table::create_index().
+  // HashIndexes are not ordered and only support (in)equality lookups, see HashIndex.
+  const auto index_infos = table.get_indexes();
+  auto has_ordered_chunk_index = false;
+  auto has_hash_chunk_index = false;
+  for (const auto& index_info : index_infos) {
+    if (index_info.column_ids != std::vector<ColumnID>{column_id}) continue;
+    if (index_info.type == SegmentIndexType::Hash) {
+      has_hash_chunk_index = true;
+    } else {
+      has_ordered_chunk_index = true;
+    }
+  }
+  if (table.chunk_count() == 0) return std::nullopt;
+
+  const auto chunk_count = static_cast<float>(table.chunk_count());
+
+  // A hash lookup takes a single probe, independent of the chunk size
+  if (has_hash_chunk_index && predicate_condition == PredicateCondition::Equals) {
+    return chunk_count * INDEX_JOIN_COMPARISON_COST;
+  }
+
+  if (!has_ordered_chunk_index) return std::nullopt;
+  return chunk_count * INDEX_JOIN_COMPARISON_COST * std::log2(std::max(row_count / chunk_count, 2.0f));
+}
+
+}  // namespace opossum
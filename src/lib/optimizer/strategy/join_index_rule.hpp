@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "abstract_rule.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class JoinNode;
+class Table;
+
+/**
+ * This optimizer rule finds JoinNodes whose right input is a StoredTableNode with an index on the join column. These
+ * JoinNodes are candidates for being executed by a JoinIndex, which probes the index once per row of the left input
+ * instead of materializing (and, for JoinHash, building a hash table over) the entire right input. If the estimated
+ * cost of probing falls below the estimated cost of the default join, the JoinType of the JoinNode is set to Index.
+ *
+ * Both a table index (see Table::create_table_index()) and single-column chunk indexes created via
+ * Table::create_index() qualify. The costs follow CostModelLogical: the default join is estimated to touch every
+ * input row once, an index join to do a logarithmic lookup per left row and probed index.
+ *
+ * Note:
+ * As JoinIndex only probes the right input, the inputs are not swapped. Semi and anti joins are not supported by
+ * JoinIndex. Like the IndexScanRule, this rule only applies if the right input directly is a StoredTableNode.
+ */
+class JoinIndexRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+
+ protected:
+  bool _is_index_join_applicable(const std::shared_ptr<JoinNode>& join_node) const;
+
+  // Returns the estimated cost of probing an index on the given column for one row of the left input, or nullopt if
+  // there is no suitable index
+  static std::optional<float> _estimate_probe_cost(const Table& table, const ColumnID column_id,
+                                                   const PredicateCondition predicate_condition);
+};
+
+}  // namespace opossum
@@ -7,11 +7,44 @@
 
 #include "abstract_scheduler.hpp"
 #include "current_scheduler.hpp"
+#include "query_context.hpp"
 #include "task_queue.hpp"
 #include "utils/tracing/probes.hpp"
 #include "worker.hpp"
 
 #include "utils/assert.hpp"
+#include "utils/numa_memory_resource.hpp"
+#include "utils/query_cancelled_exception.hpp"
+
+namespace {
+
+// The task that is currently executed on this thread. As workers execute other tasks while waiting (see
+// Worker::_wait_for_tasks()), the previous value is restored once a task's step returns.
+thread_local opossum::AbstractTask* this_thread_task = nullptr;
+
+}  // namespace
+
+namespace opossum {
+
+namespace {
+
+// Resumes a task that yielded (see AbstractTask::_on_awaited_task_done()). Unlike a JobTask, it also runs if the query
+// was cancelled, as the yielding task is only done (and whoever waits for it is only released) once it was resumed.
+class ContinuationTask : public AbstractTask {
+ public:
+  explicit ContinuationTask(const std::function<void()>& resume, bool stealable)
+      : AbstractTask(SchedulePriority::High, stealable), _resume(resume) {}
+
+ protected:
+  void _on_execute() override { _resume(); }
+
+ private:
+  std::function<void()> _resume;
+};
+
+}  // namespace
+
+}  // namespace opossum
 
 namespace opossum {
 
@@ -49,7 +82,22 @@ const std::vector<std::shared_ptr<AbstractTask>>& AbstractTask::successors() con
 
 void AbstractTask::set_node_id(NodeID node_id) { _node_id = node_id; }
 
-bool AbstractTask::try_mark_as_enqueued() { return !_is_enqueued.exchange(true); }
+bool AbstractTask::try_mark_as_enqueued() {
+  if (_is_enqueued.exchange(true)) return false;
+
+  _enqueued_time = std::chrono::steady_clock::now();
+  return true;
+}
+
+const std::shared_ptr<QueryContext>& AbstractTask::query_context() const { return _query_context; }
+
+bool AbstractTask::allocates_intermediates() const { return _allocates_intermediates; }
+
+void AbstractTask::set_query_context(const std::shared_ptr<QueryContext>& query_context) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the query context after the Task was scheduled");
+
+  _query_context = query_context;
+}
 
 void AbstractTask::set_done_callback(const std::function<void()>& done_callback) {
   DebugAssert((!_is_scheduled), "Possible race: Don't set callback after the Task was scheduled");
@@ -58,13 +106,13 @@ void AbstractTask::set_done_callback(const std::function<void()>& done_callback)
 }
 
 void AbstractTask::schedule(NodeID preferred_node_id) {
-  _mark_as_scheduled();
+  _prepare_scheduling();
 
   if (CurrentScheduler::is_set()) {
     CurrentScheduler::get()->schedule(shared_from_this(), preferred_node_id, _priority);
   } else {
     // If the Task isn't ready, it will execute() once its dependency counter reaches 0
-    if (is_ready()) execute();
+    if (is_ready() && try_mark_as_enqueued()) execute();
   }
 }
 
@@ -80,7 +128,93 @@ void AbstractTask::execute() {
   DebugAssert(!(_started.exchange(true)), "Possible bug: Trying to execute the same task twice");
   DebugAssert(is_ready(), "Task must not be executed before its dependencies are done");
 
-  _on_execute();
+  _started_time = std::chrono::steady_clock::now();
+
+  _run_step([&]() { _on_execute(); });
+  _on_step_done();
+}
+
+std::shared_ptr<AbstractTask> AbstractTask::get_this_thread_task() {
+  return ::this_thread_task ? ::this_thread_task->shared_from_this() : nullptr;
+}
+
+void AbstractTask::_continue_after(const std::vector<std::shared_ptr<AbstractTask>>& tasks,
+                                   const std::function<void()>& continuation) {
+  DebugAssert(::this_thread_task == this, "A task can only yield from within its own execution");
+  DebugAssert(!_continuation, "A task can only yield once per step");
+
+  _continuation = continuation;
+  _pending_awaited_tasks = static_cast<uint32_t>(tasks.size() + 1);
+
+  const auto self = shared_from_this();
+  for (const auto& task : tasks) {
+    if (!task->_add_waiting_task(self)) --_pending_awaited_tasks;
+  }
+}
+
+void AbstractTask::_run_step(const std::function<void()>& step) {
+  const auto previous_task = ::this_thread_task;
+  ::this_thread_task = this;
+  try {
+    step();
+  } catch (const QueryCancelledException&) {
+    // Whoever waits for the query's tasks learns about the cancellation from the QueryContext (see
+    // CurrentScheduler::wait_for_tasks()). Do not let the exception reach the worker.
+  }
+  ::this_thread_task = previous_task;
+}
+
+void AbstractTask::_on_step_done() {
+  while (_continuation) {
+    // Release the reference held by the step. If awaited tasks are still running, the last one resumes this task.
+    if (--_pending_awaited_tasks > 0) return;
+    _run_step(std::exchange(_continuation, nullptr));
+  }
+
+  _finish();
+}
+
+void AbstractTask::_on_awaited_task_done() {
+  if (--_pending_awaited_tasks > 0) return;
+
+  const auto self = shared_from_this();
+  const auto resume = [self]() {
+    self->_run_step(std::exchange(self->_continuation, nullptr));
+    self->_on_step_done();
+  };
+
+  if (!CurrentScheduler::is_set()) {
+    resume();
+    return;
+  }
+
+  // The calling thread is still executing the awaited task that finished last. Running the continuation right here
+  // would nest it in that task's execution (and, if the continuation yields again, nest further continuations without
+  // bound). Instead, it becomes a task of its own, which belongs to this task's query and allocates like this task.
+  // It is pushed with high priority, like a successor that became ready, as the query's other tasks might wait for
+  // this task.
+  const auto continuation_task = std::make_shared<ContinuationTask>(resume, _stealable);
+  continuation_task->_query_context = _query_context;
+  continuation_task->_allocates_intermediates = _allocates_intermediates;
+  continuation_task->_mark_as_scheduled();
+  CurrentScheduler::get()->schedule(continuation_task, CURRENT_NODE_ID, SchedulePriority::High);
+}
+
+bool AbstractTask::_add_waiting_task(const std::shared_ptr<AbstractTask>& task) {
+  std::lock_guard<std::mutex> lock(_done_mutex);
+  if (_done) return false;
+  _waiting_tasks.emplace_back(task);
+  return true;
+}
+
+std::chrono::steady_clock::time_point AbstractTask::enqueued_time() const { return _enqueued_time; }
+
+std::chrono::steady_clock::time_point AbstractTask::started_time() const { return _started_time; }
+
+std::chrono::steady_clock::time_point AbstractTask::finished_time() const { return _finished_time; }
+
+void AbstractTask::_finish() {
+  _finished_time = std::chrono::steady_clock::now();
 
   for (auto& successor : _successors) {
     successor->_on_predecessor_done();
@@ -88,12 +222,29 @@ void AbstractTask::execute() {
 
   if (_done_callback) _done_callback();
 
+  auto waiting_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
   {
     std::lock_guard<std::mutex> lock(_done_mutex);
     _done = true;
+    waiting_tasks = std::move(_waiting_tasks);
   }
   _done_condition_variable.notify_all();
   DTRACE_PROBE2(HYRISE, JOB_END, _id, reinterpret_cast<uintptr_t>(this));
+
+  for (const auto& waiting_task : waiting_tasks) {
+    waiting_task->_on_awaited_task_done();
+  }
+}
+
+void AbstractTask::_prepare_scheduling() {
+  if (!_query_context) {
+    const auto scheduling_task = get_this_thread_task();
+    if (scheduling_task) _query_context = scheduling_task->_query_context;
+  }
+
+  _allocates_intermediates = ScopedDefaultMemoryResource::current() != nullptr;
+
+  _mark_as_scheduled();
 }
 
 void AbstractTask::_mark_as_scheduled() {
@@ -105,13 +256,15 @@ void AbstractTask::_mark_as_scheduled() {
 void AbstractTask::_on_predecessor_done() {
   auto new_predecessor_count = --_pending_predecessors;  // atomically decrement
   if (new_predecessor_count == 0) {
-    if (CurrentScheduler::is_set()) {
+    if (CurrentScheduler::is_set() && !_is_executed_inline) {
       auto worker = Worker::get_this_thread_worker();
       DebugAssert(static_cast<bool>(worker), "No worker");
 
-      worker->queue()->push(shared_from_this(), static_cast<uint32_t>(SchedulePriority::High));
+      worker->push(shared_from_this(), SchedulePriority::High);
     } else {
-      if (_is_scheduled) execute();
+      // Without a Scheduler and for tasks that are executed inline (see CurrentScheduler::execute_tasks_inline()), the
+      // thread that finished the last predecessor executes the task, unless the scheduling thread claimed it first
+      if (_is_scheduled && try_mark_as_enqueued()) execute();
       // Otherwise it will get execute()d once it is scheduled. It is entirely possible for Tasks to "become ready"
       // before they are being scheduled in a no-Scheduler context. Think:
       //
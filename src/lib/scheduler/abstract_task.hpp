@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -12,6 +13,7 @@
 
 namespace opossum {
 
+class QueryContext;
 class Worker;
 
 /**
@@ -23,6 +25,11 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   friend class CurrentScheduler;
 
  public:
+  /**
+   * Returns the task whose _on_execute() or continuation is currently running on this thread, or nullptr
+   */
+  static std::shared_ptr<AbstractTask> get_this_thread_task();
+
   explicit AbstractTask(SchedulePriority priority = SchedulePriority::Default, bool stealable = true);
   virtual ~AbstractTask() = default;
 
@@ -79,6 +86,22 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void set_node_id(NodeID node_id);
 
+  /**
+   * The query this task belongs to, used for fair scheduling and admission control. Might be nullptr. If no context
+   * was set when the task is scheduled, it inherits the context of the task that is currently executed on the
+   * scheduling thread.
+   */
+  const std::shared_ptr<QueryContext>& query_context() const;
+  void set_query_context(const std::shared_ptr<QueryContext>& query_context);
+
+  /**
+   * Whether the task was scheduled from within a ScopedDefaultMemoryResource, e.g., the JobTasks of an operator that
+   * allocates its intermediates on the NUMA node of its worker. The worker that executes the task then allocates the
+   * task's data on its own node as well. Tasks that create stored data (e.g., the JobTasks of an ImportCsv) allocate
+   * from the global resource.
+   */
+  bool allocates_intermediates() const;
+
   /**
    * Callback to be executed right after the Task finished.
    * Notice the execution of the callback might happen on ANY thread
@@ -107,10 +130,25 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void execute();
 
+  /**
+   * Timestamps for scheduler statistics (see SchedulerMetrics). The task is enqueued when it became ready and was put
+   * into a TaskQueue or a Worker's deque. Tasks that are executed without a scheduler are never enqueued. Default
+   * constructed (i.e., zero) until the respective event happened. Only read them once the task is done.
+   */
+  std::chrono::steady_clock::time_point enqueued_time() const;
+  std::chrono::steady_clock::time_point started_time() const;
+  std::chrono::steady_clock::time_point finished_time() const;
+
  protected:
   virtual void _on_execute() = 0;
 
  private:
+  /**
+   * Inherits the query context of the scheduling task (see query_context()) and the memory resource scope of the
+   * scheduling thread (see allocates_intermediates()) and marks the Task as scheduled
+   */
+  void _prepare_scheduling();
+
   /**
    * Atomically marks the Task as scheduled, thus making sure this happens only once
    */
@@ -127,12 +165,37 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void _join();
 
+  /**
+   * Called from within the task's execution, see CurrentScheduler::continue_after_tasks()
+   */
+  void _continue_after(const std::vector<std::shared_ptr<AbstractTask>>& tasks,
+                       const std::function<void()>& continuation);
+
+  // Runs _on_execute() or a continuation with this task registered as the task of this thread. If the step stops
+  // because the task's query was cancelled, the task is considered done.
+  void _run_step(const std::function<void()>& step);
+
+  // Called when _on_execute() or a continuation returned. Either finishes the task or, if the step yielded, runs the
+  // continuation if all awaited tasks are done already.
+  void _on_step_done();
+
+  // Called by an awaited task when it finished. The last one schedules the continuation as a task of its own.
+  void _on_awaited_task_done();
+
+  // Registers `task` to be notified when this task is done. Returns false if this task is done already.
+  bool _add_waiting_task(const std::shared_ptr<AbstractTask>& task);
+
+  // Marks the task as done and notifies successors, waiting tasks, and joining threads
+  void _finish();
+
   std::atomic<TaskID> _id{INVALID_TASK_ID};
   std::atomic<NodeID> _node_id = INVALID_NODE_ID;
   SchedulePriority _priority;
   bool _stealable;
   std::atomic_bool _done{false};
   std::function<void()> _done_callback;
+  std::shared_ptr<QueryContext> _query_context;
+  bool _allocates_intermediates{false};
 
   // For dependencies
   std::atomic_uint _pending_predecessors{0};
@@ -145,6 +208,16 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   std::atomic_bool _is_enqueued{false};
   std::atomic_bool _is_scheduled{false};
 
+  // Set for tasks that bypass the Scheduler, see CurrentScheduler::execute_tasks_inline()
+  bool _is_executed_inline{false};
+
+  // For continuations (see CurrentScheduler::continue_after_tasks()). _pending_awaited_tasks counts the unfinished
+  // awaited tasks plus one for the running step, so that the continuation cannot start before the step returned.
+  std::function<void()> _continuation;
+  std::atomic_uint _pending_awaited_tasks{0};
+  // Tasks that continue once this task is done, guarded by _done_mutex
+  std::vector<std::shared_ptr<AbstractTask>> _waiting_tasks;
+
   // For making Tasks join()-able
   std::condition_variable _done_condition_variable;
   std::mutex _done_mutex;
@@ -154,6 +227,10 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   // To make sure a task is never executed twice
   std::atomic_bool _started{false};
+
+  std::chrono::steady_clock::time_point _enqueued_time;
+  std::chrono::steady_clock::time_point _started_time;
+  std::chrono::steady_clock::time_point _finished_time;
 };
 
 }  // namespace opossum
@@ -1,9 +1,12 @@
 #include "current_scheduler.hpp"
 
+#include <algorithm>
+#include <functional>
 #include <memory>
 #include <vector>
 
 #include "abstract_scheduler.hpp"
+#include "abstract_task.hpp"
 
 namespace opossum {
 
@@ -17,4 +20,39 @@ void CurrentScheduler::set(const std::shared_ptr<AbstractScheduler>& instance) {
 
 bool CurrentScheduler::is_set() { return !!_instance; }
 
+void CurrentScheduler::_continue_after_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks,
+                                             const std::function<void()>& continuation) {
+  DebugAssert(std::all_of(tasks.begin(), tasks.end(), [](const auto& task) { return task->is_scheduled(); }),
+              "In order to continue after a task’s completion, it needs to have been scheduled first.");
+
+  const auto task = AbstractTask::get_this_thread_task();
+  if (!task) {
+    wait_for_tasks(tasks);
+    continuation();
+    return;
+  }
+
+  task->_continue_after(tasks, continuation);
+}
+
+void CurrentScheduler::_execute_tasks_inline(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  // Successors of the tasks are executed by whoever finishes their last predecessor instead of being pushed to a
+  // worker's queue (see AbstractTask::_on_predecessor_done())
+  for (const auto& task : tasks) {
+    task->_is_executed_inline = true;
+  }
+
+  for (const auto& task : tasks) {
+    task->_prepare_scheduling();
+
+    // A predecessor that yielded (see continue_after_tasks()) might finish concurrently on another thread. Once the
+    // task is marked as scheduled, that thread executes it as well if it sees the task becoming ready. Whoever claims
+    // the task first executes it.
+    if (task->is_ready() && task->try_mark_as_enqueued()) task->execute();
+  }
+
+  // Tasks that yielded (see continue_after_tasks()) might still be running
+  wait_for_tasks(tasks);
+}
+
 }  // namespace opossum
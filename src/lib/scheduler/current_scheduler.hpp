@@ -1,8 +1,10 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <vector>
 
+#include "query_context.hpp"
 #include "utils/assert.hpp"
 #include "utils/tracing/probes.hpp"
 #include "worker.hpp"
@@ -10,6 +12,7 @@
 namespace opossum {
 
 class AbstractScheduler;
+class AbstractTask;
 
 /**
  * Holds the singleton instance (or the lack of one) of the currently active Scheduler
@@ -28,17 +31,46 @@ class CurrentScheduler {
   /**
    * If there is an active Scheduler, block execution until all @param tasks have finished
    * If there is no active Scheduler, returns immediately since all @param tasks have executed when they were scheduled
+   * Throws a QueryCancelledException if the query of the calling task was cancelled.
    */
   template <typename TaskType>
   static void wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks);
 
+  /**
+   * Continuation-style alternative to wait_for_tasks(). Instead of blocking the worker, the task that is currently
+   * executed on this thread yields until all @param tasks have finished: its execution returns and, once the last of
+   * the tasks finished, @param continuation is scheduled as a task of its own (with the query context and memory
+   * resource of the yielding task). The task is only done (i.e., its successors become ready and waiting threads are
+   * released) once its last continuation returned. A continuation can call this again to wait for further tasks.
+   * This has to be the last action of the task's _on_execute() (or of the continuation). If it is called outside of a
+   * task, it waits for the tasks and executes the continuation right away.
+   */
+  template <typename TaskType>
+  static void continue_after_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks,
+                                   const std::function<void()>& continuation);
+
   template <typename TaskType>
   static void schedule_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks);
 
   template <typename TaskType>
   static void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks);
 
+  /**
+   * Executes @param tasks on the calling thread, just like they would be executed without a Scheduler, and blocks
+   * until all of them have finished. The tasks must be ordered so that each task comes after its predecessors.
+   * Meant for small units of work, for which handing the tasks to the workers (queueing them, waking up a worker, and
+   * waiting for it) takes longer than the work itself. As the tasks bypass the scheduler, they are not subject to its
+   * admission control. Tasks that are scheduled from within the tasks are handed to the Scheduler as usual.
+   */
+  template <typename TaskType>
+  static void execute_tasks_inline(const std::vector<std::shared_ptr<TaskType>>& tasks);
+
  private:
+  static void _continue_after_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks,
+                                    const std::function<void()>& continuation);
+
+  static void _execute_tasks_inline(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
   static std::shared_ptr<AbstractScheduler> _instance;
 };
 
@@ -64,6 +96,15 @@ void CurrentScheduler::wait_for_tasks(const std::vector<std::shared_ptr<TaskType
   } else {
     for (auto& task : tasks) task->_join();
   }
+
+  // If the query was cancelled, the tasks might have stopped early. Do not let the caller continue with their results.
+  QueryContext::throw_if_current_query_cancelled();
+}
+
+template <typename TaskType>
+void CurrentScheduler::continue_after_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks,
+                                            const std::function<void()>& continuation) {
+  _continue_after_tasks(std::vector<std::shared_ptr<AbstractTask>>(tasks.begin(), tasks.end()), continuation);
 }
 
 template <typename TaskType>
@@ -82,4 +123,9 @@ void CurrentScheduler::schedule_and_wait_for_tasks(const std::vector<std::shared
   wait_for_tasks(tasks);
 }
 
+template <typename TaskType>
+void CurrentScheduler::execute_tasks_inline(const std::vector<std::shared_ptr<TaskType>>& tasks) {
+  _execute_tasks_inline(std::vector<std::shared_ptr<AbstractTask>>(tasks.begin(), tasks.end()));
+}
+
 }  // namespace opossum
@@ -1,7 +1,25 @@
 #include "job_task.hpp"
 
+#include <chrono>
+
+#include "query_context.hpp"
+#include "utils/tracing/trace_recorder.hpp"
+
 namespace opossum {
 
-void JobTask::_on_execute() { _fn(); }
+void JobTask::_on_execute() {
+  // Jobs of a cancelled query are skipped
+  QueryContext::throw_if_current_query_cancelled();
+
+  auto& trace_recorder = TraceRecorder::get();
+  if (!trace_recorder.is_enabled()) {
+    _fn();
+    return;
+  }
+
+  const auto begin = std::chrono::steady_clock::now();
+  _fn();
+  trace_recorder.record(TraceEventCategory::Task, "JobTask", begin, std::chrono::steady_clock::now());
+}
 
 }  // namespace opossum
@@ -0,0 +1,107 @@
+#include "morsel_queue.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "current_scheduler.hpp"
+#include "job_task.hpp"
+#include "query_context.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "topology.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+size_t MorselQueue::worker_count() { return CurrentScheduler::is_set() ? Topology::get().num_cpus() : size_t{1}; }
+
+ChunkOffset MorselQueue::morsel_size_for(const size_t row_count) {
+  const auto workers = worker_count();
+  if (workers <= 1) return Chunk::MAX_SIZE;
+
+  const auto morsel_count = workers * MORSELS_PER_WORKER;
+  const auto morsel_size = (row_count + morsel_count - 1) / morsel_count;
+  return static_cast<ChunkOffset>(std::clamp(morsel_size, size_t{MIN_MORSEL_SIZE}, size_t{Chunk::MAX_SIZE}));
+}
+
+void MorselQueue::split_chunk(std::vector<Morsel>& morsels, const ChunkID chunk_id, const ChunkOffset chunk_size,
+                              const ChunkOffset morsel_size) {
+  DebugAssert(morsel_size > 0, "Morsels must not be empty");
+
+  if (chunk_size == 0) {
+    morsels.emplace_back(Morsel{chunk_id, ChunkOffset{0}, ChunkOffset{0}});
+    return;
+  }
+
+  // Distribute the rows evenly, so that the last morsel is not much smaller than the others
+  const auto morsel_count = (chunk_size + morsel_size - 1) / morsel_size;
+  for (auto morsel_id = ChunkOffset{0}; morsel_id < morsel_count; ++morsel_id) {
+    const auto begin_offset = static_cast<ChunkOffset>(uint64_t{chunk_size} * morsel_id / morsel_count);
+    const auto end_offset = static_cast<ChunkOffset>(uint64_t{chunk_size} * (morsel_id + 1) / morsel_count);
+    morsels.emplace_back(Morsel{chunk_id, begin_offset, end_offset});
+  }
+}
+
+std::vector<Morsel> MorselQueue::split_table(const Table& table, const ChunkOffset morsel_size) {
+  auto morsels = std::vector<Morsel>{};
+  morsels.reserve(table.chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    split_chunk(morsels, chunk_id, table.get_chunk(chunk_id)->size(), morsel_size);
+  }
+  return morsels;
+}
+
+MorselQueue::MorselQueue(std::vector<Morsel> morsels) : _morsels(std::move(morsels)) {}
+
+const std::vector<Morsel>& MorselQueue::morsels() const { return _morsels; }
+
+std::optional<size_t> MorselQueue::pop() {
+  const auto morsel_index = _next_morsel_index++;
+  if (morsel_index >= _morsels.size()) return std::nullopt;
+  return morsel_index;
+}
+
+void MorselQueue::process(const std::function<void(const size_t morsel_index)>& functor) {
+  CurrentScheduler::wait_for_tasks(schedule(functor));
+}
+
+std::vector<std::shared_ptr<AbstractTask>> MorselQueue::schedule(
+    const std::function<void(const size_t morsel_index)>& functor) {
+  // Each job should have at least MIN_MORSEL_SIZE rows to work on. Otherwise, e.g., for tables with many small chunks,
+  // scheduling the jobs would take longer than processing the morsels.
+  auto row_count = size_t{0};
+  for (const auto& morsel : _morsels) {
+    row_count += morsel.size();
+  }
+  const auto job_count =
+      std::min({worker_count(), _morsels.size(), std::max(size_t{1}, row_count / MIN_MORSEL_SIZE)});
+
+  // The jobs might outlive this call, so they hold a copy of the functor
+  const auto process_morsels = [this, functor]() {
+    while (const auto morsel_index = pop()) {
+      // Morsels are the finest unit of work that is scheduled, so this is where cancelled queries stop
+      QueryContext::throw_if_current_query_cancelled();
+      functor(*morsel_index);
+    }
+  };
+
+  // With a single job, there is no parallelism to gain from scheduling it
+  if (job_count <= 1) {
+    process_morsels();
+    return {};
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(job_count);
+
+  for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>(process_morsels));
+    jobs.back()->schedule();
+  }
+
+  return jobs;
+}
+
+}  // namespace opossum
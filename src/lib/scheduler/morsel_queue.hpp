@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+class Table;
+
+/**
+ * A range of rows within a chunk. Morsels are the unit of work that operators distribute across the workers when the
+ * chunks themselves are too coarse-grained, e.g., for tables with few, large chunks.
+ */
+struct Morsel {
+  ChunkID chunk_id;
+  ChunkOffset begin_offset;
+  ChunkOffset end_offset;
+
+  ChunkOffset size() const { return end_offset - begin_offset; }
+
+  bool operator==(const Morsel& other) const {
+    return chunk_id == other.chunk_id && begin_offset == other.begin_offset && end_offset == other.end_offset;
+  }
+};
+
+/**
+ * Hands out morsels to workers on demand ("morsel-driven parallelism").
+ *
+ * Instead of scheduling one JobTask per unit of work upfront, process() schedules one JobTask per worker. Each of them
+ * takes the next unprocessed morsel from the queue until it is drained. Thus, a worker that is done with its morsel
+ * takes over the next one, while a worker that got stuck with an expensive morsel simply takes fewer. As morsels are
+ * small compared to the whole input, the workers finish at roughly the same time, independent of the chunk sizes and
+ * of skew between the chunks.
+ *
+ * Usage example:
+ *
+ *   auto queue = MorselQueue{MorselQueue::split_table(*table, MorselQueue::morsel_size_for(table->row_count()))};
+ *   auto results = std::vector<...>(queue.morsels().size());
+ *   queue.process([&](const auto morsel_index) { results[morsel_index] = work_on(queue.morsels()[morsel_index]); });
+ */
+class MorselQueue : private Noncopyable {
+ public:
+  // Morsels are not made smaller than this, so that the per-morsel overhead stays small compared to the actual work
+  static constexpr ChunkOffset MIN_MORSEL_SIZE = 10'000;
+
+  // Number of morsels per worker that morsel_size_for() aims for. More morsels balance the load better, fewer morsels
+  // cause less overhead.
+  static constexpr size_t MORSELS_PER_WORKER = 4;
+
+  // Returns the number of workers that can process morsels in parallel, i.e., 1 if no scheduler is active
+  static size_t worker_count();
+
+  /**
+   * Returns the morsel size at which an input of @param row_count rows is split into about MORSELS_PER_WORKER morsels
+   * per worker, but at least MIN_MORSEL_SIZE. Without an active scheduler, there is no parallelism to gain and
+   * Chunk::MAX_SIZE is returned, so that chunks are not split.
+   */
+  static ChunkOffset morsel_size_for(const size_t row_count);
+
+  // Appends morsels of at most @param morsel_size rows that cover the chunk's rows [0, chunk_size). Empty chunks are
+  // represented by an empty morsel, so that every chunk is represented in the output.
+  static void split_chunk(std::vector<Morsel>& morsels, const ChunkID chunk_id, const ChunkOffset chunk_size,
+                          const ChunkOffset morsel_size);
+
+  // Splits all chunks of @param table (see split_chunk())
+  static std::vector<Morsel> split_table(const Table& table, const ChunkOffset morsel_size);
+
+  explicit MorselQueue(std::vector<Morsel> morsels);
+
+  const std::vector<Morsel>& morsels() const;
+
+  // Returns the index of the next unprocessed morsel or std::nullopt if all morsels have been handed out. Thread-safe.
+  std::optional<size_t> pop();
+
+  // Calls @param functor for the index of each morsel that has not been handed out yet, using one JobTask per worker
+  // (but not more JobTasks than morsels and at least MIN_MORSEL_SIZE rows per JobTask). If that leaves a single job,
+  // the morsels are processed on the calling thread without scheduling a JobTask. Blocks until all morsels have been
+  // processed. If the query of the calling task is cancelled, the remaining morsels are skipped and a
+  // QueryCancelledException is thrown.
+  void process(const std::function<void(const size_t morsel_index)>& functor);
+
+  // Like process(), but returns the scheduled JobTasks instead of waiting for them (e.g., to continue after them, see
+  // CurrentScheduler::continue_after_tasks()). The returned vector is empty if the morsels were processed on the
+  // calling thread. The queue has to outlive the JobTasks.
+  std::vector<std::shared_ptr<AbstractTask>> schedule(const std::function<void(const size_t morsel_index)>& functor);
+
+ protected:
+  const std::vector<Morsel> _morsels;
+  std::atomic<size_t> _next_morsel_index{0};
+};
+
+}  // namespace opossum
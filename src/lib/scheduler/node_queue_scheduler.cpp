@@ -71,6 +71,10 @@ void NodeQueueScheduler::finish() {
     for ([[maybe_unused]] auto& queue : _queues) {
       DebugAssert(queue->empty(), "NodeQueueScheduler bug: Queue wasn't empty even though all tasks finished");
     }
+    for ([[maybe_unused]] auto& worker : _workers) {
+      DebugAssert(!worker->has_local_tasks(),
+                  "NodeQueueScheduler bug: Worker's deque wasn't empty even though all tasks finished");
+    }
   }
 
   _active = false;
@@ -88,6 +92,21 @@ bool NodeQueueScheduler::active() const { return _active; }
 
 const std::vector<std::shared_ptr<TaskQueue>>& NodeQueueScheduler::queues() const { return _queues; }
 
+const std::vector<std::shared_ptr<Worker>>& NodeQueueScheduler::workers() const { return _workers; }
+
+SchedulerMetrics NodeQueueScheduler::metrics() const {
+  auto metrics = SchedulerMetrics{};
+  metrics.workers.reserve(_workers.size());
+
+  for (const auto& worker : _workers) {
+    metrics.workers.emplace_back(worker->metrics());
+    metrics.queue_wait_time.merge(worker->queue_wait_time());
+    metrics.execution_time.merge(worker->execution_time());
+  }
+
+  return metrics;
+}
+
 void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id,
                                   SchedulePriority priority) {
   /**
@@ -102,8 +121,8 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
   if (!task->is_ready()) return;
 
   // Lookup node id for current worker.
+  const auto worker = Worker::get_this_thread_worker();
   if (preferred_node_id == CURRENT_NODE_ID) {
-    auto worker = Worker::get_this_thread_worker();
     if (worker) {
       preferred_node_id = worker->queue()->node_id();
     } else {
@@ -116,6 +135,18 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
               "preferred_node_id is not within range of available nodes");
 
   auto queue = _queues[preferred_node_id];
+
+  // Tasks scheduled by a worker for its own node go to its deque, from where other workers can steal them
+  if (worker && worker->queue() == queue) {
+    worker->push(task, priority);
+    return;
+  }
+
+  // The scheduling task might wait for tasks that it schedules on another node (e.g., the probe JobTasks of a hash
+  // join). Like the tasks in a worker's deque, which the worker executes before any queued task, they are preferred
+  // over the tasks of queries that have just arrived.
+  if (worker) priority = SchedulePriority::High;
+
   queue->push(task, static_cast<uint32_t>(priority));
 }
 }  // namespace opossum
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "abstract_scheduler.hpp"
+#include "scheduler_metrics.hpp"
 
 namespace opossum {
 
@@ -33,12 +34,21 @@ namespace opossum {
  * JOBTASKS
  *
  * JobTasks can be used from anywhere to parallelize parts of their work.
- * If a task spawns jobs to be executed, the worker executing the main task waits for the jobs to complete.
- * Since the CPU to which the worker is pinned shall not be blocked, a new worker is (re-)activated temporarily.
- * The worker executing the main task is hibernated and will be re-activated once the jobs have completed.
- * There is only one active worker per CPU, which is allowed to pull new tasks from the queue.
- * Thus, while it is possible that two workers are executing a task at the same time, this is only until the non-active
- * worker finished its task. It will then be hibernated.
+ * If a task spawns jobs and calls CurrentScheduler::wait_for_tasks(), the worker executing the task does not block.
+ * Instead, it executes other tasks (most likely the jobs themselves) on its own stack until the jobs have completed.
+ * Thus, there is only one worker thread per CPU. However, the waiting task can only resume once the worker returned
+ * from whatever task it picked up in the meantime.
+ * Alternatively, a task can yield using CurrentScheduler::continue_after_tasks(). It then returns from its execution
+ * and passes a continuation that is run by whichever worker finishes the last of the jobs. The task is only done once
+ * the continuation returned.
+ *
+ *
+ * QUERIES
+ *
+ * Tasks can be assigned to a QueryContext, which JobTasks inherit from the task that spawns them. The TaskQueues serve
+ * the queries fair-share and apply the queries' concurrency limits (see QueryContext and TaskQueue). Since workers
+ * check their node's TaskQueue before their own deque, the tasks of a newly arriving query are started once a worker
+ * finishes its current task, even if a long-running query keeps all deques filled.
  *
  *
  * SCHEDULER AND TOPOLOGY
@@ -56,18 +66,16 @@ namespace opossum {
  *
  * WORK STEALING
  *
- * Currently, a simple work stealing is implemented. Work stealing is useful to avoid idle workers (and therefore
- * idle CPUs) while there are still tasks in the system that need to be processed. A worker gets idle if it can not
- * pull a ready task. This occurs in two cases:
- *  1) all tasks in the queue are not ready
- *  2) the queue is empty
- * In both cases the current worker is checking another queue for a ready task. Checking another queue means accessing
- * another node (remote node). As of the physical distance of nodes, accessing a remote nodes is ~1.6 times slower than
- * accessing a local node. [1]
- * Therefore, the current worker fetches a task from a remote queue (without removing it). Then, the current worker
- * is sleeping some milliseconds to give any local worker of the remote node the chance to pull that task. If no local
- * worker of the remote node pulled the task, the current worker is pulling the task and therefore steals it.
- * Afterwards, the current worker is checking its local queue gain.
+ * Work stealing is useful to avoid idle workers (and therefore idle CPUs) while there are still tasks in the system
+ * that need to be processed. Every worker owns a lock-free WorkStealingDeque (Chase-Lev). Tasks that are scheduled
+ * from a worker thread (e.g., JobTasks or successors of a finished task) are pushed to the deque of that worker, which
+ * pops them in LIFO order. Tasks scheduled from other threads and tasks that are not stealable go to the TaskQueue of
+ * their node instead.
+ * A worker first pops from its own deque and then checks its node's TaskQueue. Then, it steals the oldest task from
+ * the deques of the other workers, starting with the ones on its own node. As of the physical distance of nodes,
+ * accessing a remote nodes is ~1.6 times slower than accessing a local node. [1] Only if there is no local work, it
+ * steals from remote workers and, finally, from the TaskQueues of other nodes.
+ * If all of this fails, the worker briefly spins and then sleeps until a task is pushed on its node.
  *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
  */
@@ -96,14 +104,23 @@ class NodeQueueScheduler : public AbstractScheduler {
 
   const std::vector<std::shared_ptr<TaskQueue>>& queues() const override;
 
+  const std::vector<std::shared_ptr<Worker>>& workers() const override;
+
   /**
    * @param task
    * @param preferred_node_id The Task will be initially added to this node, but might get stolen by other Nodes later
-   * @param priority Determines whether tasks are inserted at the beginning or end of the queue.
+   * @param priority Determines whether tasks are inserted at the beginning or end of the queue. Ignored for tasks that
+   *                 are pushed to a worker's deque, which is processed in LIFO order.
    */
   void schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id = CURRENT_NODE_ID,
                 SchedulePriority priority = SchedulePriority::Default) override;
 
+  /**
+   * Collects the statistics of all workers since the scheduler began. Can be called while tasks are executed, in
+   * which case the values of different workers might be from slightly different points in time.
+   */
+  SchedulerMetrics metrics() const;
+
  private:
   std::atomic<TaskID> _task_counter{TaskID{0}};
   std::shared_ptr<UidAllocator> _worker_id_allocator;
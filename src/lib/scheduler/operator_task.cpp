@@ -1,6 +1,10 @@
 #include "operator_task.hpp"
 
+#include <functional>
 #include <memory>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -8,11 +12,71 @@
 
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
+#include "operators/chunk_pipeline.hpp"
+#include "operators/get_table.hpp"
+#include "operators/index_scan.hpp"
+#include "operators/table_wrapper.hpp"
 
+#include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/query_context.hpp"
 #include "scheduler/worker.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
 #include "utils/tracing/probes.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns the operators of the plan that were executed before or whose output is consumed by more than one operator.
+// Their outputs are needed, so they cannot be in the middle of the chain of a ChunkPipeline.
+std::unordered_set<std::shared_ptr<AbstractOperator>> find_pipeline_breakers(
+    const std::shared_ptr<AbstractOperator>& root) {
+  auto pipeline_breakers = std::unordered_set<std::shared_ptr<AbstractOperator>>{};
+  auto visited_operators = std::unordered_set<std::shared_ptr<AbstractOperator>>{};
+
+  std::function<void(const std::shared_ptr<AbstractOperator>&)> visit = [&](const auto& op) {
+    if (op->get_output()) pipeline_breakers.emplace(op);
+
+    for (const auto& input : {op->mutable_input_left(), op->mutable_input_right()}) {
+      if (!input) continue;
+      if (visited_operators.emplace(input).second) {
+        visit(input);
+      } else {
+        pipeline_breakers.emplace(input);
+      }
+    }
+  };
+  visit(root);
+
+  return pipeline_breakers;
+}
+
+// Number of rows that a GetTable passes on, i.e., the rows of the chunks that were not pruned. If all consumers of the
+// GetTable are IndexScans that are limited to some chunks, only the rows of these chunks are counted. Like the chunks
+// of the GetTable's output, @param index_scan_chunk_ids are numbered without the pruned chunks.
+size_t get_table_row_count(const Table& table, const GetTable& get_table,
+                           const std::optional<std::unordered_set<ChunkID>>& index_scan_chunk_ids) {
+  const auto& excluded_chunk_ids = get_table.excluded_chunk_ids();
+  const auto excluded_chunk_id_set = std::unordered_set<ChunkID>{excluded_chunk_ids.begin(), excluded_chunk_ids.end()};
+
+  auto row_count = size_t{0};
+  auto output_chunk_id = ChunkID{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    if (excluded_chunk_id_set.count(chunk_id)) continue;
+
+    if (!index_scan_chunk_ids || index_scan_chunk_ids->count(output_chunk_id)) {
+      row_count += table.get_chunk(chunk_id)->size();
+    }
+    ++output_chunk_id;
+  }
+
+  return row_count;
+}
+
+}  // namespace
+
 namespace opossum {
 OperatorTask::OperatorTask(std::shared_ptr<AbstractOperator> op, CleanupTemporaries cleanup_temporaries,
                            SchedulePriority priority, bool stealable)
@@ -26,27 +90,41 @@ const std::vector<std::shared_ptr<OperatorTask>> OperatorTask::make_tasks_from_o
     const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries) {
   std::vector<std::shared_ptr<OperatorTask>> tasks;
   std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>> task_by_op;
-  OperatorTask::_add_tasks_from_operator(op, tasks, task_by_op, cleanup_temporaries);
+  const auto pipeline_breakers = ChunkPipeline::is_enabled() ? find_pipeline_breakers(op)
+                                                             : std::unordered_set<std::shared_ptr<AbstractOperator>>{};
+  OperatorTask::_add_tasks_from_operator(op, tasks, task_by_op, cleanup_temporaries, pipeline_breakers);
   return tasks;
 }
 
 std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
     std::shared_ptr<AbstractOperator> op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
     std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
-    CleanupTemporaries cleanup_temporaries) {
+    CleanupTemporaries cleanup_temporaries,
+    const std::unordered_set<std::shared_ptr<AbstractOperator>>& pipeline_breakers) {
   const auto task_by_op_it = task_by_op.find(op);
   if (task_by_op_it != task_by_op.end()) return task_by_op_it->second;
 
   const auto task = std::make_shared<OperatorTask>(op, cleanup_temporaries);
   task_by_op.emplace(op, task);
 
-  if (auto left = op->mutable_input_left()) {
-    auto subtree_root = OperatorTask::_add_tasks_from_operator(left, tasks, task_by_op, cleanup_temporaries);
+  auto left = op->mutable_input_left();
+
+  // A chain of a single operator is not worth the copies made by the ChunkPipeline
+  if (ChunkPipeline::is_enabled() && ChunkPipeline::is_pipelineable(*op) && ChunkPipeline::is_pipelineable(*left) &&
+      !pipeline_breakers.count(left)) {
+    task->_chunk_pipeline = std::make_shared<ChunkPipeline>(op, pipeline_breakers);
+    left = task->_chunk_pipeline->source();
+  }
+
+  if (left) {
+    auto subtree_root =
+        OperatorTask::_add_tasks_from_operator(left, tasks, task_by_op, cleanup_temporaries, pipeline_breakers);
     subtree_root->set_as_predecessor_of(task);
   }
 
   if (auto right = op->mutable_input_right()) {
-    auto subtree_root = OperatorTask::_add_tasks_from_operator(right, tasks, task_by_op, cleanup_temporaries);
+    auto subtree_root =
+        OperatorTask::_add_tasks_from_operator(right, tasks, task_by_op, cleanup_temporaries, pipeline_breakers);
     subtree_root->set_as_predecessor_of(task);
   }
 
@@ -56,9 +134,100 @@ std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
   return task;
 }
 
+void OperatorTask::execute_tasks(const std::vector<std::shared_ptr<OperatorTask>>& tasks) {
+  if (!CurrentScheduler::is_set()) {
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+    return;
+  }
+
+  const auto threshold = inline_execution_threshold();
+  const auto row_count = threshold > 0 ? input_row_count(tasks) : std::nullopt;
+  if (row_count && *row_count <= threshold) {
+    CurrentScheduler::execute_tasks_inline(tasks);
+  } else {
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  }
+}
+
+std::optional<size_t> OperatorTask::input_row_count(const std::vector<std::shared_ptr<OperatorTask>>& tasks) {
+  // The chunks read by the IndexScans of the plan, by the IndexScans' inputs. Inputs that are (also) consumed by other
+  // operators or by IndexScans that scan all chunks are mapped to std::nullopt.
+  auto index_scan_chunk_ids =
+      std::unordered_map<std::shared_ptr<const AbstractOperator>, std::optional<std::unordered_set<ChunkID>>>{};
+  for (const auto& task : tasks) {
+    const auto& op = task->get_operator();
+    for (const auto& input : {op->input_left(), op->input_right()}) {
+      if (!input) continue;
+
+      const auto index_scan = op->type() == OperatorType::IndexScan ? std::static_pointer_cast<IndexScan>(op) : nullptr;
+      if (!index_scan || index_scan->included_chunk_ids().empty()) {
+        index_scan_chunk_ids[input] = std::nullopt;
+        continue;
+      }
+
+      const auto& included_chunk_ids = index_scan->included_chunk_ids();
+      const auto iter = index_scan_chunk_ids.try_emplace(input, std::unordered_set<ChunkID>{}).first;
+      if (iter->second) iter->second->insert(included_chunk_ids.begin(), included_chunk_ids.end());
+    }
+  }
+
+  auto row_count = size_t{0};
+
+  for (const auto& task : tasks) {
+    const auto& op = task->get_operator();
+    if (op->input_left() || op->input_right()) continue;
+
+    // Leaves that have been executed before, e.g., shared with another plan
+    if (const auto output = op->get_output()) {
+      row_count += output->row_count();
+      continue;
+    }
+
+    switch (op->type()) {
+      case OperatorType::GetTable: {
+        const auto& get_table = static_cast<const GetTable&>(*op);
+        // The table might be created by a preceding statement of the same pipeline
+        if (!StorageManager::get().has_table(get_table.table_name())) return std::nullopt;
+
+        const auto consumer_chunk_ids = index_scan_chunk_ids.find(op);
+        row_count += get_table_row_count(
+            *StorageManager::get().get_table(get_table.table_name()), get_table,
+            consumer_chunk_ids != index_scan_chunk_ids.end() ? consumer_chunk_ids->second : std::nullopt);
+        break;
+      }
+
+      case OperatorType::TableWrapper:
+        row_count += std::static_pointer_cast<TableWrapper>(op)->table()->row_count();
+        break;
+
+      // Operators that only modify or read metadata
+      case OperatorType::CreateTable:
+      case OperatorType::CreatePreparedPlan:
+      case OperatorType::CreateView:
+      case OperatorType::DropTable:
+      case OperatorType::DropView:
+      case OperatorType::ShowColumns:
+      case OperatorType::ShowTables:
+        break;
+
+      default:
+        return std::nullopt;
+    }
+  }
+
+  return row_count;
+}
+
+size_t OperatorTask::inline_execution_threshold() { return _inline_execution_threshold; }
+
+void OperatorTask::set_inline_execution_threshold(const size_t row_count) { _inline_execution_threshold = row_count; }
+
 const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _op; }
 
 void OperatorTask::_on_execute() {
+  // Operators of a cancelled query are skipped. The operator itself checks for cancellation while it runs.
+  QueryContext::throw_if_current_query_cancelled();
+
   auto context = _op->transaction_context();
   if (context) {
     switch (context->phase()) {
@@ -83,37 +252,46 @@ void OperatorTask::_on_execute() {
   }
 
   DTRACE_PROBE2(HYRISE, OPERATOR_TASKS, reinterpret_cast<uintptr_t>(_op.get()), reinterpret_cast<uintptr_t>(this));
-  _op->execute();
+  // Operators that wait for their JobTasks make this task yield (see AbstractOperator::execute_then()). Then, the
+  // following runs as part of the task's continuation.
+  const auto on_executed = [this, context]() {
+    /**
+     * Check whether the operator is a ReadWrite operator, and if it is, whether it failed.
+     * If it failed, trigger rollback of transaction.
+     */
+    auto rw_operator = std::dynamic_pointer_cast<AbstractReadWriteOperator>(_op);
+    if (rw_operator && rw_operator->execute_failed()) {
+      Assert(context != nullptr, "Read/Write operator cannot have been executed without a context.");
 
-  /**
-   * Check whether the operator is a ReadWrite operator, and if it is, whether it failed.
-   * If it failed, trigger rollback of transaction.
-   */
-  auto rw_operator = std::dynamic_pointer_cast<AbstractReadWriteOperator>(_op);
-  if (rw_operator && rw_operator->execute_failed()) {
-    Assert(context != nullptr, "Read/Write operator cannot have been executed without a context.");
+      context->rollback();
+    }
 
-    context->rollback();
-  }
+    // Get rid of temporary tables that are not needed anymore
+    // Because `clear_output` is only called by the successive OperatorTasks, we can be sure that no one cleans up the
+    // root (i.e., the final result)
+    if (_cleanup_temporaries == CleanupTemporaries::Yes) {
+      for (const auto& weak_predecessor : predecessors()) {
+        const auto predecessor = std::dynamic_pointer_cast<OperatorTask>(weak_predecessor.lock());
+        DebugAssert(predecessor != nullptr, "predecessor of OperatorTask is not an OperatorTask itself");
+        auto previous_operator_still_needed = false;
 
-  // Get rid of temporary tables that are not needed anymore
-  // Because `clear_output` is only called by the successive OperatorTasks, we can be sure that no one cleans up the
-  // root (i.e., the final result)
-  if (_cleanup_temporaries == CleanupTemporaries::Yes) {
-    for (const auto& weak_predecessor : predecessors()) {
-      const auto predecessor = std::dynamic_pointer_cast<OperatorTask>(weak_predecessor.lock());
-      DebugAssert(predecessor != nullptr, "predecessor of OperatorTask is not an OperatorTask itself");
-      auto previous_operator_still_needed = false;
-
-      for (const auto& successor : predecessor->successors()) {
-        if (successor.get() != this && !successor->is_done()) {
-          previous_operator_still_needed = true;
+        for (const auto& successor : predecessor->successors()) {
+          if (successor.get() != this && !successor->is_done()) {
+            previous_operator_still_needed = true;
+          }
         }
+        // If someone else still holds a shared_ptr to the table (e.g., a ReferenceSegment pointing to a materialized
+        // temporary table), it will not yet get deleted
+        if (!previous_operator_still_needed) predecessor->get_operator()->clear_output();
       }
-      // If someone else still holds a shared_ptr to the table (e.g., a ReferenceSegment pointing to a materialized
-      // temporary table), it will not yet get deleted
-      if (!previous_operator_still_needed) predecessor->get_operator()->clear_output();
     }
+  };
+
+  if (_chunk_pipeline) {
+    _chunk_pipeline->execute_into_root();
+    on_executed();
+  } else {
+    _op->execute_then(on_executed);
   }
 }
 }  // namespace opossum
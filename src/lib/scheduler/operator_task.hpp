@@ -1,7 +1,10 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <optional>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
@@ -9,6 +12,7 @@
 namespace opossum {
 
 class AbstractOperator;
+class ChunkPipeline;
 
 /**
  * Makes an AbstractOperator scheduleable
@@ -21,10 +25,33 @@ class OperatorTask : public AbstractTask {
 
   /**
    * Create tasks recursively from result operator and set task dependencies automatically.
+   * If ChunkPipeline::is_enabled(), a chain of pipelineable operators becomes a single task that executes the chain
+   * as a ChunkPipeline. Only the root of the chain is executed then, the outputs of the other operators of the chain
+   * are never set.
    */
   static const std::vector<std::shared_ptr<OperatorTask>> make_tasks_from_operator(
       const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries);
 
+  /**
+   * Executes the tasks created by make_tasks_from_operator() and blocks until they are done. If the plan reads at
+   * most inline_execution_threshold() rows from its input tables, the operators are executed on the calling thread
+   * (see CurrentScheduler::execute_tasks_inline()), as scheduling each of them would take longer than executing it.
+   * This keeps the overhead low for short, OLTP-style queries. All other plans are handed to the Scheduler.
+   */
+  static void execute_tasks(const std::vector<std::shared_ptr<OperatorTask>>& tasks);
+
+  /**
+   * Sum of the row counts of the tables read by the plan of @param tasks, i.e., of the stored tables and of the
+   * tables of TableWrappers. Chunks that are pruned by a GetTable or skipped by all IndexScans on top of it are not
+   * counted. std::nullopt if the plan has leaves of which the amount of work is unknown, e.g., ImportCsv.
+   */
+  static std::optional<size_t> input_row_count(const std::vector<std::shared_ptr<OperatorTask>>& tasks);
+
+  // Row count up to which execute_tasks() executes the plan inline. 0 disables the inline execution.
+  static constexpr size_t DEFAULT_INLINE_EXECUTION_THRESHOLD = 10'000;
+  static size_t inline_execution_threshold();
+  static void set_inline_execution_threshold(const size_t row_count);
+
   const std::shared_ptr<AbstractOperator>& get_operator() const;
 
   std::string description() const override;
@@ -35,14 +62,21 @@ class OperatorTask : public AbstractTask {
   /**
    * Create tasks recursively. Called by `make_tasks_from_operator`. Returns the root of the subtree that was added.
    * @param task_by_op  Cache to avoid creating duplicate Tasks for diamond shapes
+   * @param pipeline_breakers  Operators that must not be part of the chain of a ChunkPipeline
    */
   static std::shared_ptr<OperatorTask> _add_tasks_from_operator(
       std::shared_ptr<AbstractOperator> op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
       std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
-      CleanupTemporaries cleanup_temporaries);
+      CleanupTemporaries cleanup_temporaries,
+      const std::unordered_set<std::shared_ptr<AbstractOperator>>& pipeline_breakers);
 
  private:
   std::shared_ptr<AbstractOperator> _op;
   CleanupTemporaries _cleanup_temporaries;
+
+  // Set if _op is the root of a chain that is executed as a ChunkPipeline
+  std::shared_ptr<ChunkPipeline> _chunk_pipeline;
+
+  inline static std::atomic<size_t> _inline_execution_threshold{DEFAULT_INLINE_EXECUTION_THRESHOLD};
 };
 }  // namespace opossum
@@ -0,0 +1,87 @@
+#include "query_context.hpp"
+
+#include <chrono>
+
+#include "abstract_task.hpp"
+#include "uid_allocator.hpp"
+#include "utils/assert.hpp"
+#include "utils/query_cancelled_exception.hpp"
+
+namespace opossum {
+
+namespace {
+
+UidAllocator query_id_allocator;  // NOLINT
+
+}  // namespace
+
+QueryContext::QueryContext(const uint32_t max_concurrent_tasks)
+    : _id(query_id_allocator.allocate()), _max_concurrent_tasks(max_concurrent_tasks) {
+  Assert(max_concurrent_tasks > 0, "A query has to be allowed to run at least one task");
+}
+
+std::atomic<uint32_t> QueryContext::_default_max_concurrent_tasks{UNLIMITED_CONCURRENT_TASKS};  // NOLINT
+
+uint32_t QueryContext::default_max_concurrent_tasks() { return _default_max_concurrent_tasks; }
+
+void QueryContext::set_default_max_concurrent_tasks(const uint32_t max_concurrent_tasks) {
+  Assert(max_concurrent_tasks > 0, "A query has to be allowed to run at least one task");
+  _default_max_concurrent_tasks = max_concurrent_tasks;
+}
+
+QueryID QueryContext::id() const { return _id; }
+
+uint32_t QueryContext::max_concurrent_tasks() const { return _max_concurrent_tasks; }
+
+void QueryContext::set_max_concurrent_tasks(const uint32_t max_concurrent_tasks) {
+  Assert(max_concurrent_tasks > 0, "A query has to be allowed to run at least one task");
+  _max_concurrent_tasks = max_concurrent_tasks;
+}
+
+uint32_t QueryContext::running_task_count() const { return _running_task_count; }
+
+bool QueryContext::can_admit_task() const { return _running_task_count < _max_concurrent_tasks; }
+
+bool QueryContext::try_start_task() {
+  auto running_task_count = _running_task_count.load();
+  do {
+    if (running_task_count >= _max_concurrent_tasks) return false;
+  } while (!_running_task_count.compare_exchange_weak(running_task_count, running_task_count + 1));
+  return true;
+}
+
+void QueryContext::on_task_started() { ++_running_task_count; }
+
+void QueryContext::on_task_finished() {
+  DebugAssert(_running_task_count > 0, "More tasks finished than were started");
+  --_running_task_count;
+}
+
+void QueryContext::cancel() { _cancelled = true; }
+
+void QueryContext::set_timeout(const std::chrono::steady_clock::duration timeout) {
+  _deadline = (std::chrono::steady_clock::now() + timeout).time_since_epoch().count();
+}
+
+bool QueryContext::is_cancelled() const { return _cancelled || _has_timed_out(); }
+
+void QueryContext::throw_if_cancelled() const {
+  if (_cancelled) throw QueryCancelledException("Canceling statement due to user request");
+  if (_has_timed_out()) throw QueryCancelledException("Canceling statement due to statement timeout");
+}
+
+void QueryContext::throw_if_current_query_cancelled() {
+  const auto task = AbstractTask::get_this_thread_task();
+  if (!task) return;
+
+  const auto& query_context = task->query_context();
+  if (query_context) query_context->throw_if_cancelled();
+}
+
+bool QueryContext::_has_timed_out() const {
+  const auto deadline = _deadline.load();
+  if (deadline == std::numeric_limits<std::chrono::steady_clock::rep>::max()) return false;
+  return std::chrono::steady_clock::now().time_since_epoch().count() >= deadline;
+}
+
+}  // namespace opossum
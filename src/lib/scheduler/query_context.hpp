@@ -0,0 +1,95 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Groups the tasks that belong to one query (or, more generally, to one client request) for scheduling. Tasks
+ * inherit the QueryContext of the task that schedules them, so that JobTasks spawned by an operator are accounted to
+ * the operator's query.
+ *
+ * The NodeQueueScheduler uses it for
+ *  - fair sharing: TaskQueues serve the queries round-robin, preferring the query that currently runs the fewest
+ *    tasks, instead of in strict arrival order. Thus, a large query that has many tasks queued does not delay the
+ *    tasks of a short query that arrives later.
+ *  - admission control: while a query runs max_concurrent_tasks() tasks, none of its other tasks is started, no matter
+ *    whether a worker takes them from a TaskQueue or from a WorkStealingDeque. Workers take the slot of a task when
+ *    they take the task (see try_start_task()). A task that waits for other tasks releases its slot while it waits
+ *    (see Worker::_wait_for_tasks()), and a task that yields does not run at all until it continues. Thus, the tasks
+ *    it waits for can always be admitted. New queries are limited to default_max_concurrent_tasks(), so that a large
+ *    query cannot occupy all workers while short queries wait.
+ *  - cancellation: once cancel() was called or the timeout passed, OperatorTasks and JobTasks of the query are
+ *    skipped, and long-running operators stop at the next chunk boundary by throwing a QueryCancelledException (see
+ *    throw_if_current_query_cancelled()). Waiting for tasks of a cancelled query throws as well, as their results
+ *    are incomplete.
+ */
+class QueryContext : private Noncopyable {
+ public:
+  static constexpr uint32_t UNLIMITED_CONCURRENT_TASKS = std::numeric_limits<uint32_t>::max();
+
+  explicit QueryContext(const uint32_t max_concurrent_tasks = UNLIMITED_CONCURRENT_TASKS);
+
+  // The limit of the queries that are created by the SQLPipeline and the server. Unlimited by default.
+  static uint32_t default_max_concurrent_tasks();
+  static void set_default_max_concurrent_tasks(const uint32_t max_concurrent_tasks);
+
+  // Unique during the lifetime of the program
+  QueryID id() const;
+
+  uint32_t max_concurrent_tasks() const;
+  void set_max_concurrent_tasks(const uint32_t max_concurrent_tasks);
+
+  // Number of tasks of this query that are currently executed by a worker
+  uint32_t running_task_count() const;
+
+  // Whether the query is below its concurrency limit, i.e., whether another of its tasks may be started
+  bool can_admit_task() const;
+
+  // Takes a slot for a task if the query is below its concurrency limit. Returns false otherwise. Called by the Worker
+  // when it takes a task, on_task_finished() releases the slot.
+  bool try_start_task();
+
+  // Takes a slot regardless of the limit, e.g., for a task that continues after it waited for other tasks
+  void on_task_started();
+  void on_task_finished();
+
+  // Can be called from any thread, e.g., when a client requests to cancel the query
+  void cancel();
+
+  // Cancels the query once `timeout` has passed from now on
+  void set_timeout(const std::chrono::steady_clock::duration timeout);
+
+  // Whether cancel() was called or the timeout passed
+  bool is_cancelled() const;
+
+  // Throws a QueryCancelledException if the query is cancelled
+  void throw_if_cancelled() const;
+
+  /**
+   * Throws a QueryCancelledException if the query of the task that is executed on this thread is cancelled. Does
+   * nothing if the thread does not execute a task or if the task does not belong to a query. Cheap enough to be called
+   * once per chunk.
+   */
+  static void throw_if_current_query_cancelled();
+
+ protected:
+  bool _has_timed_out() const;
+
+  const QueryID _id;
+  std::atomic<uint32_t> _max_concurrent_tasks;
+  std::atomic<uint32_t> _running_task_count{0};
+
+  std::atomic_bool _cancelled{false};
+  // Steady clock time (in ticks since the clock's epoch) at which the query times out
+  std::atomic<std::chrono::steady_clock::rep> _deadline{std::numeric_limits<std::chrono::steady_clock::rep>::max()};
+
+  static std::atomic<uint32_t> _default_max_concurrent_tasks;
+};
+
+}  // namespace opossum
@@ -0,0 +1,121 @@
+#include "scheduler_metrics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+#include "utils/assert.hpp"
+#include "utils/format_duration.hpp"
+
+namespace opossum {
+
+LatencyHistogram::LatencyHistogram(const LatencyHistogram& other) { merge(other); }
+
+LatencyHistogram& LatencyHistogram::operator=(const LatencyHistogram& other) {
+  if (this == &other) return *this;
+
+  for (auto& bucket : _buckets) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+  _total_nanoseconds.store(0, std::memory_order_relaxed);
+
+  merge(other);
+  return *this;
+}
+
+void LatencyHistogram::add(const std::chrono::nanoseconds duration) {
+  const auto nanoseconds = static_cast<uint64_t>(std::max(duration.count(), std::chrono::nanoseconds::rep{0}));
+
+  // Index of the highest set bit, i.e., floor(log2(nanoseconds)). 0 and 1 ns both go to the first bucket.
+  const auto bucket_index = nanoseconds == 0 ? size_t{0} : static_cast<size_t>(63 - __builtin_clzll(nanoseconds));
+
+  _buckets[bucket_index].fetch_add(1, std::memory_order_relaxed);
+  _total_nanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+  for (auto bucket_index = size_t{0}; bucket_index < BUCKET_COUNT; ++bucket_index) {
+    _buckets[bucket_index].fetch_add(other._buckets[bucket_index].load(std::memory_order_relaxed),
+                                     std::memory_order_relaxed);
+  }
+  _total_nanoseconds.fetch_add(other._total_nanoseconds.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::count() const {
+  auto count = uint64_t{0};
+  for (const auto& bucket : _buckets) {
+    count += bucket.load(std::memory_order_relaxed);
+  }
+  return count;
+}
+
+std::chrono::nanoseconds LatencyHistogram::total() const {
+  return std::chrono::nanoseconds{_total_nanoseconds.load(std::memory_order_relaxed)};
+}
+
+std::chrono::nanoseconds LatencyHistogram::mean() const {
+  const auto value_count = count();
+  if (value_count == 0) return std::chrono::nanoseconds{0};
+  return total() / value_count;
+}
+
+std::chrono::nanoseconds LatencyHistogram::percentile(const double percentile) const {
+  DebugAssert(percentile >= 0.0 && percentile <= 1.0, "Percentile has to be in [0, 1]");
+
+  const auto value_count = count();
+  if (value_count == 0) return std::chrono::nanoseconds{0};
+
+  // Number of values that have to be smaller than or equal to the result, at least one
+  const auto rank = std::max(uint64_t{1}, static_cast<uint64_t>(std::ceil(percentile * value_count)));
+
+  auto seen_value_count = uint64_t{0};
+  for (auto bucket_index = size_t{0}; bucket_index < BUCKET_COUNT; ++bucket_index) {
+    seen_value_count += _buckets[bucket_index].load(std::memory_order_relaxed);
+    if (seen_value_count >= rank) {
+      if (bucket_index >= 62) return std::chrono::nanoseconds::max();
+      return std::chrono::nanoseconds{int64_t{1} << (bucket_index + 1)};
+    }
+  }
+
+  // Values were added concurrently, so that the buckets sum up to more than value_count
+  return std::chrono::nanoseconds::max();
+}
+
+uint64_t LatencyHistogram::bucket_count(const size_t bucket_index) const {
+  DebugAssert(bucket_index < BUCKET_COUNT, "Bucket index out of range");
+  return _buckets[bucket_index].load(std::memory_order_relaxed);
+}
+
+std::string LatencyHistogram::to_string() const {
+  auto stream = std::stringstream{};
+  stream << "n=" << count();
+  if (count() > 0) {
+    stream << ", mean " << format_duration(mean()) << ", p50 <" << format_duration(percentile(0.5)) << ", p90 <"
+           << format_duration(percentile(0.9)) << ", p99 <" << format_duration(percentile(0.99));
+  }
+  return stream.str();
+}
+
+double WorkerMetrics::utilization() const {
+  const auto total_time = busy_time + idle_time;
+  if (total_time.count() == 0) return 0.0;
+  return static_cast<double>(busy_time.count()) / static_cast<double>(total_time.count());
+}
+
+std::string SchedulerMetrics::to_string() const {
+  auto stream = std::stringstream{};
+  stream << "Queue wait time: " << queue_wait_time.to_string() << "\n";
+  stream << "Execution time:  " << execution_time.to_string() << "\n";
+
+  for (const auto& worker : workers) {
+    stream << "Worker " << worker.worker_id << " (node " << worker.node_id << "): " << worker.executed_task_count
+           << " tasks, " << worker.stolen_task_count << " stolen, " << worker.sleep_count << " sleeps, "
+           << static_cast<int>(std::round(worker.utilization() * 100)) << "% busy ("
+           << format_duration(worker.busy_time) << " busy, " << format_duration(worker.idle_time) << " idle)\n";
+  }
+
+  return stream.str();
+}
+
+}  // namespace opossum
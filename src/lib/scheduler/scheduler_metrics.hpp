@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Histogram of durations with power-of-two buckets, i.e., bucket i counts the durations in [2^i, 2^(i+1)) ns. Thus, the
+ * percentiles are exact up to a factor of two, which is enough to tell microseconds from milliseconds, while adding a
+ * value costs a single relaxed atomic increment. Values can be added concurrently to reading the histogram.
+ */
+class LatencyHistogram {
+ public:
+  static constexpr size_t BUCKET_COUNT = 64;
+
+  LatencyHistogram() = default;
+  LatencyHistogram(const LatencyHistogram& other);
+  LatencyHistogram& operator=(const LatencyHistogram& other);
+
+  void add(const std::chrono::nanoseconds duration);
+
+  // Adds all values of `other`
+  void merge(const LatencyHistogram& other);
+
+  uint64_t count() const;
+  std::chrono::nanoseconds total() const;
+  std::chrono::nanoseconds mean() const;
+
+  // Upper bound of the bucket that contains the given percentile (0.0 to 1.0) of the values, zero if there are none
+  std::chrono::nanoseconds percentile(const double percentile) const;
+
+  // Number of values in the bucket with the given index
+  uint64_t bucket_count(const size_t bucket_index) const;
+
+  // Count, mean, and the 50th, 90th, and 99th percentile
+  std::string to_string() const;
+
+ protected:
+  std::array<std::atomic<uint64_t>, BUCKET_COUNT> _buckets{};
+  std::atomic<uint64_t> _total_nanoseconds{0};
+};
+
+// Snapshot of a Worker's counters, see Worker::metrics()
+struct WorkerMetrics {
+  WorkerID worker_id{0};
+  NodeID node_id{0};
+
+  uint64_t executed_task_count{0};
+
+  // Tasks that were taken from the deques of other workers or from the TaskQueues of other nodes
+  uint64_t stolen_task_count{0};
+
+  // Number of times the worker ran out of work and went to sleep
+  uint64_t sleep_count{0};
+
+  // Time spent executing tasks (including waiting for tasks from within a task) and looking for work, respectively
+  std::chrono::nanoseconds busy_time{0};
+  std::chrono::nanoseconds idle_time{0};
+
+  // Share of the worker's time that was spent executing tasks
+  double utilization() const;
+};
+
+/**
+ * Runtime statistics of the NodeQueueScheduler, see NodeQueueScheduler::metrics(). Used to find out whether the latency
+ * of a workload comes from queueing, from stealing, or from the execution itself, e.g., when tuning the number of
+ * cores.
+ */
+struct SchedulerMetrics {
+  std::vector<WorkerMetrics> workers;
+
+  // Time between a task becoming ready (i.e., being put into a queue or deque) and a worker starting it
+  LatencyHistogram queue_wait_time;
+
+  // Time between a worker starting a task and the task being done. Tasks that yield (see
+  // CurrentScheduler::continue_after_tasks()) are only included if they are done when their first step returns.
+  LatencyHistogram execution_time;
+
+  std::string to_string() const;
+};
+
+}  // namespace opossum
@@ -1,20 +1,34 @@
 #include "task_queue.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 #include "abstract_task.hpp"
+#include "query_context.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
 TaskQueue::TaskQueue(NodeID node_id) : _node_id(node_id) {}
 
-bool TaskQueue::empty() const {
-  for (const auto& queue : _queues) {
-    if (!queue.empty()) return false;
-  }
-  return true;
+bool TaskQueue::empty() const { return _task_count == 0; }
+
+bool TaskQueue::has_admissible_tasks() const {
+  if (empty()) return false;
+
+  const auto is_admissible = [](const auto& query_context) {
+    return !query_context || query_context->can_admit_task();
+  };
+
+  std::lock_guard<std::mutex> lock_guard(_mutex);
+  return std::any_of(_high_priority_tasks.begin(), _high_priority_tasks.end(),
+                     [&](const auto& task) { return is_admissible(task->query_context()); }) ||
+         std::any_of(_default_priority_tasks.begin(), _default_priority_tasks.end(),
+                     [&](const auto& query_tasks) { return is_admissible(query_tasks.query_context); });
 }
 
 NodeID TaskQueue::node_id() const { return _node_id; }
@@ -26,33 +40,111 @@ void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priorit
   if (!task->try_mark_as_enqueued()) return;
 
   task->set_node_id(_node_id);
-  _queues[priority].push(task);
+  _enqueue(task, priority);
+}
 
-  new_task.notify_one();
+void TaskQueue::requeue(const std::shared_ptr<AbstractTask>& task) {
+  task->set_node_id(_node_id);
+  _enqueue(task, static_cast<uint32_t>(SchedulePriority::Default));
 }
 
-std::shared_ptr<AbstractTask> TaskQueue::pull() {
-  std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
-    if (queue.try_pop(task)) {
-      return task;
+void TaskQueue::_enqueue(const std::shared_ptr<AbstractTask>& task, uint32_t priority) {
+  {
+    std::lock_guard<std::mutex> lock_guard(_mutex);
+    if (priority == static_cast<uint32_t>(SchedulePriority::High)) {
+      _high_priority_tasks.emplace_back(task);
+    } else {
+      const auto& query_context = task->query_context();
+      auto query_tasks_iter =
+          std::find_if(_default_priority_tasks.begin(), _default_priority_tasks.end(),
+                       [&](const auto& query_tasks) { return query_tasks.query_context == query_context; });
+      if (query_tasks_iter == _default_priority_tasks.end()) {
+        // A query that was not served before goes to the front, i.e., it is preferred over queries with equally many
+        // running tasks
+        query_tasks_iter = _default_priority_tasks.insert(_default_priority_tasks.begin(), {query_context, {}});
+      }
+      query_tasks_iter->tasks.emplace_back(task);
     }
+    ++_task_count;
   }
-  return nullptr;
+
+  notify_worker();
 }
 
-std::shared_ptr<AbstractTask> TaskQueue::steal() {
-  std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
-    if (queue.try_pop(task)) {
-      if (task->is_stealable()) {
-        return task;
-      } else {
-        queue.push(task);
-      }
-    }
+void TaskQueue::notify_worker() {
+  // Orders the preceding push before the read of sleeping_worker_count, see Worker::_sleep()
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (sleeping_worker_count.load() == 0) return;
+
+  // Taking the lock ensures that a worker that has announced to sleep is actually waiting before it is notified
+  { std::lock_guard<std::mutex> lock_guard(lock); }
+  new_task.notify_one();
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::pull() { return _pop(false); }
+
+std::shared_ptr<AbstractTask> TaskQueue::steal() { return _pop(true); }
+
+std::shared_ptr<AbstractTask> TaskQueue::_pop(const bool stealable_only) {
+  if (empty()) return nullptr;
+
+  const auto is_candidate = [&](const auto& task) { return !stealable_only || task->is_stealable(); };
+
+  std::lock_guard<std::mutex> lock_guard(_mutex);
+
+  // The oldest high priority task whose query can start another task
+  for (auto high_priority_iter = _high_priority_tasks.begin(); high_priority_iter != _high_priority_tasks.end();
+       ++high_priority_iter) {
+    if (!is_candidate(*high_priority_iter)) continue;
+
+    const auto& query_context = (*high_priority_iter)->query_context();
+    if (query_context && !query_context->try_start_task()) continue;
+
+    auto task = std::move(*high_priority_iter);
+    _high_priority_tasks.erase(high_priority_iter);
+    --_task_count;
+    return task;
+  }
+
+  // Find the admissible query with the fewest running tasks. On ties, the least recently served one wins.
+  auto selected_query_iter = _default_priority_tasks.end();
+  auto selected_task_iter = std::deque<std::shared_ptr<AbstractTask>>::iterator{};
+  auto selected_running_task_count = std::numeric_limits<uint32_t>::max();
+  for (auto query_tasks_iter = _default_priority_tasks.begin(); query_tasks_iter != _default_priority_tasks.end();
+       ++query_tasks_iter) {
+    const auto& query_context = query_tasks_iter->query_context;
+    if (query_context && !query_context->can_admit_task()) continue;
+
+    const auto running_task_count = query_context ? query_context->running_task_count() : 0;
+    if (running_task_count >= selected_running_task_count) continue;
+
+    auto& tasks = query_tasks_iter->tasks;
+    const auto task_iter = std::find_if(tasks.begin(), tasks.end(), is_candidate);
+    if (task_iter == tasks.end()) continue;
+
+    selected_query_iter = query_tasks_iter;
+    selected_task_iter = task_iter;
+    selected_running_task_count = running_task_count;
+  }
+
+  if (selected_query_iter == _default_priority_tasks.end()) return nullptr;
+
+  // A worker that pulled concurrently might have taken the query's last slot. The caller will look again.
+  const auto& query_context = selected_query_iter->query_context;
+  if (query_context && !query_context->try_start_task()) return nullptr;
+
+  auto task = std::move(*selected_task_iter);
+  selected_query_iter->tasks.erase(selected_task_iter);
+  --_task_count;
+
+  // Move the served query to the back, so that queries with equally many running tasks take turns
+  if (selected_query_iter->tasks.empty()) {
+    _default_priority_tasks.erase(selected_query_iter);
+  } else {
+    std::rotate(selected_query_iter, selected_query_iter + 1, _default_priority_tasks.end());
   }
-  return nullptr;
+
+  return task;
 }
 
 }  // namespace opossum
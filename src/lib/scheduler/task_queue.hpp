@@ -1,20 +1,27 @@
 #pragma once
 
 #include <stdint.h>
-#include <tbb/concurrent_queue.h>
-#include <array>
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "types.hpp"
 
 namespace opossum {
 
 class AbstractTask;
+class QueryContext;
 
 /**
  * Holds a queue of AbstractTasks, usually one of these exists per node
+ *
+ * High priority tasks are served first and in FIFO order. Default priority tasks are grouped by their QueryContext.
+ * The queries are served fair-share: each pull takes the oldest task of the query that currently runs the fewest tasks.
+ * Queries that run equally many tasks are served round-robin. Tasks of both priorities are skipped while their query
+ * runs as many tasks as it is allowed to (see QueryContext).
  */
 class TaskQueue {
  public:
@@ -24,20 +31,39 @@ class TaskQueue {
 
   bool empty() const;
 
+  /**
+   * Whether pull() would currently return a task, i.e., whether the queue holds a task that is not held back by its
+   * query's concurrency limit
+   */
+  bool has_admissible_tasks() const;
+
   NodeID node_id() const;
 
   void push(const std::shared_ptr<AbstractTask>& task, uint32_t priority);
 
   /**
-   * Returns a Tasks that is ready to be executed and removes it from the queue
+   * Queues a task that a worker took from a WorkStealingDeque but could not start, as its query reached its concurrency
+   * limit. It is served like a default priority task, i.e., once the query is below its limit again.
+   */
+  void requeue(const std::shared_ptr<AbstractTask>& task);
+
+  /**
+   * Returns a Tasks that is ready to be executed and removes it from the queue. The task already took its slot in its
+   * query (see QueryContext::try_start_task()), which the caller has to release once the task was executed.
    */
   std::shared_ptr<AbstractTask> pull();
 
   /**
-   * Returns a Tasks that is ready to be executed and removes it from one of the stealable queues
+   * Returns a Tasks that is ready to be executed and removes it from one of the stealable queues. See pull().
    */
   std::shared_ptr<AbstractTask> steal();
 
+  /**
+   * Wakes up one of the sleeping workers of this node, if there is any. Called whenever a task is pushed to this queue
+   * or to the deque of one of the node's workers.
+   */
+  void notify_worker();
+
   /**
    * Notifies one worker as soon as a new task gets pushed into the queue
    */
@@ -48,9 +74,32 @@ class TaskQueue {
    */
   std::mutex lock;
 
+  /**
+   * Number of workers of this node that are sleeping or about to sleep on new_task. Only incremented while holding
+   * `lock`.
+   */
+  std::atomic<uint32_t> sleeping_worker_count{0};
+
  private:
+  // The queued default priority tasks of one query, in FIFO order
+  struct QueryTasks {
+    std::shared_ptr<QueryContext> query_context;
+    std::deque<std::shared_ptr<AbstractTask>> tasks;
+  };
+
+  void _enqueue(const std::shared_ptr<AbstractTask>& task, uint32_t priority);
+
+  std::shared_ptr<AbstractTask> _pop(const bool stealable_only);
+
   NodeID _node_id;
-  std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
+
+  // Allows checking for tasks without locking
+  std::atomic<size_t> _task_count{0};
+
+  mutable std::mutex _mutex;
+  std::deque<std::shared_ptr<AbstractTask>> _high_priority_tasks;
+  // Ordered by the time the queries were last served, least recently served first
+  std::vector<QueryTasks> _default_priority_tasks;
 };
 
 }  // namespace opossum
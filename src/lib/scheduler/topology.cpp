@@ -175,19 +175,20 @@ void Topology::print(std::ostream& stream, size_t indent) const {
 
 void Topology::_clear() {
   _nodes.clear();
-  _memory_resources.clear();
   _num_cpus = 0;
 }
 
 void Topology::_create_memory_resources() {
-  for (auto node_id = int{0}; node_id < static_cast<int>(_nodes.size()); ++node_id) {
+  // Resources of previous topologies are reused
+  for (auto node_id = static_cast<int>(_memory_resources.size()); node_id < static_cast<int>(_nodes.size());
+       ++node_id) {
     auto memsource_name = std::stringstream();
     memsource_name << "numa_" << std::setw(3) << std::setfill('0') << node_id;
 
     // If we have a fake NUMA topology that has more nodes than our system has available,
     // distribute the fake nodes among the physically available ones.
     auto system_node_id = _fake_numa_topology ? node_id % _number_of_hardware_nodes : node_id;
-    _memory_resources.emplace_back(NUMAMemoryResource(system_node_id, memsource_name.str()));
+    _memory_resources.emplace_back(system_node_id, memsource_name.str());
   }
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <deque>
 #include <memory>
 #include <ostream>
 #include <utility>
@@ -106,6 +107,9 @@ class Topology final : public Singleton<Topology> {
 
   static const int _number_of_hardware_nodes;
 
-  std::vector<NUMAMemoryResource> _memory_resources;
+  // Indexed by node ID. Resources are never destroyed, as intermediates (see ScopedDefaultMemoryResource) and chunks
+  // allocated from them might outlive the topology they were created for. A deque keeps them at the same address when
+  // a topology with more nodes is created.
+  std::deque<NUMAMemoryResource> _memory_resources;
 };
 }  // namespace opossum
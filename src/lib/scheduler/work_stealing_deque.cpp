@@ -0,0 +1,114 @@
+#include "work_stealing_deque.hpp"
+
+#include <memory>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+WorkStealingDeque::Buffer::Buffer(const int64_t init_capacity)
+    : capacity(init_capacity), slots(std::make_unique<std::atomic<Slot>[]>(init_capacity)) {
+  DebugAssert(capacity > 0 && (capacity & (capacity - 1)) == 0, "Capacity has to be a power of two");
+}
+
+WorkStealingDeque::Slot WorkStealingDeque::Buffer::load(const int64_t index) const {
+  return slots[index & (capacity - 1)].load(std::memory_order_acquire);
+}
+
+void WorkStealingDeque::Buffer::store(const int64_t index, const Slot slot) {
+  slots[index & (capacity - 1)].store(slot, std::memory_order_release);
+}
+
+WorkStealingDeque::WorkStealingDeque() {
+  _buffers.emplace_back(std::make_unique<Buffer>(INITIAL_CAPACITY));
+  _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque() {
+  const auto top = _top.load(std::memory_order_relaxed);
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto buffer = _buffer.load(std::memory_order_relaxed);
+  for (auto index = top; index < bottom; ++index) {
+    delete buffer->load(index);
+  }
+}
+
+void WorkStealingDeque::push(const std::shared_ptr<AbstractTask>& task) {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  auto buffer = _buffer.load(std::memory_order_relaxed);
+
+  if (bottom - top > buffer->capacity - 1) {
+    buffer = _grow(buffer, bottom, top);
+  }
+
+  // Publishes the slot (and the task it points to) to thieves that read the new _bottom
+  buffer->store(bottom, new std::shared_ptr<AbstractTask>(task));
+  _bottom.store(bottom + 1, std::memory_order_release);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::pop() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  const auto buffer = _buffer.load(std::memory_order_relaxed);
+  _bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque was empty
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto slot = buffer->load(bottom);
+  if (top == bottom) {
+    // This is the last task, race against the thieves for it
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      slot = nullptr;
+    }
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  if (!slot) return nullptr;
+
+  auto task = std::move(*slot);
+  delete slot;
+  return task;
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::steal() {
+  auto top = _top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom) return nullptr;
+
+  const auto buffer = _buffer.load(std::memory_order_acquire);
+  const auto slot = buffer->load(top);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    // Another thief or the owner was faster
+    return nullptr;
+  }
+
+  auto task = std::move(*slot);
+  delete slot;
+  return task;
+}
+
+bool WorkStealingDeque::empty() const {
+  return _top.load(std::memory_order_relaxed) >= _bottom.load(std::memory_order_relaxed);
+}
+
+WorkStealingDeque::Buffer* WorkStealingDeque::_grow(Buffer* buffer, const int64_t bottom, const int64_t top) {
+  auto new_buffer = std::make_unique<Buffer>(buffer->capacity * 2);
+  for (auto index = top; index < bottom; ++index) {
+    new_buffer->store(index, buffer->load(index));
+  }
+
+  _buffers.emplace_back(std::move(new_buffer));
+  _buffer.store(_buffers.back().get(), std::memory_order_release);
+  return _buffers.back().get();
+}
+
+}  // namespace opossum
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * A lock-free work-stealing deque after Chase and Lev [1], using the memory orderings of Lê et al. [2]. Each Worker
+ * owns one deque. Only the owner pushes and pops tasks at the bottom (LIFO), which keeps the most recently created
+ * (and thus most likely cache-hot) tasks local. Other workers steal from the top (FIFO), i.e., they take the oldest
+ * tasks, which tend to be the largest chunks of outstanding work. The owner and the thieves only contend for the last
+ * remaining task.
+ *
+ * The buffer grows when it is full. As thieves might still read from the previous buffer, old buffers are only freed
+ * when the deque is destroyed. Since the capacity doubles, this at most doubles the memory footprint.
+ *
+ * The deque stores pointers to heap-allocated std::shared_ptrs, so that the slots can be accessed atomically. The
+ * thread that successfully removes a task takes over the shared_ptr and frees the slot's allocation.
+ *
+ * [1] Chase, Lev: Dynamic Circular Work-Stealing Deque, SPAA 2005
+ * [2] Lê, Pop, Cohen, Zappa Nardelli: Correct and Efficient Work-Stealing for Weak Memory Models, PPoPP 2013
+ */
+class WorkStealingDeque : private Noncopyable {
+ public:
+  static constexpr size_t INITIAL_CAPACITY = 256;
+
+  WorkStealingDeque();
+  ~WorkStealingDeque();
+
+  // Only to be called by the owner
+  void push(const std::shared_ptr<AbstractTask>& task);
+
+  // Only to be called by the owner. Returns the most recently pushed task or nullptr if the deque is empty.
+  std::shared_ptr<AbstractTask> pop();
+
+  // Can be called by any thread. Returns the least recently pushed task or nullptr if the deque is empty or if another
+  // thread took the task first.
+  std::shared_ptr<AbstractTask> steal();
+
+  // Only an estimate if other threads modify the deque concurrently
+  bool empty() const;
+
+ protected:
+  using Slot = std::shared_ptr<AbstractTask>*;
+
+  struct Buffer {
+    explicit Buffer(const int64_t init_capacity);
+
+    Slot load(const int64_t index) const;
+    void store(const int64_t index, const Slot slot);
+
+    const int64_t capacity;
+    std::unique_ptr<std::atomic<Slot>[]> slots;
+  };
+
+  // Replaces the buffer by one of twice the capacity that holds the same elements
+  Buffer* _grow(Buffer* buffer, const int64_t bottom, const int64_t top);
+
+  std::atomic<int64_t> _top{0};
+  std::atomic<int64_t> _bottom{0};
+  std::atomic<Buffer*> _buffer;
+
+  // Owns the current and all previous buffers, only accessed by the owner
+  std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+}  // namespace opossum
@@ -9,12 +9,16 @@
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "abstract_scheduler.hpp"
 #include "abstract_task.hpp"
 #include "current_scheduler.hpp"
+#include "query_context.hpp"
 #include "task_queue.hpp"
+#include "topology.hpp"
+#include "utils/numa_memory_resource.hpp"
 
 namespace {
 
@@ -23,17 +27,62 @@ namespace {
  * Uses a weak_ptr, because otherwise the ref-count of it would not reach zero within the main() scope of the program.
  */
 thread_local std::weak_ptr<opossum::Worker> this_thread_worker;
+
+// Takes a slot for the task in its QueryContext, see Worker::_next_task()
+bool try_start(const std::shared_ptr<opossum::AbstractTask>& task) {
+  const auto& query_context = task->query_context();
+  return !query_context || query_context->try_start_task();
+}
+
+// Releases a slot of the query. Queued tasks of the query might have become admissible.
+void finish_task(const std::shared_ptr<opossum::QueryContext>& query_context) {
+  query_context->on_task_finished();
+
+  if (query_context->max_concurrent_tasks() != opossum::QueryContext::UNLIMITED_CONCURRENT_TASKS) {
+    for (const auto& queue : opossum::CurrentScheduler::get()->queues()) {
+      queue->notify_worker();
+    }
+  }
+}
+
+/**
+ * Releases the slot that the task took in its QueryContext when the worker took the task. As the destructor also runs
+ * if the task throws, the running task count of the query cannot stay raised and block the admission of its other
+ * tasks forever.
+ */
+class ScopedRunningTask : private opossum::Noncopyable {
+ public:
+  explicit ScopedRunningTask(const std::shared_ptr<opossum::QueryContext>& query_context)
+      : _query_context(query_context) {}
+
+  ~ScopedRunningTask() {
+    if (_query_context) finish_task(_query_context);
+  }
+
+ private:
+  // Copy of the context, as the task might release it once it is done
+  const std::shared_ptr<opossum::QueryContext> _query_context;
+};
+
 }  // namespace
 
-// The sleep time was determined experimentally
+// Since workers are woken up when new tasks arrive on their node, the sleep time is only a backstop, e.g., for tasks
+// that could be stolen from other nodes
 static constexpr auto WORKER_SLEEP_TIME = std::chrono::microseconds(300);
 
+// Number of times an idle worker yields and looks for work again before going to sleep. Avoids the wake-up latency
+// for short gaps between tasks.
+static constexpr auto WORKER_IDLE_SPIN_COUNT = 64u;
+
 namespace opossum {
 
 std::shared_ptr<Worker> Worker::get_this_thread_worker() { return ::this_thread_worker.lock(); }
 
 Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id)
-    : _queue(queue), _id(id), _cpu_id(cpu_id) {}
+    : _queue(queue),
+      _id(id),
+      _cpu_id(cpu_id),
+      _memory_resource(Topology::get().get_memory_resource(static_cast<int>(queue->node_id()))) {}
 
 WorkerID Worker::id() const { return _id; }
 
@@ -41,6 +90,8 @@ std::shared_ptr<TaskQueue> Worker::queue() const { return _queue; }
 
 CpuID Worker::cpu_id() const { return _cpu_id; }
 
+boost::container::pmr::memory_resource* Worker::memory_resource() const { return _memory_resource; }
+
 void Worker::operator()() {
   Assert(this_thread_worker.expired(), "Thread already has a worker");
 
@@ -54,42 +105,154 @@ void Worker::operator()() {
 }
 
 void Worker::_work() {
-  auto task = _queue->pull();
+  auto task = _next_task();
 
   if (!task) {
-    // Simple work stealing without explicitly transferring data between nodes.
-    auto work_stealing_successful = false;
-    for (auto& queue : CurrentScheduler::get()->queues()) {
-      if (queue == _queue) {
-        continue;
-      }
+    const auto idle_begin = std::chrono::steady_clock::now();
 
-      task = queue->steal();
-      if (task) {
-        task->set_node_id(_queue->node_id());
-        work_stealing_successful = true;
-        break;
-      }
+    if (_idle_rounds < WORKER_IDLE_SPIN_COUNT) {
+      ++_idle_rounds;
+      std::this_thread::yield();
+    } else {
+      _sleep();
+      _sleep_count.fetch_add(1, std::memory_order_relaxed);
     }
 
-    // If there is no ready task neither in our queue nor in any other, worker waits for a new task to be pushed to the
-    // own queue or returns after timer exceeded (whatever occurs first).
-    if (!work_stealing_successful) {
-      {
-        std::unique_lock<std::mutex> unique_lock(_queue->lock);
-        _queue->new_task.wait_for(unique_lock, WORKER_SLEEP_TIME);
-      }
-      return;
+    // While a task waits for other tasks, the worker is busy with that task
+    if (_execution_depth == 0) {
+      const auto idle_time = std::chrono::steady_clock::now() - idle_begin;
+      _idle_nanoseconds.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(idle_time).count(),
+                                  std::memory_order_relaxed);
     }
+    return;
   }
 
+  _idle_rounds = 0;
+
+  _execute(task);
+}
+
+void Worker::_execute(const std::shared_ptr<AbstractTask>& task) {
+  const auto running_task = ScopedRunningTask{task->query_context()};
+  const auto previous_running_query_context = std::exchange(_running_query_context, task->query_context());
+
+  // Allocate the intermediates of the task (e.g., the PosLists of an operator's JobTasks) on the worker's node. Their
+  // consumers are likely to run on the same node, as tasks that become ready are pushed to the deque of the worker
+  // that finished their last predecessor. Operators set up the scope themselves (see AbstractOperator::execute()), so
+  // that stored data, e.g., the chunks of an Insert, is not bound to the node of the worker.
+  const auto memory_resource_scope =
+      ScopedDefaultMemoryResource{task->allocates_intermediates() ? _memory_resource : nullptr};
+
+  const auto execute_begin = std::chrono::steady_clock::now();
+  ++_execution_depth;
   task->execute();
+  --_execution_depth;
+  _running_query_context = previous_running_query_context;
+
+  if (_execution_depth == 0) {
+    const auto busy_time = std::chrono::steady_clock::now() - execute_begin;
+    _busy_nanoseconds.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(busy_time).count(),
+                                std::memory_order_relaxed);
+  }
+
+  _queue_wait_time.add(task->started_time() - task->enqueued_time());
+
+  // Tasks that yielded are finished by whoever completes the last awaited task
+  if (task->is_done()) _execution_time.add(task->finished_time() - task->started_time());
 
   // This is part of the Scheduler shutdown system. Count the number of tasks a Worker executed to allow the
   // Scheduler to determine whether all tasks finished
   _num_finished_tasks++;
 }
 
+std::shared_ptr<AbstractTask> Worker::_next_task() {
+  // A task is only returned if its query can start another task (see QueryContext). The slot it takes is released
+  // once the task was executed (see ScopedRunningTask). The TaskQueues take the slots themselves.
+
+  // Most recently pushed own tasks first, as their data is most likely still cached. This also holds for a worker that
+  // waits for tasks (see _wait_for_tasks()): the tasks it waits for are usually in its own deque, and finishing them
+  // lets the waiting task continue instead of nesting unrelated tasks (e.g., of newly arriving queries) on its stack.
+  while (auto task = _deque.pop()) {
+    if (try_start(task)) return task;
+
+    // The query of the task runs as many tasks as it is allowed to. The node's queue holds the task back until the
+    // query is below its limit again.
+    _queue->requeue(task);
+  }
+
+  // The node's queue holds the tasks that were scheduled from outside of the workers, e.g., the operators of newly
+  // arriving queries, and the tasks that must not be stolen by other nodes
+  auto task = _queue->pull();
+  if (task) return task;
+
+  // Steal from the other workers, starting with the ones on the same node. Start at the next worker ID so that not all
+  // thieves go for the same victim.
+  const auto& workers = CurrentScheduler::get()->workers();
+  const auto worker_count = workers.size();
+  for (const auto remote : {false, true}) {
+    for (auto offset = size_t{1}; offset < worker_count; ++offset) {
+      const auto& victim = workers[(_id + offset) % worker_count];
+      if ((victim->queue() != _queue) != remote) continue;
+
+      task = victim->steal();
+      if (task && !try_start(task)) {
+        victim->queue()->requeue(task);
+        continue;
+      }
+      if (task) {
+        if (remote) task->set_node_id(_queue->node_id());
+        _stolen_task_count.fetch_add(1, std::memory_order_relaxed);
+        return task;
+      }
+    }
+  }
+
+  // Simple work stealing without explicitly transferring data between nodes.
+  for (auto& queue : CurrentScheduler::get()->queues()) {
+    if (queue == _queue) {
+      continue;
+    }
+
+    task = queue->steal();
+    if (task) {
+      task->set_node_id(_queue->node_id());
+      _stolen_task_count.fetch_add(1, std::memory_order_relaxed);
+      return task;
+    }
+  }
+
+  return nullptr;
+}
+
+bool Worker::_node_has_tasks() const {
+  if (_queue->has_admissible_tasks()) return true;
+
+  for (const auto& worker : CurrentScheduler::get()->workers()) {
+    if (worker->queue() == _queue && worker->has_local_tasks()) return true;
+  }
+  return false;
+}
+
+void Worker::_sleep() {
+  // Announce that this worker is about to sleep before checking for work a last time. A task pushed concurrently is
+  // either seen by the check or the pusher sees the sleeping worker and notifies it (see TaskQueue::notify_worker()).
+  std::unique_lock<std::mutex> unique_lock(_queue->lock);
+  _queue->sleeping_worker_count.fetch_add(1);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if (!_node_has_tasks()) {
+    _queue->new_task.wait_for(unique_lock, WORKER_SLEEP_TIME);
+  }
+
+  _queue->sleeping_worker_count.fetch_sub(1);
+}
+
+std::shared_ptr<QueryContext> Worker::_release_running_task_slot() {
+  const auto query_context = _running_query_context;
+  if (query_context) finish_task(query_context);
+  return query_context;
+}
+
 void Worker::start() { _thread = std::thread(&Worker::operator(), this); }
 
 void Worker::join() {
@@ -99,6 +262,48 @@ void Worker::join() {
 
 uint64_t Worker::num_finished_tasks() const { return _num_finished_tasks; }
 
+WorkerMetrics Worker::metrics() const {
+  auto metrics = WorkerMetrics{};
+  metrics.worker_id = _id;
+  metrics.node_id = _queue->node_id();
+  metrics.executed_task_count = _num_finished_tasks;
+  metrics.stolen_task_count = _stolen_task_count.load(std::memory_order_relaxed);
+  metrics.sleep_count = _sleep_count.load(std::memory_order_relaxed);
+  metrics.busy_time = std::chrono::nanoseconds{_busy_nanoseconds.load(std::memory_order_relaxed)};
+  metrics.idle_time = std::chrono::nanoseconds{_idle_nanoseconds.load(std::memory_order_relaxed)};
+  return metrics;
+}
+
+const LatencyHistogram& Worker::queue_wait_time() const { return _queue_wait_time; }
+
+const LatencyHistogram& Worker::execution_time() const { return _execution_time; }
+
+void Worker::push(const std::shared_ptr<AbstractTask>& task, SchedulePriority priority) {
+  DebugAssert(this_thread_worker.lock().get() == this, "Only the worker itself may push to its deque");
+
+  // Tasks that are bound to this node must not end up in a deque that workers of other nodes steal from. The node's
+  // queue also keeps them available to the other workers of this node. As the running task might wait for them, they
+  // are queued with high priority, i.e., before the tasks of queries that have just arrived.
+  if (!task->is_stealable()) {
+    _queue->push(task, static_cast<uint32_t>(SchedulePriority::High));
+    return;
+  }
+
+  // Someone else was first to enqueue this task? No problem!
+  if (!task->try_mark_as_enqueued()) return;
+
+  // The deque does not distinguish priorities. As it is processed in LIFO order, the task pushed last (e.g., the
+  // successor of a task that just finished) is executed next anyway.
+  task->set_node_id(_queue->node_id());
+  _deque.push(task);
+
+  _queue->notify_worker();
+}
+
+std::shared_ptr<AbstractTask> Worker::steal() { return _deque.steal(); }
+
+bool Worker::has_local_tasks() const { return !_deque.empty(); }
+
 void Worker::_set_affinity() {
 #if HYRISE_NUMA_SUPPORT
   cpu_set_t cpuset;
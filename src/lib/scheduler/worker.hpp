@@ -5,16 +5,32 @@
 #include <thread>
 #include <vector>
 
+#include "query_context.hpp"
+#include "scheduler_metrics.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "work_stealing_deque.hpp"
+
+namespace boost {
+namespace container {
+namespace pmr {
+class memory_resource;
+}
+}  // namespace container
+}  // namespace boost
 
 namespace opossum {
 
+class AbstractTask;
 class TaskQueue;
 
 /**
  * To be executed on a separate Thread, fetches and executes tasks until the queue is empty AND the shutdown flag is set
  * Ideally there should be one Worker actively doing work per CPU, but multiple might be active occasionally
+ *
+ * Tasks scheduled from a worker thread are pushed to the worker's own WorkStealingDeque. The worker executes them in
+ * LIFO order, while idle workers steal the oldest ones, preferring victims on their own node. The node's TaskQueue
+ * receives the tasks that are scheduled from other threads or that must not be stolen by other nodes.
  */
 class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable {
   friend class CurrentScheduler;
@@ -31,11 +47,41 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   std::shared_ptr<TaskQueue> queue() const;
   CpuID cpu_id() const;
 
+  // The NUMAMemoryResource of the worker's node, see ScopedDefaultMemoryResource
+  boost::container::pmr::memory_resource* memory_resource() const;
+
   void start();
   void join();
 
   uint64_t num_finished_tasks() const;
 
+  /**
+   * Snapshot of the worker's counters. Can be called from any thread while the worker is running.
+   */
+  WorkerMetrics metrics() const;
+
+  /**
+   * Queue wait times and execution times of the tasks that this worker executed (see SchedulerMetrics)
+   */
+  const LatencyHistogram& queue_wait_time() const;
+  const LatencyHistogram& execution_time() const;
+
+  /**
+   * Pushes a task to the worker's deque (or to the node's TaskQueue if it is not stealable). Has to be called from the
+   * worker's thread.
+   */
+  void push(const std::shared_ptr<AbstractTask>& task, SchedulePriority priority);
+
+  /**
+   * Called by other workers, takes the oldest task from the worker's deque. Returns nullptr if there is none.
+   */
+  std::shared_ptr<AbstractTask> steal();
+
+  /**
+   * Only an estimate if the worker is still running
+   */
+  bool has_local_tasks() const;
+
   void operator=(const Worker&) = delete;
   void operator=(Worker&&) = delete;
 
@@ -43,6 +89,21 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   void operator()();
   void _work();
 
+  // Returns the next task to execute, or nullptr if there is no work this worker could take
+  std::shared_ptr<AbstractTask> _next_task();
+
+  // Whether there is admissible work in the node's TaskQueue or work in the deque of any worker on this node
+  bool _node_has_tasks() const;
+
+  // Blocks until new work arrives on this node or until a timeout passes
+  void _sleep();
+
+  // Executes the task and updates the statistics
+  void _execute(const std::shared_ptr<AbstractTask>& task);
+
+  // Releases the slot of the task that this worker currently executes in its query. Returns the query, if any.
+  std::shared_ptr<QueryContext> _release_running_task_slot();
+
   template <typename TaskType>
   void _wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks) {
     auto tasks_completed = [&tasks]() {
@@ -55,9 +116,16 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
       return true;
     };
 
+    // The waiting task does not run while it waits. It releases its slot in its query, so that the tasks it waits for
+    // are admitted even if the query reached its concurrency limit (see QueryContext). Once they are done, the task
+    // takes the slot again, even if that exceeds the limit for a moment.
+    const auto query_context = _release_running_task_slot();
+
     while (!tasks_completed()) {
       _work();
     }
+
+    if (query_context) query_context->on_task_started();
   }
 
  private:
@@ -71,7 +139,30 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   WorkerID _id;
   CpuID _cpu_id;
   std::thread _thread;
+
+  // The NUMAMemoryResource of the worker's node, which the tasks and operators allocate their intermediates from
+  boost::container::pmr::memory_resource* _memory_resource;
+
   std::atomic<uint64_t> _num_finished_tasks{0};
+  WorkStealingDeque _deque;
+
+  // Number of consecutive calls to _work() that did not find a task
+  uint32_t _idle_rounds{0};
+
+  // Number of tasks that are currently executed by this worker. Tasks that wait for other tasks call _work() from
+  // within their execution, which must not be counted twice.
+  uint32_t _execution_depth{0};
+
+  // The query of the task that this worker currently executes (the innermost one, if tasks wait for other tasks)
+  std::shared_ptr<QueryContext> _running_query_context;
+
+  // Statistics, written by the worker's thread only and read by metrics()
+  std::atomic<uint64_t> _stolen_task_count{0};
+  std::atomic<uint64_t> _sleep_count{0};
+  std::atomic<uint64_t> _busy_nanoseconds{0};
+  std::atomic<uint64_t> _idle_nanoseconds{0};
+  LatencyHistogram _queue_wait_time;
+  LatencyHistogram _execution_time;
 };
 
 }  // namespace opossum
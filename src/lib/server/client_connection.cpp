@@ -29,6 +29,13 @@ boost::future<void> ClientConnection::receive_startup_packet_body(uint32_t size)
   };
 }
 
+boost::future<CancelRequestPacket> ClientConnection::receive_cancel_request_body() {
+  // The process ID and the secret key
+  constexpr uint32_t CANCEL_REQUEST_BODY_LENGTH = 8u;
+
+  return _receive_bytes_async(CANCEL_REQUEST_BODY_LENGTH) >> then >> PostgresWireHandler::handle_cancel_request_packet;
+}
+
 boost::future<RequestHeader> ClientConnection::receive_packet_header() {
   constexpr uint32_t HEADER_LENGTH = 5u;
 
@@ -80,6 +87,14 @@ boost::future<void> ClientConnection::send_auth() {
   return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
 }
 
+boost::future<void> ClientConnection::send_backend_key_data(uint32_t process_id, uint32_t secret_key) {
+  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::BackendKeyData);
+  PostgresWireHandler::write_value(*output_packet, htonl(process_id));
+  PostgresWireHandler::write_value(*output_packet, htonl(secret_key));
+
+  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+}
+
 boost::future<void> ClientConnection::send_parameter_status(const std::string& key, const std::string& value) {
   auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::ParameterStatus);
   PostgresWireHandler::write_string(*output_packet, key);
@@ -13,6 +13,7 @@ struct OutputPacket;
 struct RequestHeader;
 struct ParsePacket;
 struct BindPacket;
+struct CancelRequestPacket;
 enum class NetworkMessageType : unsigned char;
 
 struct ColumnDescription {
@@ -30,6 +31,7 @@ class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
 
   boost::future<uint32_t> receive_startup_packet_header();
   boost::future<void> receive_startup_packet_body(uint32_t size);
+  boost::future<CancelRequestPacket> receive_cancel_request_body();
 
   boost::future<RequestHeader> receive_packet_header();
   boost::future<std::string> receive_simple_query_packet_body(uint32_t size);
@@ -42,6 +44,7 @@ class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
 
   boost::future<void> send_ssl_denied();
   boost::future<void> send_auth();
+  boost::future<void> send_backend_key_data(uint32_t process_id, uint32_t secret_key);
   boost::future<void> send_parameter_status(const std::string& key, const std::string& value);
   boost::future<void> send_ready_for_query();
   boost::future<void> send_error(const std::string& message);
@@ -26,6 +26,9 @@ uint32_t PostgresWireHandler::handle_startup_package(const InputPacket& packet)
   // Special SSL version number that we catch to deny SSL support
   if (version == 80877103) {
     return 0;
+  } else if (version == 80877102) {
+    // Special version number of CancelRequests, which are followed by the process ID and the secret key
+    return CANCEL_REQUEST;
   } else {
     // Subtract read bytes from total length
     return length - (2 * sizeof(uint32_t));
@@ -37,6 +40,16 @@ void PostgresWireHandler::handle_startup_package_content(const InputPacket& pack
   read_values<char>(packet, packet.data.size());
 }
 
+CancelRequestPacket PostgresWireHandler::handle_cancel_request_packet(const InputPacket& packet) {
+  const auto network_process_id = read_value<uint32_t>(packet);
+  const auto network_secret_key = read_value<uint32_t>(packet);
+
+  const auto process_id = ntohl(network_process_id);
+  const auto secret_key = ntohl(network_secret_key);
+
+  return CancelRequestPacket{process_id, secret_key};
+}
+
 RequestHeader PostgresWireHandler::handle_header(const InputPacket& packet) {
   auto tag = read_value<NetworkMessageType>(packet);
 
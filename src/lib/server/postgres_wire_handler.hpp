@@ -2,6 +2,7 @@
 
 #include <arpa/inet.h>
 #include <algorithm>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -45,13 +46,24 @@ struct BindPacket {
   std::vector<AllTypeVariant> params;
 };
 
+// Sent by clients on a new connection to cancel the query that is running in another session. The session is
+// identified by the process ID and the secret key that it sent to its client in the BackendKeyData message.
+struct CancelRequestPacket {
+  uint32_t process_id;
+  uint32_t secret_key;
+};
+
 class PostgresWireHandler {
  public:
+  // Returned by handle_startup_package() instead of the packet length if the client sent a CancelRequest
+  static constexpr uint32_t CANCEL_REQUEST = std::numeric_limits<uint32_t>::max();
+
   static std::shared_ptr<OutputPacket> new_output_packet(NetworkMessageType type);
   static void write_output_packet_size(OutputPacket& packet);
 
   static uint32_t handle_startup_package(const InputPacket& packet);
   static void handle_startup_package_content(const InputPacket& packet);
+  static CancelRequestPacket handle_cancel_request_packet(const InputPacket& packet);
 
   static RequestHeader handle_header(const InputPacket& packet);
 
@@ -12,6 +12,7 @@
 #include "SQLParserResult.h"
 
 #include "concurrency/transaction_manager.hpp"
+#include "scheduler/query_context.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "sql/sql_translator.hpp"
 #include "storage/storage_manager.hpp"
@@ -34,11 +35,28 @@ namespace opossum {
 
 using opossum::then_operator::then;
 
+template <typename TConnection, typename TTaskRunner>
+ServerSessionImpl<TConnection, TTaskRunner>::~ServerSessionImpl() {
+  std::lock_guard<std::mutex> lock(_sessions_mutex);
+  _sessions.erase(_process_id);
+}
+
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::start() {
   // We need a copy of this session to outlive the async operation
   auto self = this->shared_from_this();
-  return (_perform_session_startup() >> then >> [this, self]() { return _handle_client_requests(); })
+
+  {
+    std::lock_guard<std::mutex> lock(_sessions_mutex);
+    _sessions.emplace(_process_id, self);
+  }
+
+  return (_perform_session_startup() >> then >>
+          [this, self](bool handle_requests) {
+            // The connection of a CancelRequest is closed right away, without a response
+            if (!handle_requests) return boost::make_ready_future();
+            return _handle_client_requests();
+          })
       // Use .then instead of >> then >> to be able to handle exceptions
       .then(boost::launch::sync, [self](boost::future<void> f) {
         try {
@@ -50,22 +68,56 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::start() {
 }
 
 template <typename TConnection, typename TTaskRunner>
-boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_perform_session_startup() {
+boost::future<bool> ServerSessionImpl<TConnection, TTaskRunner>::_perform_session_startup() {
   return _connection->receive_startup_packet_header() >> then >> [=](uint32_t startup_packet_length) {
     if (startup_packet_length == 0) {
       // This is a request for SSL, deny it and wait for the next startup packet
       return _connection->send_ssl_denied() >> then >> [=]() { return _perform_session_startup(); };
     }
 
+    if (startup_packet_length == PostgresWireHandler::CANCEL_REQUEST) {
+      return _connection->receive_cancel_request_body() >> then >> [=](CancelRequestPacket packet) {
+        _handle_cancel_request(packet);
+        return false;
+      };
+    }
+
     return _connection->receive_startup_packet_body(startup_packet_length) >> then >>
            [=]() { return _connection->send_auth(); } >> then >>
+           [=]() { return _connection->send_backend_key_data(_process_id, _secret_key); } >> then >>
            // We need to provide some random server version > 9 here, because some clients require it.
            [=]() { return _connection->send_parameter_status("server_version", "9.5"); } >> then >>
            [=]() { return _connection->send_parameter_status("client_encoding", "UTF8"); } >> then >>
-           [=]() { return _connection->send_ready_for_query(); };
+           [=]() { return _connection->send_ready_for_query(); } >> then >> []() { return true; };
   };
 }
 
+template <typename TConnection, typename TTaskRunner>
+void ServerSessionImpl<TConnection, TTaskRunner>::_handle_cancel_request(const CancelRequestPacket& packet) {
+  auto session = std::shared_ptr<ServerSessionImpl>{};
+  {
+    std::lock_guard<std::mutex> lock(_sessions_mutex);
+    const auto session_it = _sessions.find(packet.process_id);
+    if (session_it != _sessions.end()) session = session_it->second.lock();
+  }
+
+  // Like PostgreSQL, silently ignore requests for unknown sessions or with a wrong key
+  if (!session || session->_secret_key != packet.secret_key) return;
+
+  std::lock_guard<std::mutex> lock(session->_query_context_mutex);
+  if (session->_query_context) session->_query_context->cancel();
+}
+
+template <typename TConnection, typename TTaskRunner>
+std::shared_ptr<QueryContext> ServerSessionImpl<TConnection, TTaskRunner>::_new_query_context() {
+  auto query_context = std::make_shared<QueryContext>(QueryContext::default_max_concurrent_tasks());
+  if (_statement_timeout) query_context->set_timeout(*_statement_timeout);
+
+  std::lock_guard<std::mutex> lock(_query_context_mutex);
+  _query_context = query_context;
+  return query_context;
+}
+
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_requests() {
   auto process_command = [=](RequestHeader request) {
@@ -175,8 +227,13 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_simple_qu
 
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_query_command(const std::string& sql) {
+  // The statements of the pipeline inherit the QueryContext from the task that creates them
+  const auto query_context = _new_query_context();
+
   auto create_sql_pipeline = [=]() {
-    return _task_runner->dispatch_server_task(std::make_shared<CreatePipelineTask>(sql, true));
+    auto task = std::make_shared<CreatePipelineTask>(sql, true);
+    task->set_query_context(query_context);
+    return _task_runner->dispatch_server_task(task);
   };
 
   auto load_table_file = [=](std::string& file_name, std::string& table_name) {
@@ -187,6 +244,7 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_
 
   auto execute_sql_pipeline = [=](std::shared_ptr<SQLPipeline> sql_pipeline) {
     auto task = std::make_shared<ExecuteServerQueryTask>(sql_pipeline);
+    task->set_query_context(query_context);
     return _task_runner->dispatch_server_task(task) >> then >> [=]() { return sql_pipeline; };
   };
 
@@ -291,8 +349,11 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute
 
   physical_plan->set_transaction_context_recursively(_transaction);
 
-  return _task_runner->dispatch_server_task(std::make_shared<ExecuteServerPreparedStatementTask>(physical_plan)) >>
-         then >>
+  // The OperatorTasks inherit the QueryContext when they are scheduled by the ExecuteServerPreparedStatementTask
+  auto task = std::make_shared<ExecuteServerPreparedStatementTask>(physical_plan);
+  task->set_query_context(_new_query_context());
+
+  return _task_runner->dispatch_server_task(task) >> then >>
          [=](std::shared_ptr<const Table> result_table) {
            // The behavior is a little different compared to SimpleQueryCommand: Send a 'No Data' response
            if (!result_table) {
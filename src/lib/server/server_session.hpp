@@ -4,7 +4,14 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/thread/future.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <unordered_map>
 
 #include "client_connection.hpp"
 #include "postgres_wire_handler.hpp"
@@ -14,16 +21,32 @@
 
 namespace opossum {
 
+class QueryContext;
+
 template <typename TConnection, typename TTaskRunner>
 class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<TConnection, TTaskRunner>> {
  public:
-  explicit ServerSessionImpl(std::shared_ptr<TConnection> connection, std::shared_ptr<TTaskRunner> task_runner)
-      : _connection(connection), _task_runner(task_runner) {}
+  // @param statement_timeout  if set, requests that take longer are cancelled
+  explicit ServerSessionImpl(std::shared_ptr<TConnection> connection, std::shared_ptr<TTaskRunner> task_runner,
+                             const std::optional<std::chrono::milliseconds>& statement_timeout = std::nullopt)
+      : _connection(connection),
+        _task_runner(task_runner),
+        _process_id(_next_process_id++),
+        _secret_key(std::random_device{}()),
+        _statement_timeout(statement_timeout) {}
+
+  ~ServerSessionImpl();
 
   boost::future<void> start();
 
  protected:
-  boost::future<void> _perform_session_startup();
+  // Returns false if the client only sent a CancelRequest, i.e., if no requests follow
+  boost::future<bool> _perform_session_startup();
+  void _handle_cancel_request(const CancelRequestPacket& packet);
+
+  // Creates the QueryContext for the next request, which can be cancelled by CancelRequests and times out after the
+  // statement timeout
+  std::shared_ptr<QueryContext> _new_query_context();
 
   boost::future<void> _handle_client_requests();
   boost::future<void> _handle_simple_query_command(const std::string& sql);
@@ -42,6 +65,21 @@ class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<
   std::shared_ptr<TransactionContext> _transaction;
 
   std::unordered_map<std::string, std::shared_ptr<AbstractOperator>> _portals;
+
+  // Identify the session in CancelRequests, the client receives them in the BackendKeyData message
+  const uint32_t _process_id;
+  const uint32_t _secret_key;
+
+  const std::optional<std::chrono::milliseconds> _statement_timeout;
+
+  // Context of the current request. Guarded by a mutex, as CancelRequests are handled by other sessions.
+  std::mutex _query_context_mutex;
+  std::shared_ptr<QueryContext> _query_context;
+
+  // Started sessions by process ID, so that CancelRequests can find the session they refer to
+  inline static std::mutex _sessions_mutex;
+  inline static std::unordered_map<uint32_t, std::weak_ptr<ServerSessionImpl>> _sessions;
+  inline static std::atomic<uint32_t> _next_process_id{1};
 };
 
 // The corresponding template instantiation takes place in the .cpp
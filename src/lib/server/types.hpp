@@ -20,6 +20,7 @@ enum class NetworkMessageType : unsigned char {
   ReadyForQuery = 'Z',
   RowDescription = 'T',
   DataRow = 'D',
+  BackendKeyData = 'K',
 
   // Errors
   HumanReadableError = 'M',
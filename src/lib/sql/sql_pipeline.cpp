@@ -15,7 +15,8 @@ namespace opossum {
 
 SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context,
                          const UseMvcc use_mvcc, const std::shared_ptr<LQPTranslator>& lqp_translator,
-                         const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries)
+                         const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries,
+                         const std::shared_ptr<QueryContext>& query_context)
     : _transaction_context(transaction_context), _optimizer(optimizer) {
   DebugAssert(!_transaction_context || _transaction_context->phase() == TransactionPhase::Active,
               "The transaction context cannot have been committed already.");
@@ -73,9 +74,9 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
     const auto statement_string = boost::trim_copy(sql.substr(sql_string_offset, statement_string_length));
     sql_string_offset += statement_string_length;
 
-    auto pipeline_statement =
-        std::make_shared<SQLPipelineStatement>(statement_string, std::move(parsed_statement), use_mvcc,
-                                               transaction_context, lqp_translator, optimizer, cleanup_temporaries);
+    auto pipeline_statement = std::make_shared<SQLPipelineStatement>(statement_string, std::move(parsed_statement),
+                                                                     use_mvcc, transaction_context, lqp_translator,
+                                                                     optimizer, cleanup_temporaries, query_context);
     _sql_pipeline_statements.push_back(std::move(pipeline_statement));
   }
 
@@ -28,6 +28,11 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_transaction_context(
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_query_context(const std::shared_ptr<QueryContext>& query_context) {
+  _query_context = query_context;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() { return with_mvcc(UseMvcc::No); }
 
 SQLPipelineBuilder& SQLPipelineBuilder::dont_cleanup_temporaries() {
@@ -39,7 +44,8 @@ SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   DTRACE_PROBE1(HYRISE, CREATE_PIPELINE, reinterpret_cast<uintptr_t>(this));
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
-  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _cleanup_temporaries);
+  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _cleanup_temporaries,
+                              _query_context);
   DTRACE_PROBE3(HYRISE, PIPELINE_CREATION_DONE, pipeline.get_sql_strings().size(), _sql.c_str(),
                 reinterpret_cast<uintptr_t>(this));
   return pipeline;
@@ -50,8 +56,8 @@ SQLPipelineStatement SQLPipelineBuilder::create_pipeline_statement(
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
 
-  return {_sql,      std::move(parsed_sql), _use_mvcc, _transaction_context, lqp_translator,
-          optimizer, _cleanup_temporaries};
+  return {_sql,      std::move(parsed_sql), _use_mvcc,           _transaction_context, lqp_translator,
+          optimizer, _cleanup_temporaries,   _query_context};
 }
 
 }  // namespace opossum
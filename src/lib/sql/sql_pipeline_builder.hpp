@@ -24,10 +24,16 @@ class Optimizer;
  *          with_transaction_context(tc).
  *          create_pipeline();
  *
+ * To be able to cancel the execution from another thread or to set a timeout, pass a QueryContext:
+ *      auto query_context = std::make_shared<QueryContext>();
+ *      query_context->set_timeout(std::chrono::seconds{10});
+ *      SQLPipelineBuilder{query}.with_query_context(query_context).create_pipeline().get_result_table();
+ *
  * Defaults:
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer()) is used.
  *  - No JIT operators
+ *  - The QueryContext of the calling task is used, if any. Otherwise, each statement gets a new QueryContext.
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -41,6 +47,7 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_lqp_translator(const std::shared_ptr<LQPTranslator>& lqp_translator);
   SQLPipelineBuilder& with_optimizer(const std::shared_ptr<Optimizer>& optimizer);
   SQLPipelineBuilder& with_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
+  SQLPipelineBuilder& with_query_context(const std::shared_ptr<QueryContext>& query_context);
 
   /**
    * Short for with_mvcc(UseMvcc::No)
@@ -65,6 +72,7 @@ class SQLPipelineBuilder final {
 
   UseMvcc _use_mvcc{UseMvcc::Yes};
   std::shared_ptr<TransactionContext> _transaction_context;
+  std::shared_ptr<QueryContext> _query_context;
   std::shared_ptr<LQPTranslator> _lqp_translator;
   std::shared_ptr<Optimizer> _optimizer;
   CleanupTemporaries _cleanup_temporaries{true};
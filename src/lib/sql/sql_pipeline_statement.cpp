@@ -3,6 +3,7 @@
 #include <boost/algorithm/string.hpp>
 
 #include <iomanip>
+#include <memory>
 #include <utility>
 
 #include "SQLParser.h"
@@ -11,11 +12,14 @@
 #include "expression/value_expression.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "optimizer/optimizer.hpp"
-#include "scheduler/current_scheduler.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/query_context.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
 #include "utils/assert.hpp"
+#include "utils/query_cancelled_exception.hpp"
 #include "utils/tracing/probes.hpp"
 
 namespace opossum {
@@ -25,11 +29,13 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
                                            const std::shared_ptr<TransactionContext>& transaction_context,
                                            const std::shared_ptr<LQPTranslator>& lqp_translator,
                                            const std::shared_ptr<Optimizer>& optimizer,
-                                           const CleanupTemporaries cleanup_temporaries)
+                                           const CleanupTemporaries cleanup_temporaries,
+                                           const std::shared_ptr<QueryContext>& query_context)
     : _sql_string(sql),
       _use_mvcc(use_mvcc),
       _auto_commit(_use_mvcc == UseMvcc::Yes && !transaction_context),
       _transaction_context(transaction_context),
+      _query_context(query_context ? query_context : _current_or_new_query_context()),
       _lqp_translator(lqp_translator),
       _optimizer(optimizer),
       _parsed_sql_statement(std::move(parsed_sql)),
@@ -178,6 +184,13 @@ const std::vector<std::shared_ptr<OperatorTask>>& SQLPipelineStatement::get_task
   }
 
   _tasks = OperatorTask::make_tasks_from_operator(get_physical_plan(), _cleanup_temporaries);
+
+  // Lets the scheduler share the workers fairly between concurrently executed statements and skips the remaining
+  // tasks once the query is cancelled
+  for (const auto& task : _tasks) {
+    task->set_query_context(_query_context);
+  }
+
   return _tasks;
 }
 
@@ -192,7 +205,16 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
 
   DTRACE_PROBE3(HYRISE, TASKS_PER_STATEMENT, reinterpret_cast<uintptr_t>(&tasks), _sql_string.c_str(),
                 reinterpret_cast<uintptr_t>(this));
-  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  try {
+    OperatorTask::execute_tasks(tasks);
+
+    // When called from outside of a task, waiting does not check for cancellation
+    _query_context->throw_if_cancelled();
+  } catch (const QueryCancelledException&) {
+    // The tasks that were already executed might have modified data
+    if (_auto_commit) _transaction_context->rollback();
+    throw;
+  }
 
   if (_auto_commit) {
     _transaction_context->commit();
@@ -217,4 +239,15 @@ const std::shared_ptr<TransactionContext>& SQLPipelineStatement::transaction_con
 }
 
 const std::shared_ptr<SQLPipelineStatementMetrics>& SQLPipelineStatement::metrics() const { return _metrics; }
+
+const std::shared_ptr<QueryContext>& SQLPipelineStatement::query_context() const { return _query_context; }
+
+std::shared_ptr<QueryContext> SQLPipelineStatement::_current_or_new_query_context() {
+  // Statements that are executed from within a task (e.g., by the server) belong to the query of that task
+  const auto this_thread_task = AbstractTask::get_this_thread_task();
+  if (this_thread_task && this_thread_task->query_context()) return this_thread_task->query_context();
+
+  return std::make_shared<QueryContext>(QueryContext::default_max_concurrent_tasks());
+}
+
 }  // namespace opossum
@@ -11,6 +11,8 @@
 
 namespace opossum {
 
+class QueryContext;
+
 // Holds relevant information about the execution of an SQLPipelineStatement.
 struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds sql_translate_time_nanos{};
@@ -40,7 +42,8 @@ class SQLPipelineStatement : public Noncopyable {
   SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                        const UseMvcc use_mvcc, const std::shared_ptr<TransactionContext>& transaction_context,
                        const std::shared_ptr<LQPTranslator>& lqp_translator,
-                       const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries);
+                       const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries,
+                       const std::shared_ptr<QueryContext>& query_context = nullptr);
 
   // Returns the raw SQL string.
   const std::string& get_sql_string();
@@ -63,6 +66,8 @@ class SQLPipelineStatement : public Noncopyable {
   const std::vector<std::shared_ptr<OperatorTask>>& get_tasks();
 
   // Executes all tasks, waits for them to finish, and returns the resulting table.
+  // Throws a QueryCancelledException if the query was cancelled or timed out. In that case, an auto-committing
+  // statement rolls back its transaction.
   const std::shared_ptr<const Table>& get_result_table();
 
   // Returns the TransactionContext that was either passed to or created by the SQLPipelineStatement.
@@ -71,7 +76,12 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::shared_ptr<SQLPipelineStatementMetrics>& metrics() const;
 
+  // Returns the QueryContext that is used to schedule, cancel, and time out the tasks of this statement
+  const std::shared_ptr<QueryContext>& query_context() const;
+
  private:
+  static std::shared_ptr<QueryContext> _current_or_new_query_context();
+
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
 
@@ -81,6 +91,8 @@ class SQLPipelineStatement : public Noncopyable {
   // Might be the Statement's own transaction context, or the one shared by all Statements in a Pipeline
   std::shared_ptr<TransactionContext> _transaction_context;
 
+  const std::shared_ptr<QueryContext> _query_context;
+
   const std::shared_ptr<LQPTranslator> _lqp_translator;
   const std::shared_ptr<Optimizer> _optimizer;
 
@@ -1,5 +1,8 @@
 #include "chunk_statistics.hpp"
 
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -12,4 +15,23 @@ bool ChunkStatistics::can_prune(const ColumnID column_id, const PredicateConditi
   return _statistics[column_id]->can_prune(predicate_condition, variant_value, variant_value2);
 }
 
+std::shared_ptr<SegmentStatistics> get_segment_statistics_for_pruning(const Table& table, const ChunkID chunk_id,
+                                                                      const ColumnID column_id) {
+  auto chunk = table.get_chunk(chunk_id);
+  auto statistics_column_id = column_id;
+
+  if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(column_id))) {
+    const auto& pos_list = *reference_segment->pos_list();
+    if (!pos_list.references_single_chunk() || pos_list.empty()) return nullptr;
+
+    chunk = reference_segment->referenced_table()->get_chunk(pos_list.common_chunk_id());
+    statistics_column_id = reference_segment->referenced_column_id();
+  }
+
+  const auto& chunk_statistics = chunk->statistics();
+  if (!chunk_statistics) return nullptr;
+
+  return chunk_statistics->statistics()[statistics_column_id];
+}
+
 }  // namespace opossum
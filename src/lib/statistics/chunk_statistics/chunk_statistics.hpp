@@ -10,6 +10,8 @@
 
 namespace opossum {
 
+class Table;
+
 /**
  * Container class that holds objects with statistical information about a chunk.
  */
@@ -29,4 +31,13 @@ class ChunkStatistics final : public std::enable_shared_from_this<ChunkStatistic
  protected:
   std::vector<std::shared_ptr<SegmentStatistics>> _statistics;
 };
+
+/**
+ * Returns the statistics that describe the values of the segment at (chunk_id, column_id) in `table`, or nullptr if
+ * there are none. For reference segments, the statistics of the referenced segment are returned if only a single chunk
+ * is referenced. These describe a superset of the referenced values and thus remain valid for pruning.
+ */
+std::shared_ptr<SegmentStatistics> get_segment_statistics_for_pruning(const Table& table, const ChunkID chunk_id,
+                                                                      const ColumnID column_id);
+
 }  // namespace opossum
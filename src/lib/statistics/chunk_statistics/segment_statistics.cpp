@@ -17,6 +17,7 @@
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 #include "types.hpp"
+#include "zone_map.hpp"
 
 namespace opossum {
 
@@ -69,6 +70,12 @@ std::shared_ptr<SegmentStatistics> SegmentStatistics::build_statistics(
     }
     // clang-format on
   });
+
+  // Zone maps only pay off if the segment consists of more than one block
+  if (segment->size() > ZoneMap::DEFAULT_BLOCK_SIZE) {
+    statistics->set_zone_map(ZoneMap::build(*segment));
+  }
+
   return statistics;
 }
 void SegmentStatistics::add_filter(std::shared_ptr<AbstractFilter> filter) { _filters.emplace_back(filter); }
@@ -82,4 +89,9 @@ bool SegmentStatistics::can_prune(const PredicateCondition predicate_type, const
   }
   return false;
 }
+
+const std::shared_ptr<const ZoneMap>& SegmentStatistics::zone_map() const { return _zone_map; }
+
+void SegmentStatistics::set_zone_map(const std::shared_ptr<const ZoneMap>& zone_map) { _zone_map = zone_map; }
+
 }  // namespace opossum
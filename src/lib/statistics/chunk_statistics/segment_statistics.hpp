@@ -11,6 +11,7 @@
 namespace opossum {
 
 class BaseSegment;
+class ZoneMap;
 
 /**
  * Container class that holds a set of filters with statistical information about a
@@ -29,7 +30,15 @@ class SegmentStatistics final {
   bool can_prune(const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
                  const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const;
 
+  /**
+   * Block-level min/max information used by the table scan to skip parts of the segment. Not part of can_prune, as it
+   * does not allow pruning the entire segment. nullptr if the segment is too small to be split into blocks.
+   */
+  const std::shared_ptr<const ZoneMap>& zone_map() const;
+  void set_zone_map(const std::shared_ptr<const ZoneMap>& zone_map);
+
  protected:
   std::vector<std::shared_ptr<AbstractFilter>> _filters;
+  std::shared_ptr<const ZoneMap> _zone_map;
 };
 }  // namespace opossum
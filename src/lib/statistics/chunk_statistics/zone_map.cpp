@@ -0,0 +1,75 @@
+#include "zone_map.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "min_max_filter.hpp"
+#include "resolve_type.hpp"
+#include "storage/base_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::shared_ptr<ZoneMap> ZoneMap::build(const BaseSegment& segment, const ChunkOffset block_size) {
+  Assert(block_size > 0, "Block size must be greater than zero");
+
+  const auto row_count = static_cast<ChunkOffset>(segment.size());
+  const auto block_count = (row_count + block_size - 1) / block_size;
+
+  auto block_filters = std::vector<std::shared_ptr<const AbstractFilter>>(block_count);
+
+  resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto minimums = std::vector<std::optional<ColumnDataType>>(block_count);
+    auto maximums = std::vector<std::optional<ColumnDataType>>(block_count);
+
+    segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      if (position.is_null()) return;
+
+      const auto block_id = position.chunk_offset() / block_size;
+      const auto& value = position.value();
+
+      auto& minimum = minimums[block_id];
+      auto& maximum = maximums[block_id];
+      if (!minimum || value < *minimum) minimum = value;
+      if (!maximum || *maximum < value) maximum = value;
+    });
+
+    for (auto block_id = size_t{0}; block_id < block_count; ++block_id) {
+      // Blocks that only contain NULLs do not get a filter
+      if (!minimums[block_id]) continue;
+      block_filters[block_id] =
+          std::make_shared<MinMaxFilter<ColumnDataType>>(*minimums[block_id], *maximums[block_id]);
+    }
+  });
+
+  return std::make_shared<ZoneMap>(block_size, row_count, std::move(block_filters));
+}
+
+ZoneMap::ZoneMap(const ChunkOffset block_size, const ChunkOffset row_count,
+                 std::vector<std::shared_ptr<const AbstractFilter>> block_filters)
+    : _block_size(block_size), _row_count(row_count), _block_filters(std::move(block_filters)) {
+  DebugAssert(_block_filters.size() == (_row_count + _block_size - 1) / _block_size,
+              "Number of block filters does not match the number of blocks");
+}
+
+ChunkOffset ZoneMap::block_size() const { return _block_size; }
+
+size_t ZoneMap::block_count() const { return _block_filters.size(); }
+
+std::pair<ChunkOffset, ChunkOffset> ZoneMap::block_range(const size_t block_id) const {
+  DebugAssert(block_id < block_count(), "Block ID out of range");
+  const auto begin = static_cast<ChunkOffset>(block_id * _block_size);
+  return {begin, std::min(static_cast<ChunkOffset>(begin + _block_size), _row_count)};
+}
+
+const std::shared_ptr<const AbstractFilter>& ZoneMap::block_filter(const size_t block_id) const {
+  DebugAssert(block_id < block_count(), "Block ID out of range");
+  return _block_filters[block_id];
+}
+
+}  // namespace opossum
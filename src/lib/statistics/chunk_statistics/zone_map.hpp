@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "abstract_filter.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+/**
+ * Holds min/max information for fixed-size blocks of rows within a segment. Is part of SegmentStatistics.
+ *
+ * The filters in SegmentStatistics can only be used to prune entire chunks. With chunks of Chunk::DEFAULT_SIZE rows,
+ * a single outlier is enough to prevent this. The ZoneMap allows scans to skip blocks of a segment instead, which is
+ * beneficial for partially clustered data.
+ */
+class ZoneMap final {
+ public:
+  static constexpr ChunkOffset DEFAULT_BLOCK_SIZE = 4'096;
+
+  static std::shared_ptr<ZoneMap> build(const BaseSegment& segment, const ChunkOffset block_size = DEFAULT_BLOCK_SIZE);
+
+  ZoneMap(const ChunkOffset block_size, const ChunkOffset row_count,
+          std::vector<std::shared_ptr<const AbstractFilter>> block_filters);
+
+  ChunkOffset block_size() const;
+  size_t block_count() const;
+
+  // Returns the first chunk offset of the block and the offset behind its last row
+  std::pair<ChunkOffset, ChunkOffset> block_range(const size_t block_id) const;
+
+  // Returns the MinMaxFilter of the block or nullptr if the block contains only NULLs
+  const std::shared_ptr<const AbstractFilter>& block_filter(const size_t block_id) const;
+
+ protected:
+  const ChunkOffset _block_size;
+  const ChunkOffset _row_count;
+  const std::vector<std::shared_ptr<const AbstractFilter>> _block_filters;
+};
+
+}  // namespace opossum
@@ -202,4 +202,16 @@ void Chunk::set_statistics(const std::shared_ptr<ChunkStatistics>& chunk_statist
   _statistics = chunk_statistics;
 }
 
+const std::optional<std::pair<ColumnID, OrderByMode>>& Chunk::ordered_by() const { return _ordered_by; }
+
+void Chunk::set_ordered_by(const std::pair<ColumnID, OrderByMode>& ordered_by) {
+  DebugAssert(ordered_by.first < column_count(), "Chunk cannot be ordered by a non-existing column");
+  _ordered_by = ordered_by;
+  mark_immutable();
+}
+
+const std::optional<PartitionID>& Chunk::partition_id() const { return _partition_id; }
+
+void Chunk::set_partition_id(const PartitionID partition_id) { _partition_id = partition_id; }
+
 }  // namespace opossum
@@ -11,6 +11,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "index/segment_index_type.hpp"
@@ -110,8 +111,10 @@ class Chunk : private Noncopyable {
   std::shared_ptr<BaseIndex> get_index(const SegmentIndexType index_type,
                                        const std::vector<ColumnID>& column_ids) const;
 
-  template <typename Index>
-  std::shared_ptr<BaseIndex> create_index(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index) {
+  // Additional arguments are passed on to the constructor of the index, see, e.g., GroupKeyIndex
+  template <typename Index, typename... IndexArgs>
+  std::shared_ptr<BaseIndex> create_index(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index,
+                                          IndexArgs&&... index_args) {
     DebugAssert(([&]() {
                   for (auto segment : segments_to_index) {
                     const auto segment_it = std::find(_segments.cbegin(), _segments.cend(), segment);
@@ -121,15 +124,15 @@ class Chunk : private Noncopyable {
                 }()),
                 "All segments must be part of the chunk.");
 
-    auto index = std::make_shared<Index>(segments_to_index);
+    auto index = std::make_shared<Index>(segments_to_index, std::forward<IndexArgs>(index_args)...);
     _indices.emplace_back(index);
     return index;
   }
 
-  template <typename Index>
-  std::shared_ptr<BaseIndex> create_index(const std::vector<ColumnID>& column_ids) {
+  template <typename Index, typename... IndexArgs>
+  std::shared_ptr<BaseIndex> create_index(const std::vector<ColumnID>& column_ids, IndexArgs&&... index_args) {
     const auto segments = _get_segments_for_ids(column_ids);
-    return create_index<Index>(segments);
+    return create_index<Index>(segments, std::forward<IndexArgs>(index_args)...);
   }
 
   void remove_index(const std::shared_ptr<BaseIndex>& index);
@@ -146,6 +149,23 @@ class Chunk : private Noncopyable {
 
   void set_statistics(const std::shared_ptr<ChunkStatistics>& chunk_statistics);
 
+  /**
+   * If set, the rows of this chunk are sorted by the given column in the given order. NULLs are placed according to
+   * the OrderByMode, i.e., first for Ascending/Descending and last for AscendingNullsLast/DescendingNullsLast. This is
+   * the layout produced by the Sort operator. The information is kept when the chunk is encoded and allows scans to
+   * use binary search instead of a linear scan. As appended rows would break the order, setting it marks the chunk as
+   * immutable.
+   */
+  const std::optional<std::pair<ColumnID, OrderByMode>>& ordered_by() const;
+  void set_ordered_by(const std::pair<ColumnID, OrderByMode>& ordered_by);
+
+  /**
+   * If the chunk belongs to a partitioned table (see AbstractPartitionSchema), this is the partition that all rows of
+   * the chunk belong to. Set by the table when the chunk is created.
+   */
+  const std::optional<PartitionID>& partition_id() const;
+  void set_partition_id(const PartitionID partition_id);
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this chunk and its segments
    */
@@ -161,6 +181,8 @@ class Chunk : private Noncopyable {
   std::shared_ptr<ChunkAccessCounter> _access_counter;
   pmr_vector<std::shared_ptr<BaseIndex>> _indices;
   std::shared_ptr<ChunkStatistics> _statistics;
+  std::optional<std::pair<ColumnID, OrderByMode>> _ordered_by;
+  std::optional<PartitionID> _partition_id;
   bool _is_mutable = true;
 };
 
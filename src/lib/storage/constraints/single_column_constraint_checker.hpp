@@ -3,10 +3,12 @@
 #include <algorithm>
 #include <optional>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "operators/validate.hpp"
 #include "storage/constraints/row_templated_constraint_checker.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/segment_accessor.hpp"
 
 namespace opossum {
@@ -36,6 +38,46 @@ class SingleColumnConstraintChecker : public RowTemplatedConstraintChecker<T> {
     return values;
   }
 
+  /**
+   * If the table has a table index on the constrained column (see Table::add_unique_constraint()), only the rows that
+   * have one of the inserted values need to be checked. They are looked up in the index instead of scanning all rows
+   * of the table. The visibility rules are the same as in the scan implemented by RowTemplatedConstraintChecker.
+   */
+  std::tuple<bool, ChunkID> is_valid_for_inserted_values(std::shared_ptr<const Table> table_to_insert,
+                                                         const CommitID snapshot_commit_id, const TransactionID our_tid,
+                                                         const ChunkID start_chunk_id) override {
+    const auto table_index = this->_table.get_table_index(this->_constraint.columns[0]);
+    if (!table_index) {
+      return RowTemplatedConstraintChecker<T>::is_valid_for_inserted_values(table_to_insert, snapshot_commit_id,
+                                                                            our_tid, start_chunk_id);
+    }
+
+    // As in the scan, return the first mutable chunk so that the commit-time check can skip the immutable ones
+    auto first_mutable_chunk = MAX_CHUNK_ID;
+    for (ChunkID chunk_id{start_chunk_id}; chunk_id < this->_table.chunk_count(); chunk_id++) {
+      if (this->_table.get_chunk(chunk_id)->is_mutable()) {
+        first_mutable_chunk = chunk_id;
+        break;
+      }
+    }
+
+    for (const auto& value : get_inserted_rows(table_to_insert)) {
+      for (const auto& row_id : table_index->lookup(PredicateCondition::Equals, value)) {
+        if (row_id.chunk_id < start_chunk_id) continue;
+
+        const auto mvcc_data = this->_table.get_chunk(row_id.chunk_id)->get_scoped_mvcc_data_lock();
+        const auto row_tid = mvcc_data->tids[row_id.chunk_offset].load();
+        const auto begin_cid = mvcc_data->begin_cids[row_id.chunk_offset];
+        const auto end_cid = mvcc_data->end_cids[row_id.chunk_offset];
+
+        if (Validate::is_row_visible(our_tid, snapshot_commit_id, row_tid, begin_cid, end_cid)) {
+          return std::make_tuple<>(false, first_mutable_chunk);
+        }
+      }
+    }
+    return std::make_tuple<>(true, first_mutable_chunk);
+  }
+
   virtual void prepare_read_chunk_cached(std::shared_ptr<const Chunk> chunk) {
     this->_segment_cached = chunk->segments()[this->_constraint.columns[0]];
     this->_segment_accessor_cached = create_segment_accessor<T>(this->_segment_cached);
@@ -2,7 +2,6 @@
 
 #include <algorithm>
 #include <iterator>
-#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -27,20 +26,42 @@ AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr
   Assert(static_cast<bool>(_indexed_segment), "AdaptiveRadixTree only works with dictionary segments for now");
   Assert((segments_to_index.size() == 1), "AdaptiveRadixTree only works with a single segment");
 
-  // For each value ID in the attribute vector, create a pair consisting of a BinaryComparable of
-  // this value ID and its ChunkOffset (needed for bulk-inserting).
-  std::vector<std::pair<BinaryComparable, ChunkOffset>> pairs_to_insert;
-  pairs_to_insert.reserve(_indexed_segment->attribute_vector()->size());
+  // The ValueIDs are the keys of the tree. As the dictionary is sorted, they can be sorted by counting how often
+  // each ValueID occurs, without comparing any values. NULLs have the largest ValueID (null_value_id()).
+  const auto value_id_count = static_cast<size_t>(_indexed_segment->null_value_id()) + 1u;
+  auto key_begins = std::vector<size_t>(value_id_count + 1u, 0u);
 
+  resolve_compressed_vector_type(*_indexed_segment->attribute_vector(), [&](const auto& attribute_vector) {
+    for (auto value_id_it = attribute_vector.cbegin(); value_id_it != attribute_vector.cend(); ++value_id_it) {
+      DebugAssert(*value_id_it < value_id_count, "ValueID out of range");
+      ++key_begins[*value_id_it + 1u];
+    }
+  });
+
+  // Only ValueIDs that actually occur become keys. Turn the counts into the positions of the keys' ChunkOffsets.
+  auto distinct_keys = std::vector<ValueID>{};
+  auto distinct_key_begins = std::vector<size_t>{0u};
+  for (auto value_id = size_t{0u}; value_id < value_id_count; ++value_id) {
+    const auto count = key_begins[value_id + 1u];
+    key_begins[value_id + 1u] = key_begins[value_id] + count;
+    if (count == 0u) continue;
+
+    distinct_keys.emplace_back(static_cast<ValueID::base_type>(value_id));
+    distinct_key_begins.emplace_back(key_begins[value_id + 1u]);
+  }
+
+  // Scatter the ChunkOffsets to their positions. Equal keys keep the order of their ChunkOffsets.
+  _chunk_offsets.resize(_indexed_segment->attribute_vector()->size());
   resolve_compressed_vector_type(*_indexed_segment->attribute_vector(), [&](const auto& attribute_vector) {
     auto chunk_offset = ChunkOffset{0u};
-    auto value_id_it = attribute_vector.cbegin();
-    for (; value_id_it != attribute_vector.cend(); ++value_id_it, ++chunk_offset) {
-      pairs_to_insert.emplace_back(BinaryComparable(ValueID{*value_id_it}), chunk_offset);
+    for (auto value_id_it = attribute_vector.cbegin(); value_id_it != attribute_vector.cend();
+         ++value_id_it, ++chunk_offset) {
+      _chunk_offsets[key_begins[*value_id_it]++] = chunk_offset;
     }
   });
 
-  _root = _bulk_insert(pairs_to_insert);
+  DebugAssert(!distinct_keys.empty(), "Index on empty segment is not defined");
+  _root = _build_from_sorted(distinct_keys, distinct_key_begins, 0u, distinct_keys.size(), 0u);
 }
 
 BaseIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
@@ -69,50 +90,70 @@ BaseIndex::Iterator AdaptiveRadixTreeIndex::_cend() const { return _chunk_offset
 std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_bulk_insert(
     const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values) {
   DebugAssert(!(values.empty()), "Index on empty segment is not defined");
-  _chunk_offsets.reserve(values.size());
-  auto begin = _chunk_offsets.cbegin();
-  return _bulk_insert(values, static_cast<size_t>(0u), begin);
-}
 
-std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_bulk_insert(
-    const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values, size_t depth, BaseIndex::Iterator& it) {
-  // This is the anchor of the recursion: if all values have the same key, create a leaf.
-  if (std::all_of(values.begin(), values.end(), [&values](const std::pair<BinaryComparable, ChunkOffset>& pair) {
-        return values.front().first == pair.first;
-      })) {
-    // copy the Iterator in the _chunk_offsets - vector --> this is the lower_bound of the leaf
-    auto lower = it;
-    // insert the ChunkOffsets into the vector and push the Iterator further
-    auto old_capacity = _chunk_offsets.capacity();
-    for (const auto& pair : values) {
-      _chunk_offsets.emplace_back(pair.second);
+  const auto to_value_id = [](const BinaryComparable& binary_comparable) {
+    auto value_id = ValueID::base_type{0u};
+    for (size_t byte_id = 0; byte_id < binary_comparable.size(); ++byte_id) {
+      value_id = (value_id << 8u) | binary_comparable[byte_id];
     }
-    std::advance(it, values.size());
-    auto new_capacity = _chunk_offsets.capacity();
-    // we are not allowed to change the size of the vector as it would invalidate all our Iterators
-    Assert(old_capacity == new_capacity, "_chunk_offsets capacity changes, all Iterators are invalidated");
+    return ValueID{value_id};
+  };
 
-    // "it" points to the position after the last inserted ChunkOffset --> this is the upper_bound of the leave
-    auto upper = it;
-    return std::make_shared<Leaf>(lower, upper);
+  auto sorted_values = std::vector<std::pair<ValueID, ChunkOffset>>{};
+  sorted_values.reserve(values.size());
+  for (const auto& [binary_comparable, chunk_offset] : values) {
+    sorted_values.emplace_back(to_value_id(binary_comparable), chunk_offset);
   }
+  std::stable_sort(sorted_values.begin(), sorted_values.end(),
+                   [](const auto& left, const auto& right) { return left.first < right.first; });
+
+  auto distinct_keys = std::vector<ValueID>{};
+  auto key_begins = std::vector<size_t>{};
+  _chunk_offsets.clear();
+  _chunk_offsets.reserve(sorted_values.size());
+  for (const auto& [value_id, chunk_offset] : sorted_values) {
+    if (distinct_keys.empty() || distinct_keys.back() != value_id) {
+      distinct_keys.emplace_back(value_id);
+      key_begins.emplace_back(_chunk_offsets.size());
+    }
+    _chunk_offsets.emplace_back(chunk_offset);
+  }
+  key_begins.emplace_back(_chunk_offsets.size());
 
-  // radix-partition on the depths-byte into 256 partitions
-  std::array<std::vector<std::pair<BinaryComparable, ChunkOffset>>, std::numeric_limits<uint8_t>::max() + 1> partitions;
-  for (const auto& pair : values) {
-    partitions[pair.first[depth]].emplace_back(pair);
+  return _build_from_sorted(distinct_keys, key_begins, 0u, distinct_keys.size(), 0u);
+}
+
+std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_build_from_sorted(const std::vector<ValueID>& distinct_keys,
+                                                                    const std::vector<size_t>& key_begins,
+                                                                    size_t first_key_idx, size_t last_key_idx,
+                                                                    size_t depth) const {
+  // This is the anchor of the recursion: if only a single key is left, create a leaf.
+  if (last_key_idx - first_key_idx == 1u) {
+    auto lower = _chunk_offsets.cbegin() + key_begins[first_key_idx];
+    auto upper = _chunk_offsets.cbegin() + key_begins[last_key_idx];
+    return std::make_shared<Leaf>(lower, upper);
   }
 
-  // call recursively for each non-empty partition and gather the children
+  // Returns the depth-th byte of the key, with the most significant byte first (see BinaryComparable)
+  const auto partial_key = [&](const size_t key_idx) {
+    const auto shift = (sizeof(ValueID::base_type) - 1u - depth) * 8u;
+    return static_cast<uint8_t>(static_cast<ValueID::base_type>(distinct_keys[key_idx]) >> shift);
+  };
+
+  // The keys that share the same partial key are adjacent. Build a child for each run of them.
   std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>> children;
 
-  for (uint16_t partition_id = 0; partition_id < partitions.size(); ++partition_id) {
-    if (!partitions[partition_id].empty()) {
-      auto child =
-          std::make_pair(static_cast<uint8_t>(partition_id), _bulk_insert(partitions[partition_id], depth + 1, it));
-      children.emplace_back(std::move(child));
-    }
+  auto run_begin = first_key_idx;
+  while (run_begin < last_key_idx) {
+    const auto run_partial_key = partial_key(run_begin);
+    auto run_end = run_begin + 1u;
+    while (run_end < last_key_idx && partial_key(run_end) == run_partial_key) ++run_end;
+
+    children.emplace_back(run_partial_key,
+                          _build_from_sorted(distinct_keys, key_begins, run_begin, run_end, depth + 1));
+    run_begin = run_end;
   }
+
   // finally create the appropriate ARTNode according to the size of the children
   if (children.size() <= 4) {
     return std::make_shared<ARTNode4>(children);
@@ -80,10 +80,19 @@ class AdaptiveRadixTreeIndex : public BaseIndex {
 
   Iterator _cend() const final;
 
+  // Sorts the given pairs by key (keeping the order of equal keys) and bulk-loads the tree from them
   std::shared_ptr<ARTNode> _bulk_insert(const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values);
 
-  std::shared_ptr<ARTNode> _bulk_insert(const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values,
-                                        size_t depth, Iterator& it);
+  /**
+   * Builds the (sub-)tree for the distinct keys [first_key_idx, last_key_idx) at the given depth. Requires
+   * _chunk_offsets to be completely filled and sorted by key: the ChunkOffsets of the i-th distinct key are located
+   * in [_chunk_offsets.begin() + key_begins[i], _chunk_offsets.begin() + key_begins[i + 1]). As the keys are sorted,
+   * the keys sharing a partial key at the given depth are adjacent, so no keys or ChunkOffsets have to be copied
+   * while descending.
+   */
+  std::shared_ptr<ARTNode> _build_from_sorted(const std::vector<ValueID>& distinct_keys,
+                                              const std::vector<size_t>& key_begins, size_t first_key_idx,
+                                              size_t last_key_idx, size_t depth) const;
 
   std::vector<std::shared_ptr<const BaseSegment>> _get_indexed_segments() const;
 
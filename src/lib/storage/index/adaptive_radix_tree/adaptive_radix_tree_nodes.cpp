@@ -6,6 +6,10 @@
 #include <utility>
 #include <vector>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "adaptive_radix_tree_index.hpp"
 #include "storage/index/base_index.hpp"
 #include "types.hpp"
@@ -111,6 +115,24 @@ ARTNode16::ARTNode16(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>&
     _partial_keys[i] = children[i].first;
     _children[i] = children[i].second;
   }
+  _child_count = static_cast<uint8_t>(children.size());
+}
+
+uint8_t ARTNode16::_find_first_not_less(const uint8_t partial_key) const {
+#if defined(__SSE2__)
+  // SSE2 has no unsigned byte comparison, but min(a, b) == b holds exactly if a >= b
+  const auto keys = _mm_load_si128(reinterpret_cast<const __m128i*>(_partial_keys.data()));
+  const auto search_key = _mm_set1_epi8(static_cast<char>(partial_key));
+  const auto not_less = _mm_cmpeq_epi8(_mm_min_epu8(keys, search_key), search_key);
+
+  // Ignore the unused slots, which are filled with INVALID_INDEX
+  const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(not_less)) & ((1u << _child_count) - 1u);
+  return mask ? static_cast<uint8_t>(__builtin_ctz(mask)) : _child_count;
+#else
+  const auto partial_keys_end = _partial_keys.begin() + _child_count;
+  return static_cast<uint8_t>(
+      std::distance(_partial_keys.begin(), std::lower_bound(_partial_keys.begin(), partial_keys_end, partial_key)));
+#endif
 }
 
 /**
@@ -140,20 +162,16 @@ BaseIndex::Iterator ARTNode16::_delegate_to_child(
     const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
     const std::function<Iterator(std::iterator_traits<std::array<uint8_t, 16>::iterator>::difference_type, size_t)>&
         function) const {
-  auto partial_key = key[depth];
-  auto partial_key_iterator = std::lower_bound(_partial_keys.begin(), _partial_keys.end(), partial_key);
-  auto partial_key_pos = std::distance(_partial_keys.begin(), partial_key_iterator);
+  const auto partial_key = key[depth];
+  const auto partial_key_pos = _find_first_not_less(partial_key);
 
-  if (*partial_key_iterator == partial_key) {
-    return function(partial_key_pos, ++depth);  // case0
-  }
-  if (partial_key_pos >= 16) {
-    return end();  // case 1a
+  if (partial_key_pos == _child_count) {
+    return end();  // case1a and case1b
   }
-  if (_children[partial_key_pos] != nullptr) {
-    return _children[partial_key_pos]->begin();  // case2
+  if (_partial_keys[partial_key_pos] == partial_key) {
+    return function(partial_key_pos, ++depth);  // case0
   }
-  return end();  // case1b
+  return _children[partial_key_pos]->begin();  // case2
 }
 
 BaseIndex::Iterator ARTNode16::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
@@ -172,24 +190,7 @@ BaseIndex::Iterator ARTNode16::upper_bound(const AdaptiveRadixTreeIndex::BinaryC
 
 BaseIndex::Iterator ARTNode16::begin() const { return _children[0]->begin(); }
 
-/**
- * _end searches the child with the largest partial key == the last child in the _children array.
- * As the _partial_keys array is filled with 255u per default, we expect the largest child at the index right in front
- * of the first entry with 255u. But 255u can also be a valid partial_key: In this case the _children array contains a
- * pointer at this index as a means to differentiate the two cases.
- */
-
-BaseIndex::Iterator ARTNode16::end() const {
-  auto partial_key_iterator = std::lower_bound(_partial_keys.begin(), _partial_keys.end(), INVALID_INDEX);
-  auto partial_key_pos = std::distance(_partial_keys.begin(), partial_key_iterator);
-  if (_children[partial_key_pos] == nullptr) {
-    // there does not exist a child with partial_key 255u, we take the partial_key in front of it
-    return _children[partial_key_pos - 1]->end();
-  } else {
-    // there exists a child with partial_key 255u
-    return _children[partial_key_pos]->end();
-  }
-}
+BaseIndex::Iterator ARTNode16::end() const { return _children[_child_count - 1]->end(); }
 
 /**
  *
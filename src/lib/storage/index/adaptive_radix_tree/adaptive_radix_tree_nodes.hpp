@@ -95,8 +95,14 @@ class ARTNode16 final : public ARTNode {
       const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
       const std::function<Iterator(std::iterator_traits<std::array<uint8_t, 16>::iterator>::difference_type, size_t)>&
           function) const;
-  std::array<uint8_t, 16> _partial_keys{};
+
+  // Returns the position of the first partial key that is not less than the given one, or _child_count if there is
+  // none. Compares all 16 partial keys at once if SSE2 is available.
+  uint8_t _find_first_not_less(const uint8_t partial_key) const;
+
+  alignas(16) std::array<uint8_t, 16> _partial_keys{};
   std::array<std::shared_ptr<ARTNode>, 16> _children{};
+  uint8_t _child_count{0};
 };
 
 /**
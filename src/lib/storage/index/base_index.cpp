@@ -7,6 +7,7 @@
 #include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/hash/hash_index.hpp"
 
 namespace opossum {
 
@@ -21,6 +22,8 @@ size_t BaseIndex::estimate_memory_consumption(SegmentIndexType type, ChunkOffset
       return AdaptiveRadixTreeIndex::estimate_memory_consumption(row_count, distinct_count, value_bytes);
     case SegmentIndexType::BTree:
       return BTreeIndex::estimate_memory_consumption(row_count, distinct_count, value_bytes);
+    case SegmentIndexType::Hash:
+      return HashIndex::estimate_memory_consumption(row_count, distinct_count, value_bytes);
     default:
       Fail("estimate_memory_consumption() is not implemented for the given index type");
   }
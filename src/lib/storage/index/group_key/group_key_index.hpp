@@ -59,6 +59,15 @@ class GroupKeyIndex : public BaseIndex {
 
   explicit GroupKeyIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index);
 
+  // Creates the index from previously built structures instead of building them from the segment, e.g., when
+  // importing a table with ImportBinary. The structures must belong to the given segment.
+  GroupKeyIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index,
+                std::vector<std::size_t> index_offsets, std::vector<ChunkOffset> index_postings);
+
+  // Used to persist the index, see ExportBinary
+  const std::vector<std::size_t>& index_offsets() const;
+  const std::vector<ChunkOffset>& index_postings() const;
+
  private:
   Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const final;
 
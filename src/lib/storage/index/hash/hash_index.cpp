@@ -0,0 +1,39 @@
+#include "hash_index.hpp"
+
+#include "resolve_type.hpp"
+#include "storage/index/segment_index_type.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+size_t HashIndex::estimate_memory_consumption(ChunkOffset row_count, ChunkOffset distinct_count,
+                                              uint32_t value_bytes) {
+  return row_count * sizeof(ChunkOffset) +
+         BaseHashIndexImpl::slot_count_for(distinct_count) * (value_bytes + 2 * sizeof(ChunkOffset));
+}
+
+HashIndex::HashIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index)
+    : BaseIndex{get_index_type_of<HashIndex>()}, _indexed_segments(segments_to_index[0]) {
+  Assert((segments_to_index.size() == 1), "HashIndex only works with a single segment.");
+  _impl = make_shared_by_data_type<BaseHashIndexImpl, HashIndexImpl>(_indexed_segments->data_type(), _indexed_segments);
+}
+
+size_t HashIndex::_memory_consumption() const { return _impl->memory_consumption(); }
+
+HashIndex::Iterator HashIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  return _impl->lower_bound(values);
+}
+
+HashIndex::Iterator HashIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  return _impl->upper_bound(values);
+}
+
+HashIndex::Iterator HashIndex::_cbegin() const { return _impl->cbegin(); }
+
+HashIndex::Iterator HashIndex::_cend() const { return _impl->cend(); }
+
+std::vector<std::shared_ptr<const BaseSegment>> HashIndex::_get_indexed_segments() const {
+  return {_indexed_segments};
+}
+
+}  // namespace opossum
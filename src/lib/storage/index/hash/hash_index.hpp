@@ -0,0 +1,53 @@
+#pragma once
+
+#include "all_type_variant.hpp"
+#include "hash_index_impl.hpp"
+#include "storage/base_segment.hpp"
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class HashIndexTest;
+
+/**
+ * The HashIndex maps the values of a single segment to the ChunkOffsets they occur at, using an open-addressing hash
+ * table. In contrast to all other index types, it is NOT ordered: the ChunkOffsets of a value are stored
+ * consecutively, but the values themselves are in no particular order. Consequently, it only supports equality
+ * lookups. [lower_bound(v), upper_bound(v)) contains the positions of v (or is empty if v does not occur), while
+ * [cbegin(), lower_bound(v)) and [upper_bound(v), cend()) together contain all other positions. Thus, the IndexScan
+ * can use a HashIndex for =, != and IN predicates, but not for range predicates.
+ *
+ * Compared to the ordered indexes, a lookup takes a single hash table probe instead of a tree descent or a binary
+ * search, and the probed slot already holds the range of matching positions.
+ *
+ * Note: does not support null values right now, i.e., NULLs are not indexed.
+ */
+class HashIndex : public BaseIndex {
+  friend HashIndexTest;
+
+ public:
+  using Iterator = std::vector<ChunkOffset>::const_iterator;
+
+  /**
+   * Predicts the memory consumption in bytes of creating this index.
+   * See BaseIndex::estimate_memory_consumption()
+   */
+  static size_t estimate_memory_consumption(ChunkOffset row_count, ChunkOffset distinct_count, uint32_t value_bytes);
+
+  HashIndex() = delete;
+  explicit HashIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index);
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>&) const override;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>&) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+  std::vector<std::shared_ptr<const BaseSegment>> _get_indexed_segments() const override;
+  size_t _memory_consumption() const override;
+
+  std::shared_ptr<const BaseSegment> _indexed_segments;
+  std::shared_ptr<BaseHashIndexImpl> _impl;
+};
+
+}  // namespace opossum
@@ -0,0 +1,146 @@
+#include "hash_index_impl.hpp"
+
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "storage/segment_iterate.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The smallest hash table has 2^3 slots
+constexpr auto MIN_SLOT_COUNT_LOG2 = uint8_t{3};
+
+// Fibonacci hashing (i.e., multiplying with 2^64 / golden ratio and taking the upper bits) spreads the bits of the
+// hash, which is necessary because std::hash is the identity function for integers in common standard libraries
+constexpr auto FIBONACCI_MULTIPLIER = uint64_t{11'400'714'819'323'198'485u};
+
+}  // namespace
+
+size_t BaseHashIndexImpl::slot_count_for(const size_t distinct_count) {
+  auto slot_count = size_t{1} << MIN_SLOT_COUNT_LOG2;
+  while (slot_count < 2 * distinct_count) slot_count *= 2;
+  return slot_count;
+}
+
+BaseHashIndexImpl::Iterator BaseHashIndexImpl::cbegin() const { return _chunk_offsets.cbegin(); }
+
+BaseHashIndexImpl::Iterator BaseHashIndexImpl::cend() const { return _chunk_offsets.cend(); }
+
+template <typename DataType>
+HashIndexImpl<DataType>::HashIndexImpl(const std::shared_ptr<const BaseSegment>& segment_to_index) {
+  _bulk_insert(segment_to_index);
+}
+
+template <typename DataType>
+BaseHashIndexImpl::Iterator HashIndexImpl<DataType>::lower_bound(const std::vector<AllTypeVariant>& values) const {
+  if (_slots.empty() || variant_is_null(values[0])) return cend();
+
+  const auto& slot = _slots[_find_slot(type_cast_variant<DataType>(values[0]))];
+  if (slot.begin == slot.end) return cend();
+  return cbegin() + slot.begin;
+}
+
+template <typename DataType>
+BaseHashIndexImpl::Iterator HashIndexImpl<DataType>::upper_bound(const std::vector<AllTypeVariant>& values) const {
+  if (_slots.empty() || variant_is_null(values[0])) return cend();
+
+  const auto& slot = _slots[_find_slot(type_cast_variant<DataType>(values[0]))];
+  if (slot.begin == slot.end) return cend();
+  return cbegin() + slot.end;
+}
+
+template <typename DataType>
+size_t HashIndexImpl<DataType>::memory_consumption() const {
+  return sizeof(std::vector<ChunkOffset>) + sizeof(ChunkOffset) * _chunk_offsets.size() + sizeof(std::vector<Slot>) +
+         sizeof(Slot) * _slots.size() + _heap_bytes_used;
+}
+
+template <typename DataType>
+size_t HashIndexImpl<DataType>::_find_slot(const DataType& value) const {
+  const auto slot_mask = _slots.size() - 1;
+  auto slot_idx = static_cast<size_t>((static_cast<uint64_t>(std::hash<DataType>{}(value)) * FIBONACCI_MULTIPLIER) >>
+                                      (64 - _slot_count_log2));
+
+  // The load factor is at most 0.5, so there is always an empty slot that terminates the probing
+  while (_slots[slot_idx].begin != _slots[slot_idx].end && !(_slots[slot_idx].value == value)) {
+    slot_idx = (slot_idx + 1) & slot_mask;
+  }
+  return slot_idx;
+}
+
+template <typename DataType>
+void HashIndexImpl<DataType>::_bulk_insert(const std::shared_ptr<const BaseSegment>& segment) {
+  std::vector<std::pair<ChunkOffset, DataType>> values;
+
+  // Materialize
+  segment_iterate<DataType>(*segment, [&](const auto& position) {
+    if (position.is_null()) return;
+    values.emplace_back(position.chunk_offset(), position.value());
+  });
+
+  if (values.empty()) return;
+
+  // Count the occurrences of each value. While counting, a slot's range is [0, count), so that empty slots are still
+  // identified by an empty range.
+  _slots.resize(slot_count_for(0));
+  _slot_count_log2 = MIN_SLOT_COUNT_LOG2;
+
+  for (const auto& [chunk_offset, value] : values) {
+    auto slot_idx = _find_slot(value);
+    if (_slots[slot_idx].begin == _slots[slot_idx].end) {
+      if (slot_count_for(_distinct_count + 1) > _slots.size()) {
+        _grow();
+        slot_idx = _find_slot(value);
+      }
+      _slots[slot_idx].value = value;
+      ++_distinct_count;
+
+      if constexpr (std::is_same_v<DataType, std::string>) {
+        // Track only strings that are longer than the reserved stack space for short string optimization (SSO)
+        static const auto short_string_threshold = std::string("").capacity();
+        if (value.size() > short_string_threshold) _heap_bytes_used += value.size();
+      }
+    }
+    ++_slots[slot_idx].end;
+  }
+
+  // Assign each value its range in _chunk_offsets
+  auto write_positions = std::vector<ChunkOffset>(_slots.size());
+  auto range_begin = ChunkOffset{0};
+  for (auto slot_idx = size_t{0}; slot_idx < _slots.size(); ++slot_idx) {
+    auto& slot = _slots[slot_idx];
+    const auto count = slot.end;
+    slot.begin = range_begin;
+    slot.end = range_begin + count;
+    write_positions[slot_idx] = range_begin;
+    range_begin += count;
+  }
+
+  // Scatter the ChunkOffsets into their ranges. Within a range, they are ordered.
+  _chunk_offsets.resize(values.size());
+  for (const auto& [chunk_offset, value] : values) {
+    _chunk_offsets[write_positions[_find_slot(value)]++] = chunk_offset;
+  }
+}
+
+template <typename DataType>
+void HashIndexImpl<DataType>::_grow() {
+  auto old_slots = std::move(_slots);
+  _slots = std::vector<Slot>(old_slots.size() * 2);
+  ++_slot_count_log2;
+
+  for (auto& slot : old_slots) {
+    if (slot.begin == slot.end) continue;
+    _slots[_find_slot(slot.value)] = std::move(slot);
+  }
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(HashIndexImpl);
+
+}  // namespace opossum
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class HashIndexTest;
+
+class BaseHashIndexImpl : public Noncopyable {
+  friend HashIndexTest;
+
+ public:
+  virtual ~BaseHashIndexImpl() = default;
+
+  // Number of slots of the hash table for the given number of distinct values. The load factor is kept at or below
+  // 0.5, so that probe sequences stay short.
+  static size_t slot_count_for(size_t distinct_count);
+
+  using Iterator = std::vector<ChunkOffset>::const_iterator;
+  virtual size_t memory_consumption() const = 0;
+  virtual Iterator lower_bound(const std::vector<AllTypeVariant>&) const = 0;
+  virtual Iterator upper_bound(const std::vector<AllTypeVariant>&) const = 0;
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+ protected:
+  // The positions of each value are stored consecutively
+  std::vector<ChunkOffset> _chunk_offsets;
+};
+
+/**
+ * Hash table with linear probing. Each slot stores a value together with the range of its positions in
+ * _chunk_offsets, so that a lookup touches a single cache line in the common case. Empty slots have an empty range.
+ */
+template <typename DataType>
+class HashIndexImpl : public BaseHashIndexImpl {
+  friend HashIndexTest;
+
+ public:
+  explicit HashIndexImpl(const std::shared_ptr<const BaseSegment>& segment_to_index);
+
+  size_t memory_consumption() const override;
+
+  Iterator lower_bound(const std::vector<AllTypeVariant>&) const override;
+  Iterator upper_bound(const std::vector<AllTypeVariant>&) const override;
+
+ protected:
+  struct Slot {
+    DataType value{};
+    ChunkOffset begin{0};
+    ChunkOffset end{0};
+  };
+
+  // Returns the slot holding the value or, if the value is not contained, the empty slot the value would be placed in
+  size_t _find_slot(const DataType& value) const;
+
+  void _bulk_insert(const std::shared_ptr<const BaseSegment>& segment);
+  void _grow();
+
+  std::vector<Slot> _slots;
+  size_t _distinct_count{0};
+  uint8_t _slot_count_log2{0};
+  size_t _heap_bytes_used{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,162 @@
+#include "table_index.hpp"
+
+#include <iterator>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "storage/segment_accessor.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BaseTableIndex::BaseTableIndex(const ColumnID column_id) : _column_id(column_id) {}
+
+ColumnID BaseTableIndex::column_id() const { return _column_id; }
+
+template <typename DataType>
+TableIndex<DataType>::TableIndex(const ColumnID column_id) : BaseTableIndex(column_id) {}
+
+template <typename DataType>
+void TableIndex<DataType>::insert_rows(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                                       const ChunkOffset end_offset) {
+  DebugAssert(end_offset <= chunk.size(), "Rows to index are out of the chunk's bounds");
+
+  const auto accessor = create_segment_accessor<DataType>(chunk.get_segment(_column_id));
+
+  // Materialize first to keep the time spent holding the exclusive lock short
+  auto values = std::vector<std::pair<DataType, RowID>>{};
+  values.reserve(end_offset - begin_offset);
+  for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+    const auto value = accessor->access(chunk_offset);
+    if (!value) continue;
+    values.emplace_back(*value, RowID{chunk_id, chunk_offset});
+  }
+
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  for (auto& [value, row_id] : values) {
+    _btree.insert(std::make_pair(std::move(value), row_id));
+  }
+}
+
+template <typename DataType>
+void TableIndex<DataType>::erase_rows(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                                      const ChunkOffset end_offset) {
+  DebugAssert(end_offset <= chunk.size(), "Rows to remove are out of the chunk's bounds");
+
+  const auto accessor = create_segment_accessor<DataType>(chunk.get_segment(_column_id));
+
+  auto values = std::vector<std::pair<DataType, RowID>>{};
+  values.reserve(end_offset - begin_offset);
+  for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+    const auto value = accessor->access(chunk_offset);
+    if (!value) continue;
+    values.emplace_back(*value, RowID{chunk_id, chunk_offset});
+  }
+
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  for (const auto& [value, row_id] : values) {
+    // Duplicates are stored in insertion order, so the scan over the equal range is short for all but very frequent
+    // values
+    auto [iter, end] = _btree.equal_range(value);
+    while (iter != end && !(iter->second == row_id)) ++iter;
+    DebugAssert(iter != end, "Row to remove was not indexed");
+    if (iter != end) _btree.erase(iter);
+  }
+}
+
+template <typename DataType>
+PosList TableIndex<DataType>::lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                     const std::optional<AllTypeVariant>& value2) const {
+  auto pos_list = PosList{};
+  _for_each_matching_range(predicate_condition, value, value2, [&](auto begin, const auto& end) {
+    for (; begin != end; ++begin) {
+      pos_list.emplace_back(begin->second);
+    }
+  });
+  return pos_list;
+}
+
+template <typename DataType>
+size_t TableIndex<DataType>::count(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                   const std::optional<AllTypeVariant>& value2) const {
+  auto count = size_t{0};
+  _for_each_matching_range(predicate_condition, value, value2,
+                           [&](const auto& begin, const auto& end) { count += std::distance(begin, end); });
+  return count;
+}
+
+template <typename DataType>
+std::vector<DataType> TableIndex<DataType>::lookup_values(const PredicateCondition predicate_condition,
+                                                          const AllTypeVariant& value,
+                                                          const std::optional<AllTypeVariant>& value2) const {
+  auto values = std::vector<DataType>{};
+  _for_each_matching_range(predicate_condition, value, value2, [&](auto begin, const auto& end) {
+    for (; begin != end; ++begin) {
+      values.emplace_back(begin->first);
+    }
+  });
+  return values;
+}
+
+template <typename DataType>
+size_t TableIndex<DataType>::size() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return _btree.size();
+}
+
+template <typename DataType>
+size_t TableIndex<DataType>::memory_consumption() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return sizeof(*this) + _btree.bytes_used();
+}
+
+template <typename DataType>
+template <typename Functor>
+void TableIndex<DataType>::_for_each_matching_range(const PredicateCondition predicate_condition,
+                                                    const AllTypeVariant& value,
+                                                    const std::optional<AllTypeVariant>& value2,
+                                                    const Functor& functor) const {
+  if (variant_is_null(value) || (value2 && variant_is_null(*value2))) return;
+
+  const auto typed_value = type_cast_variant<DataType>(value);
+
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      functor(_btree.lower_bound(typed_value), _btree.upper_bound(typed_value));
+      break;
+    case PredicateCondition::NotEquals:
+      functor(_btree.begin(), _btree.lower_bound(typed_value));
+      functor(_btree.upper_bound(typed_value), _btree.end());
+      break;
+    case PredicateCondition::LessThan:
+      functor(_btree.begin(), _btree.lower_bound(typed_value));
+      break;
+    case PredicateCondition::LessThanEquals:
+      functor(_btree.begin(), _btree.upper_bound(typed_value));
+      break;
+    case PredicateCondition::GreaterThan:
+      functor(_btree.upper_bound(typed_value), _btree.end());
+      break;
+    case PredicateCondition::GreaterThanEquals:
+      functor(_btree.lower_bound(typed_value), _btree.end());
+      break;
+    case PredicateCondition::Between: {
+      Assert(value2, "Between requires a second value");
+      const auto typed_value2 = type_cast_variant<DataType>(*value2);
+      if (typed_value2 < typed_value) break;
+      functor(_btree.lower_bound(typed_value), _btree.upper_bound(typed_value2));
+      break;
+    }
+    default:
+      Fail("Unsupported predicate condition encountered");
+  }
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(TableIndex);
+
+}  // namespace opossum
@@ -0,0 +1,113 @@
+#pragma once
+
+#ifdef __clang__
+#pragma clang diagnostic ignored "-Wall"
+#include <btree_map.h>
+#pragma clang diagnostic pop
+#elif __GNUC__
+#pragma GCC system_header
+#include <btree_map.h>
+#endif
+
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+/**
+ * A TableIndex is a secondary index on a single column of a data table. In contrast to the chunk-level indexes (see
+ * BaseIndex), which map values to the ChunkOffsets of a single chunk, it maps values to RowIDs across all chunks of
+ * the table. Thus, a lookup takes a single probe, independent of the number of chunks.
+ *
+ * The index is created via Table::create_table_index() (or implicitly for single-column unique constraints) and
+ * maintained by Table::append(), Table::append_chunk(), and the Insert operator.
+ * As the Insert operator indexes rows right away, lookups also cover the rows of mutable chunks, including the ones
+ * of transactions that are not yet committed. Rows inserted by an aborted transaction are removed from the index on
+ * rollback. Deleted rows stay indexed and have to be filtered by their MVCC data (i.e., by the Validate operator),
+ * just like the rows in the chunks themselves. NULLs are not indexed.
+ *
+ * Modifications and lookups may happen concurrently, they are synchronized using a reader-writer lock.
+ */
+class BaseTableIndex : private Noncopyable {
+ public:
+  explicit BaseTableIndex(const ColumnID column_id);
+  virtual ~BaseTableIndex() = default;
+
+  ColumnID column_id() const;
+
+  // Adds the rows [begin_offset, end_offset) of the chunk with the given ID to the index
+  virtual void insert_rows(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                           const ChunkOffset end_offset) = 0;
+
+  // Removes the rows [begin_offset, end_offset) of the chunk with the given ID from the index. The rows must have been
+  // added before and their values must not have changed since.
+  virtual void erase_rows(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                          const ChunkOffset end_offset) = 0;
+
+  /**
+   * Returns the RowIDs of all rows for which `<column> <predicate_condition> value` holds. For Between, value2 is the
+   * (inclusive) upper bound. The RowIDs are ordered by value. All predicate conditions that compare the column with
+   * one or two values are supported, except for Like and NotLike.
+   */
+  virtual PosList lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                         const std::optional<AllTypeVariant>& value2 = std::nullopt) const = 0;
+
+  // Returns the number of rows matched by lookup() without materializing them
+  virtual size_t count(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                       const std::optional<AllTypeVariant>& value2 = std::nullopt) const = 0;
+
+  // Number of indexed rows
+  virtual size_t size() const = 0;
+
+  virtual size_t memory_consumption() const = 0;
+
+ protected:
+  const ColumnID _column_id;
+};
+
+template <typename DataType>
+class TableIndex : public BaseTableIndex {
+ public:
+  explicit TableIndex(const ColumnID column_id);
+
+  void insert_rows(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                   const ChunkOffset end_offset) override;
+
+  void erase_rows(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                  const ChunkOffset end_offset) override;
+
+  PosList lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                 const std::optional<AllTypeVariant>& value2 = std::nullopt) const override;
+
+  size_t count(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+               const std::optional<AllTypeVariant>& value2 = std::nullopt) const override;
+
+  // Returns the column values of the rows matched by lookup(), in the same order. Used for index-only scans.
+  std::vector<DataType> lookup_values(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                      const std::optional<AllTypeVariant>& value2 = std::nullopt) const;
+
+  size_t size() const override;
+
+  size_t memory_consumption() const override;
+
+ protected:
+  using Map = btree::btree_multimap<DataType, RowID>;
+
+  // Calls functor(begin, end) for each range of _btree that matches the predicate, while holding the shared lock
+  template <typename Functor>
+  void _for_each_matching_range(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                const std::optional<AllTypeVariant>& value2, const Functor& functor) const;
+
+  Map _btree;
+  mutable std::shared_mutex _mutex;
+};
+
+}  // namespace opossum
@@ -0,0 +1,12 @@
+#include "abstract_partition_schema.hpp"
+
+namespace opossum {
+
+AbstractPartitionSchema::AbstractPartitionSchema(const ColumnID column_id, const DataType data_type)
+    : _column_id(column_id), _data_type(data_type) {}
+
+ColumnID AbstractPartitionSchema::column_id() const { return _column_id; }
+
+DataType AbstractPartitionSchema::data_type() const { return _data_type; }
+
+}  // namespace opossum
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <optional>
+#include <string>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * A partition schema assigns each row of a table to a partition, based on the row's value in the partitioning column.
+ * A table with a partition schema (see Table::set_partition_schema()) keeps separate chunks for each partition, so
+ * that every chunk only holds rows of a single partition (see Chunk::partition_id()).
+ *
+ * Knowing the partition of a chunk allows the ChunkPruningRule to skip it without looking at the chunk's statistics.
+ * In contrast to statistics, this also works for chunks that are still mutable.
+ */
+class AbstractPartitionSchema {
+ public:
+  AbstractPartitionSchema(const ColumnID column_id, const DataType data_type);
+  virtual ~AbstractPartitionSchema() = default;
+
+  ColumnID column_id() const;
+  DataType data_type() const;
+
+  virtual PartitionID partition_count() const = 0;
+
+  // Returns the partition that a row with the given value in the partitioning column belongs to. NULLs are always
+  // assigned to the first partition.
+  virtual PartitionID get_matching_partition(const AllTypeVariant& value) const = 0;
+
+  // Returns true if no row of the given partition can satisfy `<partitioning column> <predicate_condition> value`
+  // (or `... BETWEEN value AND value2`). Like AbstractFilter::can_prune, this is conservative: false does not mean that
+  // the partition contains matching rows.
+  virtual bool can_prune(const PartitionID partition_id, const PredicateCondition predicate_condition,
+                         const AllTypeVariant& value,
+                         const std::optional<AllTypeVariant>& value2 = std::nullopt) const = 0;
+
+  virtual std::string description() const = 0;
+
+ protected:
+  const ColumnID _column_id;
+  const DataType _data_type;
+};
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#include "hash_partition_schema.hpp"
+
+#include <functional>
+#include <sstream>
+#include <string>
+
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+HashPartitionSchema::HashPartitionSchema(const ColumnID column_id, const DataType data_type,
+                                         const PartitionID partition_count)
+    : AbstractPartitionSchema(column_id, data_type), _partition_count(partition_count) {
+  Assert(_partition_count > 0, "HashPartitionSchema requires at least one partition");
+}
+
+PartitionID HashPartitionSchema::partition_count() const { return _partition_count; }
+
+PartitionID HashPartitionSchema::get_matching_partition(const AllTypeVariant& value) const {
+  if (variant_is_null(value)) return PartitionID{0};
+
+  auto partition_id = PartitionID{0};
+  resolve_data_type(_data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    // The value is cast to the column's type first so that, e.g., an int64_t literal in a predicate ends up in the
+    // same partition as the equal int32_t value stored in the table
+    const auto hash = std::hash<ColumnDataType>{}(type_cast_variant<ColumnDataType>(value));
+    partition_id = PartitionID{static_cast<PartitionID::base_type>(hash % _partition_count)};
+  });
+  return partition_id;
+}
+
+bool HashPartitionSchema::can_prune(const PartitionID partition_id, const PredicateCondition predicate_condition,
+                                    const AllTypeVariant& value, const std::optional<AllTypeVariant>& value2) const {
+  DebugAssert(partition_id < _partition_count, "PartitionID out of range");
+  if (predicate_condition != PredicateCondition::Equals || variant_is_null(value)) return false;
+
+  return get_matching_partition(value) != partition_id;
+}
+
+std::string HashPartitionSchema::description() const {
+  std::stringstream stream;
+  stream << "HashPartitionSchema on column #" << _column_id << " with " << _partition_count << " partitions";
+  return stream.str();
+}
+
+}  // namespace opossum
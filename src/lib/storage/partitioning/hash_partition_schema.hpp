@@ -0,0 +1,30 @@
+#pragma once
+
+#include <optional>
+#include <string>
+
+#include "abstract_partition_schema.hpp"
+
+namespace opossum {
+
+/**
+ * Partitions a table by the hash of the partitioning column. This spreads the rows evenly across the partitions and
+ * keeps all rows with the same value (e.g., the same tenant) together. Only equality predicates can be used for
+ * pruning.
+ */
+class HashPartitionSchema : public AbstractPartitionSchema {
+ public:
+  HashPartitionSchema(const ColumnID column_id, const DataType data_type, const PartitionID partition_count);
+
+  PartitionID partition_count() const override;
+  PartitionID get_matching_partition(const AllTypeVariant& value) const override;
+  bool can_prune(const PartitionID partition_id, const PredicateCondition predicate_condition,
+                 const AllTypeVariant& value,
+                 const std::optional<AllTypeVariant>& value2 = std::nullopt) const override;
+  std::string description() const override;
+
+ protected:
+  const PartitionID _partition_count;
+};
+
+}  // namespace opossum
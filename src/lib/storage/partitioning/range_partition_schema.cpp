@@ -0,0 +1,111 @@
+#include "range_partition_schema.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+RangePartitionSchema::RangePartitionSchema(const ColumnID column_id, const DataType data_type,
+                                           const std::vector<AllTypeVariant>& bounds)
+    : AbstractPartitionSchema(column_id, data_type), _bounds(bounds) {
+  Assert(!_bounds.empty(), "RangePartitionSchema requires at least one bound");
+  Assert(_bounds.size() < std::numeric_limits<PartitionID::base_type>::max(), "Too many partitions");
+  Assert(std::none_of(_bounds.begin(), _bounds.end(), [](const auto& bound) { return variant_is_null(bound); }),
+         "Bounds of a RangePartitionSchema must not be NULL");
+
+  resolve_data_type(_data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    for (auto bound_idx = size_t{1}; bound_idx < _bounds.size(); ++bound_idx) {
+      Assert(type_cast_variant<ColumnDataType>(_bounds[bound_idx - 1]) <
+                 type_cast_variant<ColumnDataType>(_bounds[bound_idx]),
+             "Bounds of a RangePartitionSchema must be strictly increasing");
+    }
+  });
+}
+
+const std::vector<AllTypeVariant>& RangePartitionSchema::bounds() const { return _bounds; }
+
+PartitionID RangePartitionSchema::partition_count() const {
+  return PartitionID{static_cast<PartitionID::base_type>(_bounds.size() + 1)};
+}
+
+PartitionID RangePartitionSchema::get_matching_partition(const AllTypeVariant& value) const {
+  if (variant_is_null(value)) return PartitionID{0};
+
+  auto partition_id = PartitionID{0};
+  resolve_data_type(_data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto typed_value = type_cast_variant<ColumnDataType>(value);
+
+    // The partition of a value is the number of bounds that are smaller than or equal to it
+    const auto bound_iter = std::upper_bound(_bounds.begin(), _bounds.end(), typed_value,
+                                             [](const auto& lhs, const auto& bound) {
+                                               return lhs < type_cast_variant<ColumnDataType>(bound);
+                                             });
+    partition_id = PartitionID{static_cast<PartitionID::base_type>(std::distance(_bounds.begin(), bound_iter))};
+  });
+  return partition_id;
+}
+
+bool RangePartitionSchema::can_prune(const PartitionID partition_id, const PredicateCondition predicate_condition,
+                                     const AllTypeVariant& value, const std::optional<AllTypeVariant>& value2) const {
+  DebugAssert(partition_id < partition_count(), "PartitionID out of range");
+  if (variant_is_null(value) || (value2 && variant_is_null(*value2))) return false;
+
+  auto can_prune = false;
+  resolve_data_type(_data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto typed_value = type_cast_variant<ColumnDataType>(value);
+
+    // All values of the partition lie within [lower_bound, upper_bound). The first and last partitions are unbounded.
+    auto lower_bound = std::optional<ColumnDataType>{};
+    auto upper_bound = std::optional<ColumnDataType>{};
+    if (partition_id > 0) lower_bound = type_cast_variant<ColumnDataType>(_bounds[partition_id - 1]);
+    if (partition_id < _bounds.size()) upper_bound = type_cast_variant<ColumnDataType>(_bounds[partition_id]);
+
+    switch (predicate_condition) {
+      case PredicateCondition::Equals:
+        can_prune = (lower_bound && typed_value < *lower_bound) || (upper_bound && typed_value >= *upper_bound);
+        break;
+      case PredicateCondition::LessThan:
+        can_prune = lower_bound && typed_value <= *lower_bound;
+        break;
+      case PredicateCondition::LessThanEquals:
+        can_prune = lower_bound && typed_value < *lower_bound;
+        break;
+      case PredicateCondition::GreaterThan:
+      case PredicateCondition::GreaterThanEquals:
+        can_prune = upper_bound && typed_value >= *upper_bound;
+        break;
+      case PredicateCondition::Between: {
+        DebugAssert(value2, "Between needs two values");
+        const auto typed_value2 = type_cast_variant<ColumnDataType>(*value2);
+        can_prune = (upper_bound && typed_value >= *upper_bound) || (lower_bound && typed_value2 < *lower_bound);
+        break;
+      }
+      default:
+        can_prune = false;
+    }
+  });
+  return can_prune;
+}
+
+std::string RangePartitionSchema::description() const {
+  std::stringstream stream;
+  stream << "RangePartitionSchema on column #" << _column_id << " with bounds [";
+  for (auto bound_idx = size_t{0}; bound_idx < _bounds.size(); ++bound_idx) {
+    stream << _bounds[bound_idx];
+    if (bound_idx + 1 < _bounds.size()) stream << ", ";
+  }
+  stream << "]";
+  return stream.str();
+}
+
+}  // namespace opossum
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_partition_schema.hpp"
+
+namespace opossum {
+
+/**
+ * Partitions a table by value ranges of the partitioning column. n bounds define n + 1 partitions:
+ *   partition 0:  value < bounds[0]
+ *   partition i:  bounds[i - 1] <= value < bounds[i]
+ *   partition n:  bounds[n - 1] <= value
+ * This fits, e.g., time series, where each partition holds the rows of one period.
+ */
+class RangePartitionSchema : public AbstractPartitionSchema {
+ public:
+  RangePartitionSchema(const ColumnID column_id, const DataType data_type, const std::vector<AllTypeVariant>& bounds);
+
+  const std::vector<AllTypeVariant>& bounds() const;
+
+  PartitionID partition_count() const override;
+  PartitionID get_matching_partition(const AllTypeVariant& value) const override;
+  bool can_prune(const PartitionID partition_id, const PredicateCondition predicate_condition,
+                 const AllTypeVariant& value,
+                 const std::optional<AllTypeVariant>& value2 = std::nullopt) const override;
+  std::string description() const override;
+
+ protected:
+  const std::vector<AllTypeVariant> _bounds;
+};
+
+}  // namespace opossum
@@ -1,5 +1,7 @@
 #include "table.hpp"
 
+#include <boost/hana/for_each.hpp>
+
 #include <algorithm>
 #include <limits>
 #include <memory>
@@ -10,7 +12,16 @@
 
 #include "concurrency/transaction_manager.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/constraints/unique_checker.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/hash/hash_index.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/partitioning/abstract_partition_schema.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
@@ -90,11 +101,37 @@ ColumnID Table::column_id_by_name(const std::string& column_name) const {
 }
 
 void Table::append(const std::vector<AllTypeVariant>& values) {
-  if (_chunks.empty() || _chunks.back()->size() >= _max_chunk_size) {
+  if (_partition_schema) {
+    const auto partition_id = _partition_schema->get_matching_partition(values.at(_partition_schema->column_id()));
+    const auto chunk_id = mutable_chunk_of_partition(partition_id);
+    _chunks[chunk_id]->append(values);
+    _insert_last_row_into_table_indexes(chunk_id);
+    return;
+  }
+
+  if (_chunks.empty() || !_chunks.back()->is_mutable() || _chunks.back()->size() >= _max_chunk_size) {
     append_mutable_chunk();
   }
 
   _chunks.back()->append(values);
+  _insert_last_row_into_table_indexes(ChunkID{static_cast<ChunkID::base_type>(_chunks.size() - 1)});
+}
+
+void Table::_insert_last_row_into_table_indexes(const ChunkID chunk_id) {
+  const auto& chunk = *_chunks[chunk_id];
+  for (const auto& table_index : _table_indexes) {
+    table_index->insert_rows(chunk, chunk_id, chunk.size() - 1, chunk.size());
+  }
+}
+
+void Table::_insert_last_chunk_into_table_indexes() {
+  if (_table_indexes.empty()) return;
+
+  const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(_chunks.size() - 1)};
+  const auto& chunk = *_chunks[chunk_id];
+  for (const auto& table_index : _table_indexes) {
+    table_index->insert_rows(chunk, chunk_id, ChunkOffset{0}, chunk.size());
+  }
 }
 
 void Table::append_mutable_chunk() {
@@ -108,6 +145,35 @@ void Table::append_mutable_chunk() {
   append_chunk(segments);
 }
 
+void Table::set_partition_schema(const std::shared_ptr<const AbstractPartitionSchema>& partition_schema) {
+  Assert(_type == TableType::Data, "Only data tables can be partitioned");
+  Assert(_chunks.empty(), "The partition schema can only be set for empty tables");
+  Assert(partition_schema->column_id() < column_count(), "Partitioning column does not exist");
+  Assert(partition_schema->data_type() == column_data_type(partition_schema->column_id()),
+         "Data type of the partition schema does not match the partitioning column");
+
+  _partition_schema = partition_schema;
+  _mutable_chunk_id_by_partition = std::vector<ChunkID>(partition_schema->partition_count(), INVALID_CHUNK_ID);
+}
+
+const std::shared_ptr<const AbstractPartitionSchema>& Table::partition_schema() const { return _partition_schema; }
+
+ChunkID Table::mutable_chunk_of_partition(const PartitionID partition_id) {
+  DebugAssert(_partition_schema, "Table is not partitioned");
+  DebugAssert(partition_id < _mutable_chunk_id_by_partition.size(), "PartitionID out of range");
+
+  auto& chunk_id = _mutable_chunk_id_by_partition[partition_id];
+  const auto needs_new_chunk = chunk_id == INVALID_CHUNK_ID || !_chunks[chunk_id]->is_mutable() ||
+                               _chunks[chunk_id]->size() >= _max_chunk_size;
+  if (needs_new_chunk) {
+    append_mutable_chunk();
+    chunk_id = ChunkID{static_cast<ChunkID::base_type>(_chunks.size() - 1)};
+    _chunks[chunk_id]->set_partition_id(partition_id);
+  }
+
+  return chunk_id;
+}
+
 uint64_t Table::row_count() const {
   uint64_t ret = 0;
   for (const auto& chunk : _chunks) {
@@ -170,6 +236,7 @@ void Table::append_chunk(const Segments& segments, const std::optional<Polymorph
   }
 
   _chunks.push_back(std::make_shared<Chunk>(segments, mvcc_data, alloc, access_counter));
+  _insert_last_chunk_into_table_indexes();
 }
 
 void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
@@ -191,12 +258,67 @@ void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
               "Chunk does not have the same MVCC setting as the table.");
 
   _chunks.push_back(chunk);
+  _insert_last_chunk_into_table_indexes();
 }
 
 std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
 
 std::vector<IndexInfo> Table::get_indexes() const { return _indexes; }
 
+void Table::create_index(const SegmentIndexType index_type, const std::vector<ColumnID>& column_ids,
+                         const std::string& name) {
+  auto index_created = false;
+  hana::for_each(detail::segment_index_map, [&](auto index_pair) {
+    if (hana::second(index_pair) != index_type) return;
+
+    using Index = typename decltype(+hana::first(index_pair))::type;
+    create_index<Index>(column_ids, name);
+    index_created = true;
+  });
+  Assert(index_created, "Invalid index type");
+}
+
+void Table::_create_chunk_indexes(const SegmentIndexType index_type, const std::vector<ColumnID>& column_ids,
+                                  const std::function<void(Chunk&)>& create_chunk_index) {
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(_chunks.size());
+
+  for (const auto& chunk : _chunks) {
+    if (chunk->get_index(index_type, column_ids)) continue;
+
+    // Each job only modifies the list of indexes of its own chunk
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk]() { create_chunk_index(*chunk); }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+}
+
+std::shared_ptr<BaseTableIndex> Table::create_table_index(const ColumnID column_id) {
+  Assert(_type == TableType::Data, "Table indexes can only be created on data tables");
+  Assert(column_id < column_count(), "ColumnID out of range");
+  Assert(!get_table_index(column_id), "There already is a table index on this column");
+
+  const auto table_index =
+      make_shared_by_data_type<BaseTableIndex, TableIndex>(column_data_type(column_id), column_id);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    const auto& chunk = *_chunks[chunk_id];
+    table_index->insert_rows(chunk, chunk_id, ChunkOffset{0}, chunk.size());
+  }
+
+  _table_indexes.emplace_back(table_index);
+  return table_index;
+}
+
+std::shared_ptr<BaseTableIndex> Table::get_table_index(const ColumnID column_id) const {
+  for (const auto& table_index : _table_indexes) {
+    if (table_index->column_id() == column_id) return table_index;
+  }
+  return nullptr;
+}
+
+const std::vector<std::shared_ptr<BaseTableIndex>>& Table::table_indexes() const { return _table_indexes; }
+
 const std::vector<TableConstraintDefinition>& Table::get_unique_constraints() const { return _constraint_definitions; }
 
 size_t Table::estimate_memory_usage() const {
@@ -250,6 +372,13 @@ void Table::add_unique_constraint(const std::vector<ColumnID>& column_ids, bool
     Assert(constraint_satisfied(*this, new_constraint, TransactionManager::get().last_commit_id(),
                                 TransactionManager::UNUSED_TRANSACTION_ID),
            "Constraint is not satisfied on table values");
+
+    // A table index turns the check of inserted values into lookups, see SingleColumnConstraintChecker. It is
+    // maintained by the Insert operator.
+    if (sorted_columns_ids.size() == 1 && _type == TableType::Data && !get_table_index(sorted_columns_ids[0])) {
+      create_table_index(sorted_columns_ids[0]);
+    }
+
     _constraint_definitions.push_back(new_constraint);
   }
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -19,6 +20,8 @@
 
 namespace opossum {
 
+class AbstractPartitionSchema;
+class BaseTableIndex;
 class TableStatistics;
 
 /**
@@ -110,6 +113,26 @@ class Table : private Noncopyable {
 
   /** @} */
 
+  /**
+   * @defgroup Partitioning
+   * A partitioned table keeps separate chunks for each partition. Rows are routed to the chunks of their partition by
+   * append() and the Insert operator.
+   * @{
+   */
+
+  // Can only be set on empty data tables
+  void set_partition_schema(const std::shared_ptr<const AbstractPartitionSchema>& partition_schema);
+
+  // nullptr if the table is not partitioned
+  const std::shared_ptr<const AbstractPartitionSchema>& partition_schema() const;
+
+  // Returns the ID of the chunk that new rows of the given partition are appended to. If the partition has no such
+  // chunk yet, or if its chunk is full or immutable, a new mutable chunk is appended to the table. Not thread-safe,
+  // callers have to hold the append mutex.
+  ChunkID mutable_chunk_of_partition(const PartitionID partition_id);
+
+  /** @} */
+
   /**
    * @defgroup Convenience methods for accessing/adding Table data. Slow, use only for testing!
    * @{
@@ -151,17 +174,39 @@ class Table : private Noncopyable {
 
   std::vector<IndexInfo> get_indexes() const;
 
+  /**
+   * Creates an index of the given type on the columns of every chunk. The chunk indexes are built in parallel, one
+   * JobTask per chunk. Chunks that already have such an index (e.g., because it was loaded from a file) are skipped.
+   */
   template <typename Index>
   void create_index(const std::vector<ColumnID>& column_ids, const std::string& name = "") {
-    SegmentIndexType index_type = get_index_type_of<Index>();
+    const auto index_type = get_index_type_of<Index>();
 
-    for (auto& chunk : _chunks) {
-      chunk->create_index<Index>(column_ids);
-    }
-    IndexInfo i = {column_ids, name, index_type};
-    _indexes.emplace_back(i);
+    _create_chunk_indexes(index_type, column_ids, [&](Chunk& chunk) { chunk.create_index<Index>(column_ids); });
+    _indexes.emplace_back(IndexInfo{column_ids, name, index_type});
   }
 
+  // Same as above for an index type that is only known at runtime
+  void create_index(const SegmentIndexType index_type, const std::vector<ColumnID>& column_ids,
+                    const std::string& name = "");
+
+  /**
+   * @defgroup Table-level indexes
+   * In contrast to the chunk indexes created by create_index(), a table index covers all chunks of the table, see
+   * BaseTableIndex. It indexes the rows that exist at creation time and is then maintained by append(), append_chunk(),
+   * and the Insert operator. Creating a table index is not thread-safe with respect to concurrent inserts.
+   * @{
+   */
+
+  std::shared_ptr<BaseTableIndex> create_table_index(const ColumnID column_id);
+
+  // nullptr if there is no table index on the column
+  std::shared_ptr<BaseTableIndex> get_table_index(const ColumnID column_id) const;
+
+  const std::vector<std::shared_ptr<BaseTableIndex>>& table_indexes() const;
+
+  /** @} */
+
   const std::vector<TableConstraintDefinition>& get_unique_constraints() const;
 
   /**
@@ -176,6 +221,16 @@ class Table : private Noncopyable {
   void add_unique_constraint(const std::vector<ColumnID>& column_ids, bool primary = false);
 
  protected:
+  // Calls create_chunk_index for every chunk without an index of the given type on the columns, in parallel
+  void _create_chunk_indexes(const SegmentIndexType index_type, const std::vector<ColumnID>& column_ids,
+                             const std::function<void(Chunk&)>& create_chunk_index);
+
+  // Adds the last row of the given chunk to all table indexes
+  void _insert_last_row_into_table_indexes(const ChunkID chunk_id);
+
+  // Adds all rows of the last chunk to all table indexes, used when a filled chunk is appended
+  void _insert_last_chunk_into_table_indexes();
+
   const TableColumnDefinitions _column_definitions;
   const TableType _type;
   const UseMvcc _use_mvcc;
@@ -185,5 +240,10 @@ class Table : private Noncopyable {
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
   std::vector<IndexInfo> _indexes;
+  std::vector<std::shared_ptr<BaseTableIndex>> _table_indexes;
+  std::shared_ptr<const AbstractPartitionSchema> _partition_schema;
+
+  // For each partition, the ID of the chunk that rows are currently appended to (INVALID_CHUNK_ID if none)
+  std::vector<ChunkID> _mutable_chunk_id_by_partition;
 };
 }  // namespace opossum
@@ -3,7 +3,6 @@
 #include "concurrency/transaction_context.hpp"
 #include "concurrency/transaction_manager.hpp"
 #include "operators/abstract_operator.hpp"
-#include "scheduler/current_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
 
 namespace opossum {
@@ -11,7 +10,7 @@ namespace opossum {
 void ExecuteServerPreparedStatementTask::_on_execute() {
   try {
     const auto tasks = OperatorTask::make_tasks_from_operator(_prepared_plan, CleanupTemporaries::Yes);
-    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+    OperatorTask::execute_tasks(tasks);
     auto result_table = tasks.back()->get_operator()->get_output();
     _promise.set_value(std::move(result_table));
   } catch (const std::exception&) {
@@ -5,6 +5,8 @@
 #include <cstdlib>
 #include <iostream>
 
+#include "numa_memory_resource.hpp"
+
 namespace boost {
 namespace container {
 namespace pmr {
@@ -15,10 +17,17 @@ class default_resource_impl : public memory_resource {  // NOLINT
 
   void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override { std::free(p); }  // NOLINT
 
-  bool do_is_equal(const memory_resource& other) const BOOST_NOEXCEPT override { return &other == this; }
+  bool do_is_equal(const memory_resource& other) const BOOST_NOEXCEPT override {
+#if !HYRISE_NUMA_SUPPORT
+    // Without NUMA support, NUMAMemoryResources allocate from this resource. Thus, containers can be moved between
+    // them without copying the elements.
+    if (dynamic_cast<const opossum::NUMAMemoryResource*>(&other)) return true;
+#endif
+    return &other == this;
+  }
 };
 
-memory_resource* get_default_resource() BOOST_NOEXCEPT {
+memory_resource* new_delete_resource() BOOST_NOEXCEPT {
   // Yes, this leaks. We have had SO many problems with the default memory resource going out of scope
   // before the other things were cleaned up that we decided to live with the leak, rather than
   // running into races over and over again.
@@ -26,7 +35,11 @@ memory_resource* get_default_resource() BOOST_NOEXCEPT {
   return default_resource_instance;
 }
 
-memory_resource* new_delete_resource() BOOST_NOEXCEPT { return get_default_resource(); }
+memory_resource* get_default_resource() BOOST_NOEXCEPT {
+  // Workers allocate the intermediates of their tasks on their NUMA node
+  if (auto* scoped_resource = opossum::ScopedDefaultMemoryResource::current()) return scoped_resource;
+  return new_delete_resource();
+}
 
 memory_resource* set_default_resource(memory_resource* r) BOOST_NOEXCEPT {
   // Do nothing
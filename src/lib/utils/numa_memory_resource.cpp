@@ -2,12 +2,18 @@
 
 #include <string>
 
+#include <boost/container/pmr/global_resource.hpp>
+
 #if HYRISE_NUMA_SUPPORT
 #define NUMA_MEMORY_RESOURCE_ARENA_SIZE 1llu << 30u
-#else
-#include <boost/container/pmr/global_resource.hpp>
 #endif
 
+namespace {
+
+thread_local boost::container::pmr::memory_resource* this_thread_default_memory_resource = nullptr;
+
+}  // namespace
+
 namespace opossum {
 
 #if HYRISE_NUMA_SUPPORT
@@ -35,12 +41,13 @@ int NUMAMemoryResource::get_node_id() const { return _memory_source.getPhysicalN
 
 NUMAMemoryResource::NUMAMemoryResource(int node_id, const std::string& name) {}
 
+// Not the default resource, as that might be this resource (see ScopedDefaultMemoryResource)
 void* NUMAMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
-  return boost::container::pmr::get_default_resource()->allocate(bytes, alignment);
+  return boost::container::pmr::new_delete_resource()->allocate(bytes, alignment);
 }
 
 void NUMAMemoryResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
-  boost::container::pmr::get_default_resource()->deallocate(p, bytes, alignment);
+  boost::container::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
 }
 
 bool NUMAMemoryResource::do_is_equal(const memory_resource& other) const noexcept { return true; }
@@ -48,4 +55,17 @@ bool NUMAMemoryResource::do_is_equal(const memory_resource& other) const noexcep
 int NUMAMemoryResource::get_node_id() const { return UNDEFINED_NODE_ID; }
 #endif
 
+ScopedDefaultMemoryResource::ScopedDefaultMemoryResource(boost::container::pmr::memory_resource* memory_resource)
+    : _previous_memory_resource(::this_thread_default_memory_resource) {
+  ::this_thread_default_memory_resource = memory_resource;
+}
+
+ScopedDefaultMemoryResource::~ScopedDefaultMemoryResource() {
+  ::this_thread_default_memory_resource = _previous_memory_resource;
+}
+
+boost::container::pmr::memory_resource* ScopedDefaultMemoryResource::current() {
+  return ::this_thread_default_memory_resource;
+}
+
 }  // namespace opossum
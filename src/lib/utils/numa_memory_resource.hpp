@@ -4,6 +4,8 @@
 #include <boost/integer/common_factor_rt.hpp>
 #include <string>
 
+#include "types.hpp"
+
 #if HYRISE_NUMA_SUPPORT
 #include <PGASUS/msource/msource.hpp>
 #endif
@@ -31,4 +33,23 @@ class NUMAMemoryResource : public boost::container::pmr::memory_resource {
 #endif
 };
 
+/**
+ * While an instance exists, boost::container::pmr::get_default_resource() returns the given resource on the calling
+ * thread. Thus, everything that is allocated with a default constructed PolymorphicAllocator (e.g., PosLists and the
+ * segments of intermediate tables) comes from that resource. Workers use this to allocate the intermediates of their
+ * tasks on their own NUMA node (see AbstractOperator::execute() and Worker::_execute()). Scopes can be nested. A scope
+ * with nullptr falls back to the global resource, e.g., for data that is stored beyond the query.
+ */
+class ScopedDefaultMemoryResource : private Noncopyable {
+ public:
+  explicit ScopedDefaultMemoryResource(boost::container::pmr::memory_resource* memory_resource);
+  ~ScopedDefaultMemoryResource();
+
+  // Returns the resource of the innermost scope on the calling thread, or nullptr if there is none
+  static boost::container::pmr::memory_resource* current();
+
+ private:
+  boost::container::pmr::memory_resource* const _previous_memory_resource;
+};
+
 }  // namespace opossum
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+namespace opossum {
+
+/*
+ * Thrown when a query is cancelled or exceeds its timeout (see QueryContext). Operators throw it at chunk boundaries
+ * to stop early. Tasks catch it, so that it never reaches a worker thread.
+ */
+class QueryCancelledException : public std::runtime_error {
+ public:
+  explicit QueryCancelledException(const std::string& what_arg) : std::runtime_error(what_arg) {}
+};
+
+}  // namespace opossum
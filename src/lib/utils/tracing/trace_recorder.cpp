@@ -0,0 +1,169 @@
+#include "trace_recorder.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <set>
+#include <utility>
+
+#include "json.hpp"
+
+#include "scheduler/task_queue.hpp"
+#include "scheduler/worker.hpp"
+
+namespace {
+
+// Identifies threads that are not workers (e.g., the main thread when the scheduler is disabled) within a trace
+std::atomic<uint32_t> next_non_worker_thread_id{0};
+thread_local uint32_t this_thread_non_worker_id = std::numeric_limits<uint32_t>::max();
+
+}  // namespace
+
+namespace opossum {
+
+void TraceRecorder::enable() {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  if (!_slots) _slots = std::make_unique<Slot[]>(CAPACITY);
+
+  _first_index = _next_index.load();
+  _epoch = std::chrono::steady_clock::now().time_since_epoch().count();
+  _enabled.store(true, std::memory_order_release);
+}
+
+void TraceRecorder::disable() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _enabled = false;
+}
+
+void TraceRecorder::record(const TraceEventCategory category, const std::string& name,
+                           const std::chrono::steady_clock::time_point begin,
+                           const std::chrono::steady_clock::time_point end, const std::optional<uint64_t> row_count) {
+  // The acquire pairs with enable() and makes _slots visible
+  if (!_enabled.load(std::memory_order_acquire)) return;
+
+  auto thread_id = uint32_t{0};
+  auto node_id = INVALID_NODE_ID;
+  if (const auto worker = Worker::get_this_thread_worker()) {
+    thread_id = worker->id();
+    node_id = worker->queue()->node_id();
+  } else {
+    if (this_thread_non_worker_id == std::numeric_limits<uint32_t>::max()) {
+      this_thread_non_worker_id = next_non_worker_thread_id++;
+    }
+    thread_id = this_thread_non_worker_id;
+  }
+
+  auto name_words = std::array<uint64_t, NAME_WORD_COUNT>{};
+  std::memcpy(name_words.data(), name.data(), std::min(name.size(), MAX_NAME_LENGTH));
+
+  const auto index = _next_index.fetch_add(1, std::memory_order_relaxed);
+  auto& slot = _slots[index % CAPACITY];
+
+  slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  slot.category.store(static_cast<uint8_t>(category), std::memory_order_relaxed);
+  for (auto word_index = size_t{0}; word_index < NAME_WORD_COUNT; ++word_index) {
+    slot.name[word_index].store(name_words[word_index], std::memory_order_relaxed);
+  }
+  slot.thread_id.store(thread_id, std::memory_order_relaxed);
+  slot.node_id.store(static_cast<uint32_t>(node_id), std::memory_order_relaxed);
+  slot.begin.store(begin.time_since_epoch().count() - _epoch.load(std::memory_order_relaxed),
+                   std::memory_order_relaxed);
+  slot.duration.store(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count(),
+                      std::memory_order_relaxed);
+  slot.row_count.store(row_count.value_or(NO_ROW_COUNT), std::memory_order_relaxed);
+
+  slot.sequence.store(2 * (index + 1), std::memory_order_release);
+}
+
+std::vector<TraceEvent> TraceRecorder::events() const {
+  auto events = std::vector<TraceEvent>{};
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (!_slots) return events;
+
+  const auto end_index = _next_index.load();
+  const auto begin_index = std::max(_first_index.load(), end_index > CAPACITY ? end_index - CAPACITY : uint64_t{0});
+  events.reserve(end_index - begin_index);
+
+  for (auto index = begin_index; index < end_index; ++index) {
+    const auto& slot = _slots[index % CAPACITY];
+
+    const auto sequence_before = slot.sequence.load(std::memory_order_acquire);
+    if (sequence_before != 2 * (index + 1)) continue;
+
+    auto event = TraceEvent{};
+    event.category = static_cast<TraceEventCategory>(slot.category.load(std::memory_order_relaxed));
+
+    auto name_words = std::array<uint64_t, NAME_WORD_COUNT>{};
+    for (auto word_index = size_t{0}; word_index < NAME_WORD_COUNT; ++word_index) {
+      name_words[word_index] = slot.name[word_index].load(std::memory_order_relaxed);
+    }
+    const auto* name_chars = reinterpret_cast<const char*>(name_words.data());
+    event.name = std::string{name_chars, strnlen(name_chars, MAX_NAME_LENGTH)};
+
+    event.thread_id = slot.thread_id.load(std::memory_order_relaxed);
+    event.node_id = NodeID{slot.node_id.load(std::memory_order_relaxed)};
+    event.begin = std::chrono::nanoseconds{slot.begin.load(std::memory_order_relaxed)};
+    event.duration = std::chrono::nanoseconds{slot.duration.load(std::memory_order_relaxed)};
+    const auto row_count = slot.row_count.load(std::memory_order_relaxed);
+    if (row_count != NO_ROW_COUNT) event.row_count = row_count;
+
+    // If the slot was overwritten in the meantime, the event might be torn
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.sequence.load(std::memory_order_relaxed) != sequence_before) continue;
+
+    events.emplace_back(std::move(event));
+  }
+
+  return events;
+}
+
+void TraceRecorder::write_chrome_trace(std::ostream& stream) const {
+  const auto events = this->events();
+
+  // Each NUMA node is shown as a process with its workers as threads. Non-worker threads are grouped in process 0.
+  const auto process_id = [](const TraceEvent& event) {
+    return event.node_id == INVALID_NODE_ID ? uint32_t{0} : static_cast<uint32_t>(event.node_id) + 1;
+  };
+
+  auto trace_events = nlohmann::json::array();
+  auto named_processes = std::set<uint32_t>{};
+  auto named_threads = std::set<std::pair<uint32_t, uint32_t>>{};
+
+  for (const auto& event : events) {
+    const auto pid = process_id(event);
+    const auto is_worker = event.node_id != INVALID_NODE_ID;
+
+    // Metadata events that name the processes and threads
+    if (named_processes.emplace(pid).second) {
+      const auto process_name = is_worker ? "Node " + std::to_string(event.node_id) : std::string{"Other threads"};
+      trace_events.push_back({{"name", "process_name"}, {"ph", "M"}, {"pid", pid}, {"args", {{"name", process_name}}}});
+    }
+    if (named_threads.emplace(pid, event.thread_id).second) {
+      const auto thread_name = (is_worker ? "Worker " : "Thread ") + std::to_string(event.thread_id);
+      trace_events.push_back({{"name", "thread_name"},
+                              {"ph", "M"},
+                              {"pid", pid},
+                              {"tid", event.thread_id},
+                              {"args", {{"name", thread_name}}}});
+    }
+
+    auto trace_event = nlohmann::json{{"name", event.name},
+                                      {"cat", event.category == TraceEventCategory::Operator ? "operator" : "task"},
+                                      {"ph", "X"},
+                                      {"pid", pid},
+                                      {"tid", event.thread_id},
+                                      // Timestamps are given in microseconds
+                                      {"ts", static_cast<double>(event.begin.count()) / 1000.0},
+                                      {"dur", static_cast<double>(event.duration.count()) / 1000.0}};
+    if (event.row_count) trace_event["args"] = {{"rows", *event.row_count}};
+
+    trace_events.push_back(std::move(trace_event));
+  }
+
+  stream << nlohmann::json{{"traceEvents", trace_events}, {"displayTimeUnit", "ms"}};
+}
+
+}  // namespace opossum
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+enum class TraceEventCategory : uint8_t { Operator, Task };
+
+// A completed span, as returned by TraceRecorder::events()
+struct TraceEvent {
+  TraceEventCategory category{TraceEventCategory::Operator};
+
+  // Truncated to TraceRecorder::MAX_NAME_LENGTH characters
+  std::string name;
+
+  // For spans recorded on a worker thread, the ID of the worker and of its node. Otherwise, thread_id identifies the
+  // (non-worker) thread and node_id is INVALID_NODE_ID.
+  uint32_t thread_id{0};
+  NodeID node_id{INVALID_NODE_ID};
+
+  // Relative to the time the recording was started
+  std::chrono::nanoseconds begin{0};
+  std::chrono::nanoseconds duration{0};
+
+  // Number of output rows of an operator
+  std::optional<uint64_t> row_count;
+};
+
+/**
+ * In-process tracer that records the execution spans of operators and JobTasks, including the worker that executed
+ * them, and exports them in the Chrome trace event format. The output can be loaded into chrome://tracing or
+ * https://ui.perfetto.dev to visualize the parallelism of a query, e.g., to find stragglers or idle workers.
+ *
+ * Unlike the DTRACE_PROBEs (see probes.hpp), this does not require external tooling. While the recording is disabled
+ * (the default), recording a span costs a single relaxed load. While it is enabled, spans are written into a ring
+ * buffer of fixed capacity without taking locks, so that the most recent CAPACITY spans are kept.
+ *
+ * Usage:
+ *   TraceRecorder::get().enable();
+ *   ... execute queries ...
+ *   TraceRecorder::get().disable();
+ *   TraceRecorder::get().write_chrome_trace(output_stream);
+ */
+class TraceRecorder : public Singleton<TraceRecorder> {
+ public:
+  static constexpr size_t CAPACITY = 1u << 16;
+  static constexpr size_t MAX_NAME_LENGTH = 32;
+
+  // Starts recording. Spans of previous recordings are discarded.
+  void enable();
+  void disable();
+
+  bool is_enabled() const { return _enabled.load(std::memory_order_relaxed); }
+
+  // Records a span on the calling thread if the recording is enabled. Can be called concurrently.
+  void record(const TraceEventCategory category, const std::string& name,
+              const std::chrono::steady_clock::time_point begin, const std::chrono::steady_clock::time_point end,
+              const std::optional<uint64_t> row_count = std::nullopt);
+
+  // Returns the recorded spans, oldest first. Spans that are overwritten while being read are skipped.
+  std::vector<TraceEvent> events() const;
+
+  // Writes the recorded spans as a JSON object in the Chrome trace event format
+  void write_chrome_trace(std::ostream& stream) const;
+
+ protected:
+  friend class Singleton;
+
+  TraceRecorder() = default;
+
+  static constexpr size_t NAME_WORD_COUNT = MAX_NAME_LENGTH / sizeof(uint64_t);
+  static constexpr uint64_t NO_ROW_COUNT = std::numeric_limits<uint64_t>::max();
+
+  // All fields are atomics, so that slots can be read while being overwritten. The sequence number tells whether a
+  // slot holds the span with a given index (2 * (index + 1)) or is being written (2 * index + 1), similar to a seqlock.
+  struct Slot {
+    std::atomic<uint64_t> sequence{0};
+    std::atomic<uint8_t> category{0};
+    std::array<std::atomic<uint64_t>, NAME_WORD_COUNT> name{};
+    std::atomic<uint32_t> thread_id{0};
+    std::atomic<uint32_t> node_id{0};
+    std::atomic<int64_t> begin{0};
+    std::atomic<int64_t> duration{0};
+    std::atomic<uint64_t> row_count{NO_ROW_COUNT};
+  };
+
+  std::atomic_bool _enabled{false};
+
+  // Allocated when the recording is enabled for the first time and never released, as threads might still be writing
+  // to it after the recording was disabled
+  std::unique_ptr<Slot[]> _slots;
+
+  // Synchronizes enable() and disable()
+  mutable std::mutex _mutex;
+
+  // Index of the next span to be written and of the first span of the current recording. Indexes are never reused,
+  // so that stale slots of previous recordings are recognized by their sequence number.
+  std::atomic<uint64_t> _next_index{0};
+  std::atomic<uint64_t> _first_index{0};
+
+  std::atomic<int64_t> _epoch{0};
+};
+
+}  // namespace opossum
@@ -2,6 +2,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -109,4 +110,59 @@ TEST_F(TransactionContextTest, CallbackFiresWhenCommitted) {
   EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
 }
 
+TEST_F(TransactionContextTest, PendingTransactionsAreCommittedAsAGroup) {
+  auto context_1 = manager().new_transaction_context();
+  auto context_2 = manager().new_transaction_context();
+  auto context_3 = manager().new_transaction_context();
+
+  const auto prev_last_commit_id = manager().last_commit_id();
+
+  // The callbacks are called once the whole group is visible
+  auto visible_commit_ids = std::vector<CommitID>{};
+  const auto callback = [&](TransactionID) { visible_commit_ids.emplace_back(manager().last_commit_id()); };
+
+  // context_2 and context_3 get their commit IDs after context_1, but are ready to commit before it
+  auto commit_op = std::make_shared<CommitFuncOp>([&]() {
+    context_2->commit_async(callback);
+    context_3->commit_async(callback);
+    EXPECT_EQ(manager().last_commit_id(), prev_last_commit_id);
+    EXPECT_EQ(context_3->phase(), TransactionPhase::Committing);
+  });
+  commit_op->set_transaction_context(context_1);
+  commit_op->execute();
+
+  context_1->commit_async(callback);
+
+  EXPECT_EQ(manager().last_commit_id(), context_3->commit_id());
+  EXPECT_EQ(visible_commit_ids, std::vector<CommitID>(3, context_3->commit_id()));
+  EXPECT_EQ(context_1->phase(), TransactionPhase::Committed);
+  EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
+  EXPECT_EQ(context_3->phase(), TransactionPhase::Committed);
+}
+
+TEST_F(TransactionContextTest, ConcurrentCommits) {
+  constexpr auto THREAD_COUNT = 8u;
+  constexpr auto COMMITS_PER_THREAD = 200u;
+
+  const auto prev_last_commit_id = manager().last_commit_id();
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0u; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&]() {
+      for (auto commit_index = 0u; commit_index < COMMITS_PER_THREAD; ++commit_index) {
+        const auto context = manager().new_transaction_context();
+        EXPECT_TRUE(context->commit());
+
+        // The transaction is visible once commit() returns
+        EXPECT_GE(manager().last_commit_id(), context->commit_id());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(manager().last_commit_id(), prev_last_commit_id + THREAD_COUNT * COMMITS_PER_THREAD);
+}
+
 }  // namespace opossum
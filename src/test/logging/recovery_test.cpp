@@ -0,0 +1,202 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_manager.hpp"
+#include "logging/recovery.hpp"
+#include "logging/redo_log.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/filesystem.hpp"
+
+namespace opossum {
+
+class RecoveryTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto table_a = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, false}}, TableType::Data, 2,
+        UseMvcc::Yes);
+    table_a->append({1, "one"});
+    table_a->append({NULL_VALUE, "null"});
+    table_a->append({3, "three"});
+    table_a->append({3, "three"});
+    StorageManager::get().add_table("table_a", table_a);
+
+    const auto table_b = std::make_shared<Table>(TableColumnDefinitions{{"x", DataType::Double, false}},
+                                                 TableType::Data, 2, UseMvcc::Yes);
+    table_b->append({1.5});
+    StorageManager::get().add_table("table_b", table_b);
+
+    filesystem::remove_all(_directory);
+  }
+
+  void TearDown() override {
+    RedoLog::get().disable();
+    filesystem::remove_all(_directory);
+  }
+
+  static std::shared_ptr<const Table> _execute(const std::string& sql) {
+    return SQLPipelineBuilder{sql}.create_pipeline().get_result_table();
+  }
+
+  // Simulates a restart of the process, returns the number of replayed transactions
+  size_t _restart_and_recover() {
+    _table_a_before_restart = _execute("SELECT * FROM table_a");
+    _table_b_before_restart = _execute("SELECT * FROM table_b");
+
+    RedoLog::get().disable();
+    StorageManager::reset();
+    TransactionManager::reset();
+    SQLPhysicalPlanCache::get().clear();
+    SQLLogicalPlanCache::get().clear();
+
+    const auto replayed_transaction_count = Recovery::recover(_directory);
+    RedoLog::get().enable(_directory);
+    return replayed_transaction_count;
+  }
+
+  void _expect_tables_recovered() {
+    EXPECT_TABLE_EQ_UNORDERED(_execute("SELECT * FROM table_a"), _table_a_before_restart);
+    EXPECT_TABLE_EQ_UNORDERED(_execute("SELECT * FROM table_b"), _table_b_before_restart);
+  }
+
+  const std::string _directory = test_data_path + "recovery_test";
+  std::shared_ptr<const Table> _table_a_before_restart;
+  std::shared_ptr<const Table> _table_b_before_restart;
+};
+
+TEST_F(RecoveryTest, RecoverWithoutCheckpointAndLog) {
+  StorageManager::reset();
+  EXPECT_EQ(Recovery::recover(_directory), 0u);
+  EXPECT_TRUE(StorageManager::get().table_names().empty());
+}
+
+TEST_F(RecoveryTest, ReplayLogOverCheckpoint) {
+  RedoLog::get().enable(_directory);
+  Recovery::write_checkpoint(_directory);
+
+  _execute("INSERT INTO table_a VALUES (4, 'four')");
+  _execute("INSERT INTO table_a VALUES (NULL, 'another null')");
+  _execute("UPDATE table_a SET b = 'four again' WHERE a = 4");
+  _execute("DELETE FROM table_a WHERE a IS NULL AND b = 'null'");
+  _execute("INSERT INTO table_b VALUES (2.5)");
+
+  EXPECT_EQ(_restart_and_recover(), 5u);
+  _expect_tables_recovered();
+
+  // The recovered tables can be modified and recovered again
+  _execute("DELETE FROM table_a WHERE a = 3");
+  _execute("INSERT INTO table_a VALUES (5, 'five')");
+
+  EXPECT_EQ(_restart_and_recover(), 7u);
+  _expect_tables_recovered();
+}
+
+TEST_F(RecoveryTest, ReplayOnlyTransactionsAfterCheckpoint) {
+  RedoLog::get().enable(_directory);
+  Recovery::write_checkpoint(_directory);
+
+  _execute("INSERT INTO table_a VALUES (4, 'four')");
+  _execute("DELETE FROM table_a WHERE a = 1");
+
+  // The new checkpoint replaces the previous one
+  Recovery::write_checkpoint(_directory);
+  EXPECT_TRUE(filesystem::exists(_directory + "/" + Recovery::CHECKPOINT_DIRECTORY));
+  EXPECT_FALSE(filesystem::exists(_directory + "/" + Recovery::TEMPORARY_CHECKPOINT_DIRECTORY));
+
+  _execute("UPDATE table_b SET x = 3.5");
+
+  EXPECT_EQ(_restart_and_recover(), 1u);
+  _expect_tables_recovered();
+}
+
+TEST_F(RecoveryTest, DeleteRowsInsertedByTheSameTransaction) {
+  RedoLog::get().enable(_directory);
+  Recovery::write_checkpoint(_directory);
+
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  SQLPipelineBuilder{"INSERT INTO table_a VALUES (3, 'three'); DELETE FROM table_a WHERE a = 3;"}
+      .with_transaction_context(transaction_context)
+      .create_pipeline()
+      .get_result_table();
+  transaction_context->commit();
+
+  EXPECT_EQ(_restart_and_recover(), 1u);
+  _expect_tables_recovered();
+  EXPECT_EQ(_execute("SELECT * FROM table_a WHERE a = 3")->row_count(), 0u);
+}
+
+TEST_F(RecoveryTest, ReplayTablesCreatedAndDroppedAfterCheckpoint) {
+  RedoLog::get().enable(_directory);
+  Recovery::write_checkpoint(_directory);
+
+  _execute("CREATE TABLE table_c (c INTEGER NULL, d VARCHAR(10) NOT NULL)");
+  _execute("INSERT INTO table_c VALUES (1, 'one')");
+  _execute("INSERT INTO table_c VALUES (NULL, 'null')");
+  _execute("DELETE FROM table_c WHERE c = 1");
+  _execute("DROP TABLE table_b");
+  _execute("INSERT INTO table_a VALUES (4, 'four')");
+  const auto table_c_before_restart = _execute("SELECT * FROM table_c");
+
+  RedoLog::get().disable();
+  StorageManager::reset();
+  TransactionManager::reset();
+  SQLPhysicalPlanCache::get().clear();
+  SQLLogicalPlanCache::get().clear();
+
+  EXPECT_EQ(Recovery::recover(_directory), 6u);
+  RedoLog::get().enable(_directory);
+
+  EXPECT_FALSE(StorageManager::get().has_table("table_b"));
+  EXPECT_EQ(StorageManager::get().get_table("table_c")->column_definitions(),
+            (TableColumnDefinitions{{"c", DataType::Int, true}, {"d", DataType::String, false}}));
+  EXPECT_TABLE_EQ_UNORDERED(_execute("SELECT * FROM table_c"), table_c_before_restart);
+  EXPECT_EQ(_execute("SELECT * FROM table_a WHERE a = 4")->row_count(), 1u);
+}
+
+TEST_F(RecoveryTest, RowsOfMissingTablesAreSkipped) {
+  RedoLog::get().enable(_directory);
+  Recovery::write_checkpoint(_directory);
+
+  // Tables that are added without CREATE TABLE are not logged
+  const auto table_c = std::make_shared<Table>(TableColumnDefinitions{{"c", DataType::Int, false}}, TableType::Data, 2,
+                                               UseMvcc::Yes);
+  StorageManager::get().add_table("table_c", table_c);
+  _execute("INSERT INTO table_c VALUES (1)");
+  _execute("INSERT INTO table_a VALUES (4, 'four')");
+
+  EXPECT_EQ(_restart_and_recover(), 2u);
+  EXPECT_FALSE(StorageManager::get().has_table("table_c"));
+  _expect_tables_recovered();
+}
+
+TEST_F(RecoveryTest, TornFrameIsRemoved) {
+  RedoLog::get().enable(_directory);
+  Recovery::write_checkpoint(_directory);
+
+  _execute("INSERT INTO table_a VALUES (4, 'four')");
+  RedoLog::get().flush();
+  const auto log_filename = _directory + "/" + RedoLog::FILE_NAME;
+  const auto log_size = filesystem::file_size(log_filename);
+
+  // Simulates a crash while the next frame is written
+  _execute("INSERT INTO table_a VALUES (5, 'five')");
+  RedoLog::get().disable();
+  filesystem::resize_file(log_filename, filesystem::file_size(log_filename) - 1);
+  _execute("DELETE FROM table_a WHERE a = 5");
+
+  EXPECT_EQ(_restart_and_recover(), 1u);
+  EXPECT_EQ(filesystem::file_size(log_filename), log_size);
+  _expect_tables_recovered();
+
+  // Frames appended after the recovery are found by the next one
+  _execute("INSERT INTO table_a VALUES (6, 'six')");
+  EXPECT_EQ(_restart_and_recover(), 2u);
+  _expect_tables_recovered();
+}
+
+}  // namespace opossum
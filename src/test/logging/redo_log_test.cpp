@@ -0,0 +1,183 @@
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "logging/redo_log.hpp"
+#include "logging/redo_log_records.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/filesystem.hpp"
+
+namespace opossum {
+
+class RedoLogTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, false}}, TableType::Data, 2,
+        UseMvcc::Yes);
+    _table->append({1, "one"});
+    _table->append({NULL_VALUE, "null"});
+    _table->append({3, ""});
+    StorageManager::get().add_table("table_a", _table);
+
+    filesystem::remove_all(_directory);
+  }
+
+  void TearDown() override {
+    RedoLog::get().disable();
+    filesystem::remove_all(_directory);
+  }
+
+  static void _execute(const std::string& sql) { SQLPipelineBuilder{sql}.create_pipeline().get_result_table(); }
+
+  std::vector<RedoLogRecord> _read_log() const {
+    auto records = std::vector<RedoLogRecord>{};
+    const auto transactions = RedoLog::read_frames(_filename, 0).first;
+    for (const auto& transaction : transactions) {
+      for (auto& record : RedoLogRecords::parse(transaction)) {
+        records.emplace_back(std::move(record));
+      }
+    }
+    return records;
+  }
+
+  std::shared_ptr<Table> _table;
+  const std::string _directory = test_data_path + "redo_log_test";
+  const std::string _filename = _directory + "/" + RedoLog::FILE_NAME;
+};
+
+TEST_F(RedoLogTest, RecordsRoundTrip) {
+  auto records = RedoLogRecords{};
+  EXPECT_TRUE(records.empty());
+
+  records.add_rows(RedoLogRecordType::Delete, "table_a", *_table, PosList{});
+  EXPECT_TRUE(records.empty());
+
+  // The rows span both chunks
+  records.add_rows(RedoLogRecordType::Insert, "table_a", *_table,
+                   PosList{RowID{ChunkID{1}, 0}, RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 0}});
+  records.add_rows(RedoLogRecordType::Delete, "table_a", *_table, PosList{RowID{ChunkID{0}, 0}});
+
+  const auto parsed_records = RedoLogRecords::parse(records.data());
+  ASSERT_EQ(parsed_records.size(), 2u);
+
+  const auto& insert_record = parsed_records[0];
+  EXPECT_EQ(insert_record.type, RedoLogRecordType::Insert);
+  EXPECT_EQ(insert_record.table_name, "table_a");
+  EXPECT_EQ(insert_record.column_data_types, std::vector<DataType>({DataType::Int, DataType::String}));
+  ASSERT_EQ(insert_record.row_images.size(), 3u);
+
+  const auto decode = [&](const std::string& row_image) {
+    return RedoLogRecords::decode_row_image(row_image, insert_record.column_data_types);
+  };
+  EXPECT_EQ(decode(insert_record.row_images[0]), std::vector<AllTypeVariant>({3, ""}));
+  const auto row_with_null = decode(insert_record.row_images[1]);
+  EXPECT_TRUE(variant_is_null(row_with_null[0]));
+  EXPECT_EQ(row_with_null[1], AllTypeVariant{"null"});
+  EXPECT_EQ(decode(insert_record.row_images[2]), std::vector<AllTypeVariant>({1, "one"}));
+
+  // Equal rows have equal images
+  EXPECT_EQ(parsed_records[1].type, RedoLogRecordType::Delete);
+  EXPECT_EQ(parsed_records[1].row_images, std::vector<std::string>({insert_record.row_images[2]}));
+
+  records.clear();
+  EXPECT_TRUE(records.empty());
+}
+
+TEST_F(RedoLogTest, CommittedTransactionsAreDurable) {
+  RedoLog::get().enable(_directory);
+  EXPECT_TRUE(RedoLog::get().is_enabled());
+
+  _execute("INSERT INTO table_a VALUES (4, 'four')");
+
+  // commit() only returns once the transaction has been flushed
+  EXPECT_GT(RedoLog::get().appended_position(), 0u);
+  EXPECT_EQ(RedoLog::get().durable_position(), RedoLog::get().appended_position());
+  EXPECT_EQ(filesystem::file_size(_filename), RedoLog::get().durable_position());
+
+  _execute("UPDATE table_a SET b = 'three' WHERE a = 3");
+  _execute("DELETE FROM table_a WHERE a = 1");
+
+  // Read-only transactions are not logged
+  const auto position = RedoLog::get().appended_position();
+  _execute("SELECT * FROM table_a");
+  EXPECT_EQ(RedoLog::get().appended_position(), position);
+
+  const auto transactions = RedoLog::read_frames(_filename, 0);
+  EXPECT_EQ(transactions.first.size(), 3u);
+  EXPECT_EQ(transactions.second, position);
+
+  // An update is logged as a delete and an insert
+  const auto records = _read_log();
+  ASSERT_EQ(records.size(), 4u);
+  EXPECT_EQ(records[0].type, RedoLogRecordType::Insert);
+  EXPECT_EQ(records[1].type, RedoLogRecordType::Delete);
+  EXPECT_EQ(records[2].type, RedoLogRecordType::Insert);
+  EXPECT_EQ(RedoLogRecords::decode_row_image(records[2].row_images.at(0), records[2].column_data_types),
+            std::vector<AllTypeVariant>({3, "three"}));
+  EXPECT_EQ(records[3].type, RedoLogRecordType::Delete);
+  EXPECT_EQ(RedoLogRecords::decode_row_image(records[3].row_images.at(0), records[3].column_data_types),
+            std::vector<AllTypeVariant>({1, "one"}));
+}
+
+TEST_F(RedoLogTest, RolledBackTransactionsAreNotLogged) {
+  RedoLog::get().enable(_directory);
+
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  SQLPipelineBuilder{"INSERT INTO table_a VALUES (5, 'five')"}
+      .with_transaction_context(transaction_context)
+      .create_pipeline()
+      .get_result_table();
+  transaction_context->rollback();
+
+  EXPECT_EQ(RedoLog::get().appended_position(), 0u);
+  EXPECT_TRUE(_read_log().empty());
+}
+
+TEST_F(RedoLogTest, AppendsToExistingLog) {
+  RedoLog::get().enable(_directory);
+  _execute("INSERT INTO table_a VALUES (4, 'four')");
+  RedoLog::get().disable();
+
+  const auto file_size = filesystem::file_size(_filename);
+
+  RedoLog::get().enable(_directory);
+  EXPECT_EQ(RedoLog::get().appended_position(), file_size);
+  _execute("INSERT INTO table_a VALUES (5, 'five')");
+  RedoLog::get().disable();
+
+  EXPECT_EQ(_read_log().size(), 2u);
+  EXPECT_EQ(RedoLog::read_frames(_filename, file_size).first.size(), 1u);
+}
+
+TEST_F(RedoLogTest, ReadingStopsAtTornFrame) {
+  RedoLog::get().enable(_directory);
+  _execute("INSERT INTO table_a VALUES (4, 'four')");
+  _execute("INSERT INTO table_a VALUES (5, 'five')");
+  RedoLog::get().disable();
+
+  const auto file_size = filesystem::file_size(_filename);
+  filesystem::resize_file(_filename, file_size - 1);
+
+  const auto [transactions, end_position] = RedoLog::read_frames(_filename, 0);
+  EXPECT_EQ(transactions.size(), 1u);
+  EXPECT_LT(end_position, file_size - 1);
+
+  // A corrupted frame is detected by its checksum
+  {
+    std::fstream file{_filename, std::ios::binary | std::ios::in | std::ios::out};
+    file.seekp(static_cast<std::streamoff>(end_position) - 1);
+    file.put('\xff');
+  }
+  EXPECT_TRUE(RedoLog::read_frames(_filename, 0).first.empty());
+}
+
+}  // namespace opossum
@@ -83,6 +83,10 @@ TEST_F(JoinNodeTest, Equals) {
   EXPECT_NE(*other_join_node_b, *_inner_join_node);
   EXPECT_NE(*other_join_node_c, *_inner_join_node);
   EXPECT_EQ(*other_join_node_d, *_inner_join_node);
+
+  // The choice of the JoinIndex is part of the node, so that plans with and without it are not mixed up
+  other_join_node_d->join_type = JoinType::Index;
+  EXPECT_NE(*other_join_node_d, *_inner_join_node);
 }
 
 TEST_F(JoinNodeTest, Copy) {
@@ -90,6 +94,11 @@ TEST_F(JoinNodeTest, Copy) {
   EXPECT_EQ(*_inner_join_node, *_inner_join_node->deep_copy());
   EXPECT_EQ(*_semi_join_node, *_semi_join_node->deep_copy());
   EXPECT_EQ(*_anti_join_node, *_anti_join_node->deep_copy());
+
+  _inner_join_node->join_type = JoinType::Index;
+  const auto copy = std::static_pointer_cast<JoinNode>(_inner_join_node->deep_copy());
+  EXPECT_EQ(copy->join_type, JoinType::Index);
+  EXPECT_EQ(*_inner_join_node, *copy);
 }
 
 TEST_F(JoinNodeTest, OutputColumnReferencesSemiJoin) {
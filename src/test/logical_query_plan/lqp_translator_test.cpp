@@ -27,10 +27,12 @@
 #include "logical_query_plan/sort_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
 #include "operators/aggregate.hpp"
 #include "operators/get_table.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
@@ -43,8 +45,12 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/union_positions.hpp"
+#include "operators/validate.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/hash/hash_index.hpp"
 #include "storage/prepared_plan.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/load_table.hpp"
@@ -93,6 +99,10 @@ class LQPTranslatorTest : public BaseTest {
     return index_scan->_included_chunk_ids;
   }
 
+  SegmentIndexType get_index_type(const std::shared_ptr<const IndexScan>& index_scan) {
+    return index_scan->_index_type;
+  }
+
   const std::vector<ChunkID> get_excluded_chunk_ids(const std::shared_ptr<const TableScan>& table_scan) {
     return table_scan->_excluded_chunk_ids;
   }
@@ -506,6 +516,148 @@ TEST_F(LQPTranslatorTest, PredicateNodeBinaryIndexScan) {
   EXPECT_EQ(*table_scan_op->predicate(), *between_(b, 42, 1337));
 }
 
+TEST_F(LQPTranslatorTest, PredicateNodeHashIndexScanIn) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+
+  const auto table = StorageManager::get().get_table("int_float_chunked");
+  table->create_index<GroupKeyIndex>({ColumnID{1}});
+  table->create_index<HashIndex>({ColumnID{1}});
+
+  auto predicate_node = PredicateNode::make(in_(stored_table_node->get_column("b"), list_(42, 1337)));
+  predicate_node->set_left_input(stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+  const auto op = LQPTranslator{}.translate_node(predicate_node);
+
+  /**
+   * Check PQP - the HashIndex is preferred for IN
+   */
+  const auto index_scan_op = std::dynamic_pointer_cast<const IndexScan>(op->input_left());
+  ASSERT_TRUE(index_scan_op);
+  EXPECT_EQ(get_index_type(index_scan_op), SegmentIndexType::Hash);
+  EXPECT_EQ(get_included_chunk_ids(index_scan_op).size(), table->chunk_count());
+}
+
+TEST_F(LQPTranslatorTest, PredicateNodeIndexScanBelowValidate) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+  StorageManager::get().get_table("int_float_chunked")->create_table_index(ColumnID{1});
+
+  const auto validate_node = ValidateNode::make(stored_table_node);
+  auto predicate_node = PredicateNode::make(equals_(stored_table_node->get_column("b"), 42), validate_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+  const auto op = LQPTranslator{}.translate_node(predicate_node);
+
+  /**
+   * Check PQP - the Validate is executed on the result of the IndexScan. With a table index, no TableScan is needed.
+   */
+  const auto validate_op = std::dynamic_pointer_cast<Validate>(op);
+  ASSERT_TRUE(validate_op);
+
+  const auto index_scan_op = std::dynamic_pointer_cast<const IndexScan>(op->input_left());
+  ASSERT_TRUE(index_scan_op);
+  EXPECT_EQ(index_scan_op->input_left()->type(), OperatorType::GetTable);
+}
+
+TEST_F(LQPTranslatorTest, PredicateNodeIndexScanWithPrunedChunks) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+  stored_table_node->set_excluded_chunk_ids({ChunkID{0}});
+  const auto table = StorageManager::get().get_table("int_float_chunked");
+  table->create_table_index(ColumnID{0});
+  table->get_chunk(ChunkID{2})->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+
+  auto predicate_node = PredicateNode::make(greater_than_(stored_table_node->get_column("a"), 200), stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+  const auto op = LQPTranslator{}.translate_node(predicate_node);
+
+  /**
+   * Check PQP - GetTable does not output the table index of the pruned table, so the chunk index is used. Chunk 2 of
+   * the stored table is the second chunk of the pruned one.
+   */
+  ASSERT_TRUE(std::dynamic_pointer_cast<UnionPositions>(op));
+  ASSERT_TRUE(std::dynamic_pointer_cast<const IndexScan>(op->input_left()));
+  ASSERT_TRUE(std::dynamic_pointer_cast<const TableScan>(op->input_right()));
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(op, CleanupTemporaries::Yes);
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  EXPECT_EQ(op->get_output()->row_count(), 1u);
+}
+
+TEST_F(LQPTranslatorTest, IndexOnlyScanForCountStar) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+  StorageManager::get().get_table("int_float_chunked")->create_table_index(ColumnID{1});
+
+  auto predicate_node = PredicateNode::make(less_than_(stored_table_node->get_column("b"), 42), stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+  const auto aggregate_node =
+      AggregateNode::make(expression_vector(), expression_vector(count_star_()), predicate_node);
+  const auto op = LQPTranslator{}.translate_node(aggregate_node);
+
+  /**
+   * Check PQP - the count is taken from the index, no Aggregate is needed
+   */
+  const auto index_scan_op = std::dynamic_pointer_cast<const IndexScan>(op);
+  ASSERT_TRUE(index_scan_op);
+  EXPECT_EQ(index_scan_op->output(), IndexScanOutput::Count);
+  EXPECT_EQ(index_scan_op->input_left()->type(), OperatorType::GetTable);
+}
+
+TEST_F(LQPTranslatorTest, IndexOnlyScanForProjectionOfScannedColumn) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+  const auto table = StorageManager::get().get_table("int_float_chunked");
+  table->create_index<GroupKeyIndex>({ColumnID{1}});
+  const auto b = stored_table_node->get_column("b");
+
+  auto predicate_node = PredicateNode::make(equals_(b, 42), stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+  const auto projection_node = ProjectionNode::make(expression_vector(b), predicate_node);
+  const auto op = LQPTranslator{}.translate_node(projection_node);
+
+  /**
+   * Check PQP - all chunks are indexed, so the values of the equality predicate can be taken from the chunk indexes
+   */
+  const auto index_scan_op = std::dynamic_pointer_cast<const IndexScan>(op);
+  ASSERT_TRUE(index_scan_op);
+  EXPECT_EQ(index_scan_op->output(), IndexScanOutput::Values);
+}
+
+TEST_F(LQPTranslatorTest, NoIndexOnlyScanBelowValidate) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+  StorageManager::get().get_table("int_float_chunked")->create_table_index(ColumnID{1});
+
+  const auto validate_node = ValidateNode::make(stored_table_node);
+  auto predicate_node = PredicateNode::make(equals_(stored_table_node->get_column("b"), 42), validate_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+  const auto aggregate_node =
+      AggregateNode::make(expression_vector(), expression_vector(count_star_()), predicate_node);
+  const auto op = LQPTranslator{}.translate_node(aggregate_node);
+
+  /**
+   * Check PQP - the index does not know which rows are visible, so the rows are validated and counted as usual
+   */
+  ASSERT_TRUE(std::dynamic_pointer_cast<Aggregate>(op));
+  ASSERT_TRUE(std::dynamic_pointer_cast<const Validate>(op->input_left()));
+  const auto index_scan_op = std::dynamic_pointer_cast<const IndexScan>(op->input_left()->input_left());
+  ASSERT_TRUE(index_scan_op);
+  EXPECT_EQ(index_scan_op->output(), IndexScanOutput::Positions);
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeIndexScanFailsWhenNotApplicable) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
 
@@ -563,6 +715,24 @@ TEST_F(LQPTranslatorTest, JoinNode) {
   EXPECT_EQ(join_op->mode(), JoinMode::Outer);
 }
 
+TEST_F(LQPTranslatorTest, JoinNodeIndexJoin) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  auto join_node = JoinNode::make(JoinMode::Left, equals_(int_float_b, int_float2_a), int_float_node, int_float2_node);
+  join_node->join_type = JoinType::Index;
+  const auto op = LQPTranslator{}.translate_node(join_node);
+
+  /**
+   * Check PQP
+   */
+  const auto join_op = std::dynamic_pointer_cast<JoinIndex>(op);
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->column_ids(), ColumnIDPair(ColumnID{1}, ColumnID{0}));
+  EXPECT_EQ(join_op->predicate_condition(), PredicateCondition::Equals);
+  EXPECT_EQ(join_op->mode(), JoinMode::Left);
+}
+
 TEST_F(LQPTranslatorTest, ShowTablesNode) {
   /**
    * Build LQP and translate to PQP
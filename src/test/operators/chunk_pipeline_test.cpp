@@ -0,0 +1,271 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "expression/expression_functional.hpp"
+#include "operators/aggregate.hpp"
+#include "operators/chunk_pipeline.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/table.hpp"
+#include "utils/numa_memory_resource.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace {
+
+// Tracks how many bytes are allocated from it at the same time
+class PeakTrackingMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  size_t peak_allocated_bytes{0};
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    _allocated_bytes += bytes;
+    peak_allocated_bytes = std::max(peak_allocated_bytes, _allocated_bytes);
+    return boost::container::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override {
+    _allocated_bytes -= bytes;
+    boost::container::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  }
+
+  bool do_is_equal(const memory_resource& other) const noexcept override { return &other == this; }
+
+  size_t _allocated_bytes{0};
+};
+
+}  // namespace
+
+namespace opossum {
+
+class ChunkPipelineTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float4.tbl", 2));
+    _table_wrapper->execute();
+
+    _a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+    _b = pqp_column_(ColumnID{1}, DataType::Float, false, "b");
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<AbstractExpression> _a, _b;
+};
+
+TEST_F(ChunkPipelineTest, IsPipelineable) {
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_a, 200));
+  const auto projection = std::make_shared<Projection>(table_scan, expression_vector(_b, add_(_a, 1)));
+  const auto aggregate = std::make_shared<Aggregate>(projection, std::vector<AggregateColumnDefinition>{},
+                                                     std::vector<ColumnID>{ColumnID{0}});
+
+  EXPECT_TRUE(ChunkPipeline::is_pipelineable(*table_scan));
+  EXPECT_TRUE(ChunkPipeline::is_pipelineable(*projection));
+  EXPECT_TRUE(ChunkPipeline::is_pipelineable(Validate{table_scan}));
+  EXPECT_FALSE(ChunkPipeline::is_pipelineable(*_table_wrapper));
+  EXPECT_FALSE(ChunkPipeline::is_pipelineable(*aggregate));
+
+  // Subqueries would be executed once per chunk
+  const auto subquery_scan =
+      std::make_shared<TableScan>(_table_wrapper, equals_(_a, pqp_subquery_(projection, DataType::Float, false)));
+  EXPECT_FALSE(ChunkPipeline::is_pipelineable(*subquery_scan));
+}
+
+TEST_F(ChunkPipelineTest, CollectsChain) {
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_a, 200));
+  const auto projection = std::make_shared<Projection>(table_scan, expression_vector(_b));
+
+  const auto pipeline = ChunkPipeline{projection};
+  EXPECT_EQ(pipeline.operators(), std::vector<std::shared_ptr<AbstractOperator>>({projection, table_scan}));
+  EXPECT_EQ(pipeline.source(), _table_wrapper);
+
+  EXPECT_THROW(ChunkPipeline{_table_wrapper}, std::logic_error);
+}
+
+TEST_F(ChunkPipelineTest, SameResultAsOperatorExecution) {
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_a, 200));
+  const auto table_scan_b = std::make_shared<TableScan>(table_scan, less_than_(_b, 800.0f));
+  const auto projection = std::make_shared<Projection>(table_scan_b, expression_vector(_b, add_(_a, 1)));
+
+  const auto pipelined_result = ChunkPipeline{projection}.execute();
+
+  const auto expected_table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_a, 200));
+  const auto expected_table_scan_b = std::make_shared<TableScan>(expected_table_scan, less_than_(_b, 800.0f));
+  const auto expected_projection =
+      std::make_shared<Projection>(expected_table_scan_b, expression_vector(_b, add_(_a, 1)));
+  expected_table_scan->execute();
+  expected_table_scan_b->execute();
+  expected_projection->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(pipelined_result, expected_projection->get_output());
+
+  // The plan itself was not executed, only its source
+  EXPECT_EQ(projection->get_output(), nullptr);
+  EXPECT_EQ(table_scan->get_output(), nullptr);
+}
+
+TEST_F(ChunkPipelineTest, EmptyResult) {
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_a, 1'000'000));
+  const auto projection = std::make_shared<Projection>(table_scan, expression_vector(_b));
+
+  const auto result = ChunkPipeline{projection}.execute();
+  EXPECT_EQ(result->row_count(), 0u);
+  EXPECT_EQ(result->column_count(), 1u);
+  EXPECT_EQ(result->column_data_type(ColumnID{0}), DataType::Float);
+}
+
+TEST_F(ChunkPipelineTest, ConsumerIsCalledPerBatch) {
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_a, 200));
+
+  auto pipeline = ChunkPipeline{table_scan};
+  EXPECT_EQ(pipeline.min_batch_size(), ChunkPipeline::DEFAULT_MIN_BATCH_SIZE);
+
+  // Batches hold at least three rows, i.e., two chunks. The input chunks are [12345, 123456], [12345, 123456],
+  // [123, 12], and [123456]. Empty results are not passed on. The batches are consumed in order.
+  pipeline.set_min_batch_size(3);
+  auto batch_row_counts = std::vector<size_t>{};
+  pipeline.execute([&](const auto& batch_result) { batch_row_counts.emplace_back(batch_result->row_count()); });
+  EXPECT_EQ(batch_row_counts, std::vector<size_t>({4u, 1u}));
+
+  // With batches of single chunks, the third chunk has an empty result
+  pipeline.set_min_batch_size(1);
+  batch_row_counts.clear();
+  pipeline.execute([&](const auto& batch_result) {
+    EXPECT_EQ(batch_result->chunk_count(), 1u);
+    batch_row_counts.emplace_back(batch_result->row_count());
+  });
+  EXPECT_EQ(batch_row_counts.size(), 3u);
+}
+
+TEST_F(ChunkPipelineTest, ChainEndsAtPipelineBreakers) {
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_a, 200));
+  const auto validate = std::make_shared<Validate>(table_scan);
+  const auto projection = std::make_shared<Projection>(validate, expression_vector(_b));
+
+  const auto pipeline = ChunkPipeline{projection, {table_scan}};
+  EXPECT_EQ(pipeline.operators(), std::vector<std::shared_ptr<AbstractOperator>>({projection, validate}));
+  EXPECT_EQ(pipeline.source(), table_scan);
+}
+
+TEST_F(ChunkPipelineTest, ExecuteIntoRoot) {
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_a, 200));
+  const auto projection = std::make_shared<Projection>(table_scan, expression_vector(_b));
+
+  ChunkPipeline{projection}.execute_into_root();
+  ASSERT_TRUE(projection->get_output());
+  EXPECT_EQ(projection->get_output()->row_count(), 5u);
+  EXPECT_EQ(table_scan->get_output(), nullptr);
+}
+
+TEST_F(ChunkPipelineTest, ValidateReferencesOriginalRows) {
+  const auto table = load_table("resources/test_data/tbl/validate_input.tbl", 2);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      mvcc_data->begin_cids[chunk_offset] = 0u;
+      mvcc_data->end_cids[chunk_offset] = MvccData::MAX_COMMIT_ID;
+    }
+  }
+  // Deletes the row (7, 8, 9) with CommitID 2
+  table->get_chunk(ChunkID{1})->get_scoped_mvcc_data_lock()->end_cids[0] = 2u;
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  const auto validate = std::make_shared<Validate>(table_wrapper);
+  const auto projection = std::make_shared<Projection>(
+      validate, expression_vector(pqp_column_(ColumnID{0}, DataType::Int, false, "a")));
+  const auto transaction_context = std::make_shared<TransactionContext>(1u, 3u);
+  projection->set_transaction_context_recursively(transaction_context);
+
+  const auto result = ChunkPipeline{projection}.execute();
+
+  const auto expected = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data);
+  expected->append({1});
+  expected->append({4});
+  expected->append({11});
+  EXPECT_TABLE_EQ_UNORDERED(result, expected);
+}
+
+TEST_F(ChunkPipelineTest, KeepsChunkOrderWithScheduler) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 10);
+  for (auto value = 0; value < 1'000; ++value) {
+    table->append({value});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(a, 0));
+  const auto projection = std::make_shared<Projection>(table_scan, expression_vector(a));
+  auto pipeline = ChunkPipeline{projection};
+  pipeline.set_min_batch_size(10);
+  const auto result = pipeline.execute();
+
+  CurrentScheduler::get()->finish();
+
+  EXPECT_EQ(result->chunk_count(), table->chunk_count());
+  EXPECT_TABLE_EQ_ORDERED(result, table);
+}
+
+TEST_F(ChunkPipelineTest, ReducesPeakIntermediateSize) {
+  // The first scan passes almost all rows, the second one only a few. Executed operator by operator, the PosLists of
+  // the first scan cover the whole table before the second scan starts. In the pipeline, they exist for a single batch
+  // at a time and the second scan does not reference them.
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 1'000);
+  for (auto value = 0; value < 100'000; ++value) {
+    table->append({value});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+
+  const auto create_plan = [&]() {
+    const auto table_scan = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(a, 10));
+    return std::make_shared<TableScan>(table_scan, less_than_(a, 100));
+  };
+
+  // Declared first, so that the resources outlive the results allocated from them
+  auto operator_memory_resource = PeakTrackingMemoryResource{};
+  auto pipeline_memory_resource = PeakTrackingMemoryResource{};
+
+  auto operator_result = std::shared_ptr<const Table>{};
+  {
+    const auto memory_resource_scope = ScopedDefaultMemoryResource{&operator_memory_resource};
+    const auto plan = create_plan();
+    plan->mutable_input_left()->execute();
+    plan->execute();
+    operator_result = plan->get_output();
+  }
+
+  auto pipeline_result = std::shared_ptr<const Table>{};
+  {
+    const auto memory_resource_scope = ScopedDefaultMemoryResource{&pipeline_memory_resource};
+    auto pipeline = ChunkPipeline{create_plan()};
+    pipeline.set_min_batch_size(1'000);
+    pipeline_result = pipeline.execute();
+  }
+
+  EXPECT_TABLE_EQ_ORDERED(pipeline_result, operator_result);
+
+  // The PosLists of the first scan alone take 800 KB when the whole table is scanned at once
+  EXPECT_GT(operator_memory_resource.peak_allocated_bytes, 99'000 * sizeof(RowID));
+  EXPECT_LT(pipeline_memory_resource.peak_allocated_bytes * 10, operator_memory_resource.peak_allocated_bytes);
+}
+
+}  // namespace opossum
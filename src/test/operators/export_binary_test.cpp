@@ -10,9 +10,13 @@
 
 #include "import_export/binary.hpp"
 #include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
@@ -371,4 +375,66 @@ TEST_F(OperatorsExportBinaryTest, AllTypesDictionaryNullValues) {
   EXPECT_TRUE(compare_files("resources/test_data/bin/AllTypesDictionaryNullValues.bin", filename));
 }
 
+TEST_F(OperatorsExportBinaryTest, IndexesAreImported) {
+  table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+  ChunkEncoder::encode_all_chunks(table);
+  table->create_index<GroupKeyIndex>({ColumnID{0}}, "group_key_on_a");
+  table->create_index<BTreeIndex>({ColumnID{1}});
+  table->create_table_index(ColumnID{1});
+
+  ExportBinary::write_binary(*table, filename);
+  const auto imported_table = ImportBinary::read_binary(filename);
+
+  EXPECT_TABLE_EQ_ORDERED(imported_table, table);
+
+  const auto indexes = imported_table->get_indexes();
+  ASSERT_EQ(indexes.size(), 2u);
+  EXPECT_EQ(indexes[0].type, SegmentIndexType::GroupKey);
+  EXPECT_EQ(indexes[0].name, "group_key_on_a");
+  EXPECT_EQ(indexes[0].column_ids, std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(indexes[1].type, SegmentIndexType::BTree);
+  EXPECT_EQ(indexes[1].column_ids, std::vector<ColumnID>{ColumnID{1}});
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < imported_table->chunk_count(); ++chunk_id) {
+    const auto chunk = imported_table->get_chunk(chunk_id);
+
+    // The GroupKeyIndexes are loaded from the file, not rebuilt, and thus there is exactly one per chunk
+    ASSERT_EQ(chunk->get_indices(std::vector<ColumnID>{ColumnID{0}}).size(), 1u);
+    const auto index = std::static_pointer_cast<GroupKeyIndex>(
+        chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}));
+    const auto original_index = std::static_pointer_cast<GroupKeyIndex>(
+        table->get_chunk(chunk_id)->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}));
+    ASSERT_TRUE(index);
+    EXPECT_EQ(index->index_offsets(), original_index->index_offsets());
+    EXPECT_EQ(index->index_postings(), original_index->index_postings());
+
+    EXPECT_TRUE(chunk->get_index(SegmentIndexType::BTree, std::vector<ColumnID>{ColumnID{1}}));
+  }
+
+  ASSERT_TRUE(imported_table->get_table_index(ColumnID{1}));
+  EXPECT_EQ(imported_table->get_table_index(ColumnID{1})->size(), table->row_count());
+}
+
+TEST_F(OperatorsExportBinaryTest, SortOrdersAreImported) {
+  table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::Float}}, TableType::Data,
+                                  3);
+  for (const auto value : {1, 2, 3, 6, 5, 4, 7}) {
+    table->append({value, static_cast<float>(value)});
+  }
+  table->get_chunk(ChunkID{0})->set_ordered_by({ColumnID{1}, OrderByMode::Ascending});
+  table->get_chunk(ChunkID{1})->set_ordered_by({ColumnID{0}, OrderByMode::DescendingNullsLast});
+
+  ExportBinary::write_binary(*table, filename);
+  const auto imported_table = ImportBinary::read_binary(filename);
+
+  EXPECT_TABLE_EQ_ORDERED(imported_table, table);
+  ASSERT_EQ(imported_table->chunk_count(), 3u);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < imported_table->chunk_count(); ++chunk_id) {
+    const auto& ordered_by = imported_table->get_chunk(chunk_id)->ordered_by();
+    EXPECT_EQ(ordered_by, table->get_chunk(chunk_id)->ordered_by());
+    EXPECT_EQ(imported_table->get_chunk(chunk_id)->is_mutable(), !ordered_by);
+  }
+}
+
 }  // namespace opossum
@@ -14,6 +14,9 @@
 #include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/hash/hash_index.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -125,6 +128,48 @@ TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanOnDataTable) {
   }
 }
 
+TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanUsingTableIndex) {
+  // The table has no chunk indexes. Thus, the scan can only succeed if it uses the table index.
+  const auto table = load_table("resources/test_data/tbl/int_int_shuffled.tbl", 7);
+  table->create_table_index(ColumnID{0});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{4}};
+  const auto right_values2 = std::vector<AllTypeVariant>{AllTypeVariant{9}};
+
+  std::map<PredicateCondition, std::vector<AllTypeVariant>> tests;
+  tests[PredicateCondition::Equals] = {104, 104};
+  tests[PredicateCondition::NotEquals] = {100, 102, 106, 108, 110, 112, 100, 102, 106, 108, 110, 112};
+  tests[PredicateCondition::LessThan] = {100, 102, 100, 102};
+  tests[PredicateCondition::GreaterThanEquals] = {104, 106, 108, 110, 112, 104, 106, 108, 110, 112};
+  tests[PredicateCondition::Between] = {104, 106, 108, 104, 106, 108};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<IndexScan>(table_wrapper, this->_index_type, this->_column_ids, test.first,
+                                            right_values, right_values2);
+    scan->execute();
+
+    const auto output = scan->get_output();
+    this->ASSERT_COLUMN_EQ(output, ColumnID{1u}, test.second);
+
+    // There is (at most) one output chunk per input chunk
+    EXPECT_LE(output->chunk_count(), table->chunk_count());
+    for (auto chunk_id = ChunkID{0u}; chunk_id < output->chunk_count(); ++chunk_id) {
+      const auto segment =
+          std::static_pointer_cast<const ReferenceSegment>(output->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+      EXPECT_TRUE(segment->pos_list()->references_single_chunk());
+    }
+  }
+
+  // Restricting the scan to some chunks also works with a table index
+  auto scan = std::make_shared<IndexScan>(table_wrapper, this->_index_type, this->_column_ids,
+                                          PredicateCondition::Equals, right_values);
+  scan->set_included_chunk_ids({ChunkID{1u}});
+  scan->execute();
+  this->ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1u}, {104});
+}
+
 TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanValueGreaterThanMaxDictionaryValue) {
   const auto all_rows =
       std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 100, 102, 104, 106, 108, 110, 112};
@@ -214,6 +259,68 @@ TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanOnlySomeChunks) {
   }
 }
 
+TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanIn) {
+  // Duplicates in the list do not lead to duplicate matches, values that do not occur are skipped
+  const auto right_values = std::vector<AllTypeVariant>{4, 6, 4, 99};
+
+  auto scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids, PredicateCondition::In,
+                                          right_values);
+  scan->execute();
+  this->ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1u}, {104, 104, 106, 106});
+}
+
+TYPED_TEST(OperatorsIndexScanTest, IndexOnlyCount) {
+  std::map<PredicateCondition, int64_t> tests;
+  tests[PredicateCondition::Equals] = 2;
+  tests[PredicateCondition::NotEquals] = 12;
+  tests[PredicateCondition::LessThan] = 4;
+  tests[PredicateCondition::Between] = 6;
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids, test.first,
+                                            std::vector<AllTypeVariant>{4}, std::vector<AllTypeVariant>{9});
+    scan->set_output(IndexScanOutput::Count);
+    scan->execute();
+
+    const auto output = scan->get_output();
+    EXPECT_EQ(output->column_name(ColumnID{0}), "COUNT(*)");
+    ASSERT_EQ(output->row_count(), 1u);
+    EXPECT_EQ(output->template get_value<int64_t>(ColumnID{0}, 0u), test.second);
+  }
+}
+
+TYPED_TEST(OperatorsIndexScanTest, IndexOnlyValues) {
+  auto scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids, PredicateCondition::In,
+                                          std::vector<AllTypeVariant>{4, 6, 4, 99});
+  scan->set_output(IndexScanOutput::Values);
+  scan->execute();
+
+  const auto output = scan->get_output();
+  EXPECT_EQ(output->column_count(), 1u);
+  EXPECT_EQ(output->column_name(ColumnID{0}), "a");
+  this->ASSERT_COLUMN_EQ(output, ColumnID{0u}, {4, 4, 6, 6});
+}
+
+TYPED_TEST(OperatorsIndexScanTest, IndexOnlyUsingTableIndex) {
+  // Using a table index, the values of range predicates can be returned as well
+  const auto table = load_table("resources/test_data/tbl/int_int_shuffled.tbl", 7);
+  table->create_table_index(ColumnID{0});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto values_scan = std::make_shared<IndexScan>(table_wrapper, this->_index_type, this->_column_ids,
+                                                 PredicateCondition::GreaterThan, std::vector<AllTypeVariant>{8});
+  values_scan->set_output(IndexScanOutput::Values);
+  values_scan->execute();
+  this->ASSERT_COLUMN_EQ(values_scan->get_output(), ColumnID{0u}, {10, 10, 12, 12});
+
+  auto count_scan = std::make_shared<IndexScan>(table_wrapper, this->_index_type, this->_column_ids,
+                                                PredicateCondition::In, std::vector<AllTypeVariant>{0, 2, 0});
+  count_scan->set_output(IndexScanOutput::Count);
+  count_scan->execute();
+  EXPECT_EQ(count_scan->get_output()->template get_value<int64_t>(ColumnID{0}, 0u), 4);
+}
+
 TYPED_TEST(OperatorsIndexScanTest, OperatorName) {
   const auto right_values = std::vector<AllTypeVariant>(this->_column_ids.size(), AllTypeVariant{0});
 
@@ -231,4 +338,38 @@ TYPED_TEST(OperatorsIndexScanTest, InvalidIndexTypeThrows) {
   EXPECT_THROW(scan->execute(), std::logic_error);
 }
 
+// The HashIndex only supports equality predicates and is thus not part of DerivedIndices
+class OperatorsIndexScanHashTest : public OperatorsIndexScanTest<HashIndex> {};
+
+TEST_F(OperatorsIndexScanHashTest, SingleColumnScanOnDataTable) {
+  std::map<PredicateCondition, std::vector<AllTypeVariant>> tests;
+  tests[PredicateCondition::Equals] = {104, 104};
+  tests[PredicateCondition::NotEquals] = {100, 102, 106, 108, 110, 112, 100, 102, 106, 108, 110, 112};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<IndexScan>(_int_int, _index_type, _column_ids, test.first,
+                                            std::vector<AllTypeVariant>{4});
+    scan->execute();
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1u}, test.second);
+
+    auto scan_small_chunk = std::make_shared<IndexScan>(_int_int_small_chunk, _index_type, _column_ids, test.first,
+                                                        std::vector<AllTypeVariant>{4});
+    scan_small_chunk->execute();
+    ASSERT_COLUMN_EQ(scan_small_chunk->get_output(), ColumnID{1u}, test.second);
+  }
+}
+
+TEST_F(OperatorsIndexScanHashTest, SingleColumnScanIn) {
+  auto scan = std::make_shared<IndexScan>(_int_int_small_chunk, _index_type, _column_ids, PredicateCondition::In,
+                                          std::vector<AllTypeVariant>{4, 6, 99});
+  scan->execute();
+  ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1u}, {104, 104, 106, 106});
+}
+
+TEST_F(OperatorsIndexScanHashTest, RangePredicateThrows) {
+  auto scan = std::make_shared<IndexScan>(_int_int, _index_type, _column_ids, PredicateCondition::LessThan,
+                                          std::vector<AllTypeVariant>{4});
+  EXPECT_THROW(scan->execute(), std::logic_error);
+}
+
 }  // namespace opossum
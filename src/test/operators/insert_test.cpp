@@ -14,6 +14,8 @@
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/partitioning/hash_partition_schema.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 
@@ -282,4 +284,97 @@ TEST_F(OperatorsInsertTest, InsertIntoEmptyTable) {
   EXPECT_TABLE_EQ_ORDERED(target_table, table_int_float)
 }
 
+TEST_F(OperatorsInsertTest, InsertIntoPartitionedTable) {
+  const auto target_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}},
+                                                    TableType::Data, 3, UseMvcc::Yes);
+  const auto partition_schema = std::make_shared<HashPartitionSchema>(ColumnID{0}, DataType::Int, PartitionID{2});
+  target_table->set_partition_schema(partition_schema);
+  StorageManager::get().add_table("target_table", target_table);
+
+  // 10 rows
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/10_ints.tbl"));
+  table_wrapper->execute();
+
+  const auto insert = std::make_shared<Insert>("target_table", table_wrapper);
+  auto context = TransactionManager::get().new_transaction_context();
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  // All rows are inserted and each chunk only holds rows of its partition
+  EXPECT_TABLE_EQ_UNORDERED(target_table, table_wrapper->get_output());
+  for (ChunkID chunk_id{0}; chunk_id < target_table->chunk_count(); ++chunk_id) {
+    const auto chunk = target_table->get_chunk(chunk_id);
+    ASSERT_TRUE(chunk->partition_id());
+    EXPECT_LE(chunk->size(), 3u);
+
+    const auto& segment = *chunk->get_segment(ColumnID{0});
+    for (ChunkOffset chunk_offset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      EXPECT_EQ(partition_schema->get_matching_partition(segment[chunk_offset]), *chunk->partition_id());
+      EXPECT_EQ(chunk->get_scoped_mvcc_data_lock()->tids[chunk_offset], 0u);
+    }
+  }
+}
+
+TEST_F(OperatorsInsertTest, InsertMaintainsTableIndexes) {
+  const auto target_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}},
+                                                    TableType::Data, 3, UseMvcc::Yes);
+  const auto table_index = target_table->create_table_index(ColumnID{0});
+  StorageManager::get().add_table("target_table", target_table);
+
+  // 10 rows, three of them with the value 234
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/10_ints.tbl"));
+  table_wrapper->execute();
+
+  for (auto insert_idx = 0; insert_idx < 2; ++insert_idx) {
+    const auto insert = std::make_shared<Insert>("target_table", table_wrapper);
+    auto context = TransactionManager::get().new_transaction_context();
+    insert->set_transaction_context(context);
+    insert->execute();
+    context->commit();
+  }
+
+  EXPECT_EQ(table_index->size(), 20u);
+
+  const auto matches = table_index->lookup(PredicateCondition::Equals, 234);
+  ASSERT_EQ(matches.size(), 6u);
+  for (const auto& row_id : matches) {
+    EXPECT_EQ(target_table->get_chunk(row_id.chunk_id)->get_segment(ColumnID{0})->operator[](row_id.chunk_offset),
+              AllTypeVariant{234});
+  }
+}
+
+TEST_F(OperatorsInsertTest, RollbackRemovesRowsFromTableIndexes) {
+  const auto target_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}},
+                                                    TableType::Data, 3, UseMvcc::Yes);
+  const auto table_index = target_table->create_table_index(ColumnID{0});
+  StorageManager::get().add_table("target_table", target_table);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/10_ints.tbl"));
+  table_wrapper->execute();
+
+  const auto committed_insert = std::make_shared<Insert>("target_table", table_wrapper);
+  auto committed_context = TransactionManager::get().new_transaction_context();
+  committed_insert->set_transaction_context(committed_context);
+  committed_insert->execute();
+  committed_context->commit();
+
+  // Before the rollback, the uncommitted rows are found in the index
+  const auto aborted_insert = std::make_shared<Insert>("target_table", table_wrapper);
+  auto aborted_context = TransactionManager::get().new_transaction_context();
+  aborted_insert->set_transaction_context(aborted_context);
+  aborted_insert->execute();
+  EXPECT_EQ(table_index->size(), 20u);
+  EXPECT_EQ(table_index->lookup(PredicateCondition::Equals, 234).size(), 6u);
+
+  aborted_context->rollback();
+
+  EXPECT_EQ(table_index->size(), 10u);
+  const auto matches = table_index->lookup(PredicateCondition::Equals, 234);
+  ASSERT_EQ(matches.size(), 3u);
+  for (const auto& row_id : matches) {
+    EXPECT_LT(row_id, (RowID{ChunkID{3}, ChunkOffset{1}}));
+  }
+}
+
 }  // namespace opossum
@@ -3,6 +3,11 @@
 #include "operators/join_hash/join_hash_steps.hpp"
 #include "operators/table_wrapper.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/morsel_queue.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk_encoder.hpp"
 
 namespace opossum {
 
@@ -157,6 +162,87 @@ TEST_F(JoinHashStepsTest, MaterializeInputHistograms) {
   EXPECT_EQ(empty_cluster_count, 2);
 }
 
+TEST_F(JoinHashStepsTest, MaterializeInputSkipsChunks) {
+  // _table_zero_one has a single chunk, so we use a table with multiple chunks here
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 2);
+  for (auto value = 1; value <= 6; ++value) {
+    table->append({value});
+  }
+
+  std::vector<std::vector<size_t>> histograms;
+  const auto radix_container =
+      materialize_input<int, int, false>(table, ColumnID{0}, histograms, 0, std::vector<bool>{false, true, false});
+
+  // The slots of the skipped chunk are kept, but do not hold any values
+  const auto& elements = *radix_container.elements;
+  ASSERT_EQ(elements.size(), 6u);
+  EXPECT_EQ(elements[0].value, 1);
+  EXPECT_EQ(elements[1].value, 2);
+  EXPECT_EQ(elements[2].row_id, NULL_ROW_ID);
+  EXPECT_EQ(elements[3].row_id, NULL_ROW_ID);
+  EXPECT_EQ(elements[4].value, 5);
+  EXPECT_EQ(elements[5].value, 6);
+
+  ASSERT_EQ(histograms.size(), 3u);
+  EXPECT_EQ(histograms[0][0], 2u);
+  EXPECT_EQ(histograms[1][0], 0u);
+  EXPECT_EQ(histograms[2][0], 2u);
+}
+
+TEST_F(JoinHashStepsTest, MaterializeInputInMorsels) {
+  // _table_zero_one has a single chunk of 1'000 rows, which is split into morsels
+  const auto morsels = MorselQueue::split_table(*_table_zero_one, 300);
+  ASSERT_EQ(morsels.size(), 4u);
+  EXPECT_EQ(determine_morsel_offsets(morsels), std::vector<size_t>({0, 250, 500, 750}));
+
+  std::vector<std::vector<size_t>> histograms;
+  const auto radix_container =
+      materialize_input<int, int, false>(_table_zero_one, ColumnID{0}, histograms, 1, {}, morsels);
+
+  // The elements are materialized in the order of the table, no matter how the morsels were processed
+  const auto& elements = *radix_container.elements;
+  ASSERT_EQ(elements.size(), _table_size_zero_one);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _table_size_zero_one; ++chunk_offset) {
+    EXPECT_EQ(elements[chunk_offset].row_id, (RowID{ChunkID{0}, chunk_offset}));
+    EXPECT_EQ(elements[chunk_offset].value, static_cast<int>(chunk_offset % 2));
+  }
+
+  // One histogram per morsel
+  ASSERT_EQ(histograms.size(), 4u);
+  for (const auto& histogram : histograms) {
+    EXPECT_EQ(histogram, std::vector<size_t>({125, 125}));
+  }
+
+  const auto radix_cluster_result = partition_radix_parallel<int, int, false>(
+      radix_container, determine_morsel_offsets(morsels), histograms, 1);
+  EXPECT_EQ(radix_cluster_result.partition_offsets, std::vector<size_t>({500, 1'000}));
+}
+
+TEST_F(JoinHashStepsTest, MaterializeEncodedInputInMorsels) {
+  // Morsels that start in the middle of a chunk are read using point access for encoded segments
+  const auto encoding_specs = std::vector<SegmentEncodingSpec>{
+      {EncodingType::RunLength},
+      {EncodingType::FrameOfReference},
+      {EncodingType::Dictionary, VectorCompressionType::SimdBp128}};
+
+  for (const auto& encoding_spec : encoding_specs) {
+    const auto table = std::make_shared<Table>(_table_zero_one->column_definitions(), TableType::Data);
+    table->append_chunk(_table_zero_one->get_chunk(ChunkID{0})->segments());
+    ChunkEncoder::encode_all_chunks(table, encoding_spec);
+
+    const auto morsels = MorselQueue::split_table(*table, 300);
+    std::vector<std::vector<size_t>> histograms;
+    const auto radix_container = materialize_input<int, int, false>(table, ColumnID{0}, histograms, 1, {}, morsels);
+
+    const auto& elements = *radix_container.elements;
+    ASSERT_EQ(elements.size(), _table_size_zero_one);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _table_size_zero_one; ++chunk_offset) {
+      EXPECT_EQ(elements[chunk_offset].row_id, (RowID{ChunkID{0}, chunk_offset}));
+      EXPECT_EQ(elements[chunk_offset].value, static_cast<int>(chunk_offset % 2));
+    }
+  }
+}
+
 TEST_F(JoinHashStepsTest, RadixClusteringOfNulls) {
   size_t radix_bit_count = 1;
   std::vector<std::vector<size_t>> histograms;
@@ -183,6 +269,42 @@ TEST_F(JoinHashStepsTest, RadixClusteringOfNulls) {
   }
 }
 
+TEST_F(JoinHashStepsTest, BuildAndProbeOnNodeOfHashTables) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 5);
+  for (auto value = 0; value < 20; ++value) {
+    table->append({value % 4});
+  }
+
+  std::vector<std::vector<size_t>> histograms;
+  const auto materialized = materialize_input<int, int, false>(table, ColumnID{0}, histograms, 1);
+  const auto radix_container =
+      partition_radix_parallel<int, int, false>(materialized, determine_chunk_offsets(table), histograms, 1);
+
+  // Without a scheduler, there is no node to record
+  auto hashtable_node_ids = std::vector<NodeID>{};
+  build<int, int>(radix_container, &hashtable_node_ids);
+  EXPECT_EQ(hashtable_node_ids, std::vector<NodeID>(2, CURRENT_NODE_ID));
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto hashtables = build<int, int>(radix_container, &hashtable_node_ids);
+  ASSERT_EQ(hashtable_node_ids.size(), 2u);
+  for (const auto node_id : hashtable_node_ids) {
+    EXPECT_LT(node_id, CurrentScheduler::get()->queues().size());
+  }
+
+  // Each of the 4 values occurs 5 times on both sides
+  auto pos_lists_left = std::vector<PosList>(2);
+  auto pos_lists_right = std::vector<PosList>(2);
+  probe<int, int, false>(radix_container, hashtables, pos_lists_left, pos_lists_right, JoinMode::Inner,
+                         hashtable_node_ids);
+  EXPECT_EQ(pos_lists_left[0].size() + pos_lists_left[1].size(), 100u);
+  EXPECT_EQ(pos_lists_right[0].size() + pos_lists_right[1].size(), 100u);
+
+  CurrentScheduler::get()->finish();
+}
+
 TEST_F(JoinHashStepsTest, DetermineChunkOffsets) {
   // offset store the start offset for each chunk
   const auto chunk_offsets_nulls = determine_chunk_offsets(_table_with_nulls_and_zeros->get_output());
@@ -2,6 +2,7 @@
 
 #include "operators/join_hash.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -77,6 +78,51 @@ TEST_F(JoinHashTest, RadixClusteredLeftJoinWithZeroAndOnesAnd) {
   EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_result);
 }
 
+TEST_F(JoinHashTest, PruneProbeChunksUsingStatistics) {
+  // The probe side consists of five chunks with statistics: [0, 1], [2, 3], ..., [8, 9]. All but one of them can be
+  // pruned, as the build side only contains 4 and 5.
+  const auto probe_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 2);
+  for (auto value = 0; value < 10; ++value) {
+    probe_table->append({value});
+  }
+  ChunkEncoder::encode_all_chunks(probe_table);
+  const auto probe_wrapper = std::make_shared<TableWrapper>(probe_table);
+  probe_wrapper->execute();
+
+  const auto build_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"b", DataType::Int, true}}, TableType::Data, 10);
+  build_table->append({5});
+  build_table->append({NullValue{}});
+  build_table->append({4});
+  const auto build_wrapper = std::make_shared<TableWrapper>(build_table);
+  build_wrapper->execute();
+
+  for (const auto radix_bits : {size_t{0}, size_t{2}}) {
+    const auto inner_join = std::make_shared<JoinHash>(build_wrapper, probe_wrapper, JoinMode::Inner,
+                                                       ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                                       PredicateCondition::Equals, radix_bits);
+    inner_join->execute();
+
+    const auto expected_inner_result = std::make_shared<Table>(
+        TableColumnDefinitions{{"b", DataType::Int, true}, {"a", DataType::Int, false}}, TableType::Data);
+    expected_inner_result->append({4, 4});
+    expected_inner_result->append({5, 5});
+    EXPECT_TABLE_EQ_UNORDERED(inner_join->get_output(), expected_inner_result);
+
+    const auto semi_join = std::make_shared<JoinHash>(probe_wrapper, build_wrapper, JoinMode::Semi,
+                                                      ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                                      PredicateCondition::Equals, radix_bits);
+    semi_join->execute();
+
+    const auto expected_semi_result =
+        std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data);
+    expected_semi_result->append({4});
+    expected_semi_result->append({5});
+    EXPECT_TABLE_EQ_UNORDERED(semi_join->get_output(), expected_semi_result);
+  }
+}
+
 TEST_F(JoinHashTest, HashJoinNotApplicable) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
 
@@ -16,6 +16,7 @@
 #include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -141,6 +142,24 @@ TYPED_TEST(JoinIndexTest, LeftJoinOnString) {
                          JoinMode::Left, "resources/test_data/tbl/joinoperators/string_left_join.tbl", 1);
 }
 
+TYPED_TEST(JoinIndexTest, JoinUsingTableIndex) {
+  // The right tables have no chunk indexes, so the index join can only succeed if it uses the table index
+  const auto right_table = load_table("resources/test_data/tbl/int_float2.tbl", 2);
+  right_table->create_table_index(ColumnID{0});
+  const auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  this->test_join_output(this->_table_wrapper_a_no_index, right,
+                         std::pair<ColumnID, ColumnID>(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals,
+                         JoinMode::Left, "resources/test_data/tbl/joinoperators/int_left_join.tbl", 1);
+  this->test_join_output(this->_table_wrapper_a_no_index, right,
+                         std::pair<ColumnID, ColumnID>(ColumnID{0}, ColumnID{0}), PredicateCondition::GreaterThan,
+                         JoinMode::Inner, "resources/test_data/tbl/joinoperators/int_greater_inner_join.tbl", 1);
+  this->test_join_output(this->_table_wrapper_a_no_index, right,
+                         std::pair<ColumnID, ColumnID>(ColumnID{0}, ColumnID{0}), PredicateCondition::LessThanEquals,
+                         JoinMode::Outer, "resources/test_data/tbl/joinoperators/int_smallerequal_outer_join.tbl", 1);
+}
+
 TYPED_TEST(JoinIndexTest, RightJoin) {
   this->test_join_output(this->_table_wrapper_a, this->_table_wrapper_b,
                          std::pair<ColumnID, ColumnID>(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals,
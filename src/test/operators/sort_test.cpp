@@ -70,6 +70,20 @@ TEST_P(OperatorsSortTest, AscendingSortOfOneColumn) {
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
 }
 
+TEST_P(OperatorsSortTest, OutputChunksAreMarkedAsOrdered) {
+  auto sort = std::make_shared<Sort>(_table_wrapper, ColumnID{1}, OrderByMode::DescendingNullsLast, 2u);
+  sort->execute();
+
+  const auto& output = sort->get_output();
+  ASSERT_GT(output->chunk_count(), 1u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& ordered_by = output->get_chunk(chunk_id)->ordered_by();
+    ASSERT_TRUE(ordered_by);
+    EXPECT_EQ(ordered_by->first, ColumnID{1});
+    EXPECT_EQ(ordered_by->second, OrderByMode::DescendingNullsLast);
+  }
+}
+
 TEST_P(OperatorsSortTest, AscendingSortOFilteredColumn) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_filtered_sorted.tbl", 2);
 
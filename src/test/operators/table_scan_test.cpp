@@ -23,6 +23,12 @@
 #include "operators/table_scan/column_vs_value_table_scan_impl.hpp"
 #include "operators/table_scan/expression_evaluator_table_scan_impl.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/morsel_queue.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "statistics/chunk_statistics/zone_map.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/reference_segment.hpp"
@@ -778,6 +784,49 @@ TEST_P(OperatorsTableScanTest, SetParameters) {
   EXPECT_EQ(*scan_c->predicate(), *greater_than_equals_(column, placeholder_(ParameterID{4})));
 }
 
+TEST_P(OperatorsTableScanTest, PrunesChunksAtRuntime) {
+  // Chunks of two rows each: [0, 1], [2, 3], ..., [8, 9]
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 2);
+  for (auto value = 0; value < 10; ++value) {
+    table->append({value});
+  }
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+
+  // The value of the parameter is unknown during optimization, so only the TableScan itself can prune chunks
+  const auto parameter_scan =
+      std::make_shared<TableScan>(table_wrapper, equals_(column_a, correlated_parameter_(ParameterID{0}, column_a)));
+  parameter_scan->set_parameters({{ParameterID{0}, AllTypeVariant{7}}});
+  parameter_scan->execute();
+  ASSERT_COLUMN_EQ(parameter_scan->get_output(), ColumnID{0}, {7});
+  EXPECT_NE(parameter_scan->description(DescriptionMode::SingleLine).find("(4 Chunks pruned at runtime)"),
+            std::string::npos);
+
+  // The same holds for uncorrelated subqueries
+  const auto subquery_pqp =
+      std::make_shared<Limit>(std::make_shared<Projection>(table_wrapper, expression_vector(to_expression(6))),
+                              to_expression(int64_t{1}));
+  const auto subquery_scan = std::make_shared<TableScan>(
+      table_wrapper, between_(column_a, pqp_subquery_(subquery_pqp, DataType::Int, false), to_expression(7)));
+  subquery_scan->execute();
+  ASSERT_COLUMN_EQ(subquery_scan->get_output(), ColumnID{0}, {6, 7});
+  EXPECT_NE(subquery_scan->description(DescriptionMode::SingleLine).find("(4 Chunks pruned at runtime)"),
+            std::string::npos);
+
+  // Scans on reference tables use the statistics of the referenced chunks
+  const auto reference_scan = std::make_shared<TableScan>(
+      parameter_scan, less_than_(column_a, correlated_parameter_(ParameterID{0}, column_a)));
+  reference_scan->set_parameters({{ParameterID{0}, AllTypeVariant{3}}});
+  reference_scan->execute();
+  EXPECT_EQ(reference_scan->get_output()->row_count(), 0u);
+  EXPECT_NE(reference_scan->description(DescriptionMode::SingleLine).find("(1 Chunks pruned at runtime)"),
+            std::string::npos);
+}
+
 TEST_P(OperatorsTableScanTest, GetImpl) {
   /**
    * Test that the correct scanning backend is chosen
@@ -860,4 +909,228 @@ TEST_P(OperatorsTableScanTest, TwoBigScans) {
   }
 }
 
+TEST_P(OperatorsTableScanTest, ScanOnSortedChunks) {
+  // Creates tables holding the values 0, 0, 1, 1, ..., 49, 49 and ten NULLs, sorted according to the OrderByMode.
+  // The result of scanning the chunks that are marked as sorted (and are thus scanned using binary search) has to be
+  // the same as the result of the regular scan on the same data.
+  const auto create_sorted_table = [&](const OrderByMode order_by_mode, const bool mark_as_sorted) {
+    auto values = std::vector<AllTypeVariant>{};
+    for (auto value = 0; value < 50; ++value) {
+      values.emplace_back(value);
+      values.emplace_back(value);
+    }
+    if (order_by_mode == OrderByMode::Descending || order_by_mode == OrderByMode::DescendingNullsLast) {
+      std::reverse(values.begin(), values.end());
+    }
+    const auto nulls = std::vector<AllTypeVariant>(10, NullValue{});
+    if (order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending) {
+      values.insert(values.begin(), nulls.begin(), nulls.end());
+    } else {
+      values.insert(values.end(), nulls.begin(), nulls.end());
+    }
+
+    // Use a chunk size that makes the NULLs spread across chunks
+    const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data, 7);
+    for (const auto& value : values) {
+      table->append({value});
+    }
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      // Encode all but the last chunk, which stays mutable
+      if (chunk_id + 1 < table->chunk_count()) {
+        ChunkEncoder::encode_chunk(table->get_chunk(chunk_id), {DataType::Int}, SegmentEncodingSpec{_encoding_type});
+      }
+      if (mark_as_sorted) table->get_chunk(chunk_id)->set_ordered_by({ColumnID{0}, order_by_mode});
+    }
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+
+  auto predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto value : {-1, 0, 17, 49, 50}) {
+    predicates.emplace_back(equals_(column_a, value));
+    predicates.emplace_back(not_equals_(column_a, value));
+    predicates.emplace_back(less_than_(column_a, value));
+    predicates.emplace_back(less_than_equals_(column_a, value));
+    predicates.emplace_back(greater_than_(column_a, value));
+    predicates.emplace_back(greater_than_equals_(column_a, value));
+  }
+  predicates.emplace_back(between_(column_a, 10, 20));
+  predicates.emplace_back(between_(column_a, 20, 10));
+  predicates.emplace_back(between_(column_a, -5, 100));
+  predicates.emplace_back(equals_(column_a, NullValue{}));
+
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending, OrderByMode::AscendingNullsLast,
+                                   OrderByMode::DescendingNullsLast}) {
+    const auto sorted_table = create_sorted_table(order_by_mode, true);
+    const auto unsorted_table = create_sorted_table(order_by_mode, false);
+
+    for (const auto& predicate : predicates) {
+      const auto sorted_scan = std::make_shared<TableScan>(sorted_table, predicate);
+      sorted_scan->execute();
+      const auto unsorted_scan = std::make_shared<TableScan>(unsorted_table, predicate);
+      unsorted_scan->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(sorted_scan->get_output(), unsorted_scan->get_output());
+    }
+  }
+}
+
+TEST_P(OperatorsTableScanTest, SortedSearchOnlyForRandomAccessSegments) {
+  // Binary search requires iterators that advance in O(1). Chunks that are scanned with it are not split into
+  // morsels, so can_split_chunk() tells whether the sorted search is used.
+  const auto table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 10);
+  for (auto value = 0; value < 30; ++value) {
+    table->append({value});
+  }
+  ChunkEncoder::encode_chunk(
+      table->get_chunk(ChunkID{0}), {DataType::Int},
+      {SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedSizeByteAligned}});
+  ChunkEncoder::encode_chunk(table->get_chunk(ChunkID{1}), {DataType::Int},
+                             {SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::SimdBp128}});
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->get_chunk(chunk_id)->set_ordered_by({ColumnID{0}, OrderByMode::Ascending});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto predicate = less_than_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"), 15);
+  const auto impl = TableScan{table_wrapper, predicate}.create_impl();
+
+  EXPECT_FALSE(impl->can_split_chunk(ChunkID{0}));
+  EXPECT_TRUE(impl->can_split_chunk(ChunkID{1}));
+  EXPECT_FALSE(impl->can_split_chunk(ChunkID{2}));
+
+  const auto scan = std::make_shared<TableScan>(table_wrapper, predicate);
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 15u);
+}
+
+TEST_P(OperatorsTableScanTest, ScanWithZoneMaps) {
+  // Creates a chunk that consists of multiple ZoneMap blocks. The values are increasing, except for every 1'000th row,
+  // which is an outlier (-1). A block of NULLs follows. Most blocks can be skipped for selective predicates, yet the
+  // outliers and the NULLs must be handled correctly.
+  const auto block_size = static_cast<int32_t>(ZoneMap::DEFAULT_BLOCK_SIZE);
+  const auto row_count = block_size * 5;
+
+  const auto table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data, row_count);
+  for (auto row = 0; row < row_count; ++row) {
+    if (row >= block_size * 4) {
+      table->append({NullValue{}});
+    } else {
+      table->append({row % 1'000 == 999 ? -1 : row});
+    }
+  }
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type});
+  ASSERT_TRUE(table->get_chunk(ChunkID{0})->statistics()->statistics()[0]->zone_map());
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+
+  const auto equals_scan = std::make_shared<TableScan>(table_wrapper, equals_(column_a, block_size + 5));
+  equals_scan->execute();
+  ASSERT_COLUMN_EQ(equals_scan->get_output(), ColumnID{0}, {block_size + 5});
+
+  const auto outlier_scan = std::make_shared<TableScan>(table_wrapper, less_than_(column_a, 0));
+  outlier_scan->execute();
+  EXPECT_EQ(outlier_scan->get_output()->row_count(), static_cast<uint64_t>(block_size * 4 / 1'000));
+
+  const auto between_scan = std::make_shared<TableScan>(table_wrapper, between_(column_a, 10, 20));
+  between_scan->execute();
+  ASSERT_COLUMN_EQ(between_scan->get_output(), ColumnID{0}, {10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20});
+
+  const auto none_scan = std::make_shared<TableScan>(table_wrapper, greater_than_(column_a, row_count));
+  none_scan->execute();
+  EXPECT_EQ(none_scan->get_output()->row_count(), 0u);
+}
+
+TEST_P(OperatorsTableScanTest, ScanChunkRanges) {
+  // Scanning a chunk range by range (i.e., morsel by morsel, see MorselQueue) has to yield the same matches in the same
+  // order as scanning the entire chunk, both for data and for reference tables.
+  auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}};
+  const auto data_table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  for (auto i = 0; i < 1'500; ++i) {
+    if (i % 5 == 4) {
+      data_table->append({NullValue{}});
+    } else {
+      data_table->append({100'000 + i});
+    }
+  }
+  ChunkEncoder::encode_chunk(data_table->get_chunk(ChunkID{0}), {DataType::Int}, SegmentEncodingSpec{_encoding_type});
+
+  auto data_table_wrapper = std::make_shared<TableWrapper>(data_table);
+  data_table_wrapper->execute();
+
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+
+  const auto reference_scan = std::make_shared<TableScan>(data_table_wrapper, greater_than_(column_a, 100'050));
+  reference_scan->execute();
+
+  const auto predicates = std::vector<std::shared_ptr<AbstractExpression>>{
+      greater_than_equals_(column_a, 100'100), between_(column_a, 100'100, 100'700), not_equals_(column_a, 100'500)};
+
+  for (const auto& input : std::vector<std::shared_ptr<AbstractOperator>>{data_table_wrapper, reference_scan}) {
+    const auto& input_table = input->get_output();
+
+    for (const auto& predicate : predicates) {
+      const auto impl = TableScan{input, predicate}.create_impl();
+
+      for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+        ASSERT_TRUE(impl->can_split_chunk(chunk_id));
+
+        const auto chunk_size = input_table->get_chunk(chunk_id)->size();
+        auto matches = PosList{};
+        for (auto begin_offset = ChunkOffset{0}; begin_offset < chunk_size; begin_offset += 97) {
+          const auto end_offset = std::min(begin_offset + 97, chunk_size);
+          const auto range_matches = impl->scan_chunk_range(chunk_id, begin_offset, end_offset);
+          matches.insert(matches.end(), range_matches->begin(), range_matches->end());
+        }
+
+        EXPECT_EQ(matches, *impl->scan_chunk(chunk_id));
+      }
+    }
+  }
+}
+
+TEST_P(OperatorsTableScanTest, ScanWithMorsels) {
+  // With a scheduler, the single large chunk is split into morsels (if there is more than one worker). The output
+  // still consists of one chunk, which holds the matches in the same order as the scan without a scheduler.
+  const auto row_count = 4 * static_cast<int32_t>(MorselQueue::MIN_MORSEL_SIZE);
+  const auto table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, row_count);
+  for (auto row = 0; row < row_count; ++row) {
+    table->append({row % 100});
+  }
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto predicate = less_than_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"), 10);
+
+  const auto scan_without_scheduler = std::make_shared<TableScan>(table_wrapper, predicate);
+  scan_without_scheduler->execute();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto scan_with_scheduler = std::make_shared<TableScan>(table_wrapper, predicate);
+  scan_with_scheduler->execute();
+
+  CurrentScheduler::get()->finish();
+
+  EXPECT_EQ(scan_with_scheduler->get_output()->chunk_count(), 1u);
+  EXPECT_EQ(scan_with_scheduler->get_output()->row_count(), static_cast<uint64_t>(row_count / 10));
+  EXPECT_TABLE_EQ_ORDERED(scan_with_scheduler->get_output(), scan_without_scheduler->get_output());
+}
+
 }  // namespace opossum
@@ -20,6 +20,7 @@
 #include "statistics/column_statistics.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/partitioning/range_partition_schema.hpp"
 #include "storage/storage_manager.hpp"
 
 #include "utils/assert.hpp"
@@ -274,4 +275,32 @@ TEST_F(ChunkPruningTest, FixedStringPruningTest) {
   EXPECT_EQ(excluded, expected);
 }
 
+TEST_F(ChunkPruningTest, PartitionPruningTest) {
+  // The chunks of a partitioned table can be pruned without statistics, i.e., even if they are still mutable
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 10);
+  table->set_partition_schema(
+      std::make_shared<RangePartitionSchema>(ColumnID{0}, DataType::Int, std::vector<AllTypeVariant>{100, 200}));
+  for (const auto value : {150, 50, 250, 120}) {
+    table->append({value});
+  }
+  StorageManager::get().add_table("partitioned", table);
+
+  // Chunk 0 holds partition 1 ([100, 200)), chunk 1 partition 0, chunk 2 partition 2
+  ASSERT_EQ(table->chunk_count(), 3u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->statistics(), nullptr);
+
+  auto stored_table_node = std::make_shared<StoredTableNode>("partitioned");
+
+  auto predicate_node =
+      std::make_shared<PredicateNode>(greater_than_equals_(LQPColumnReference(stored_table_node, ColumnID{0}), 200));
+  predicate_node->set_left_input(stored_table_node);
+
+  auto pruned = StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+  EXPECT_EQ(pruned, predicate_node);
+  std::vector<ChunkID> expected = {ChunkID{0}, ChunkID{1}};
+  std::vector<ChunkID> excluded = stored_table_node->excluded_chunk_ids();
+  EXPECT_EQ(excluded, expected);
+}
+
 }  // namespace opossum
@@ -12,6 +12,7 @@
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
 #include "optimizer/strategy/index_scan_rule.hpp"
 #include "optimizer/strategy/strategy_base_test.hpp"
 #include "statistics/column_statistics.hpp"
@@ -21,6 +22,7 @@
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/hash/hash_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/assert.hpp"
 
@@ -168,4 +170,41 @@ TEST_F(IndexScanRuleTest, IndexScanOnlyOnOutputOfStoredTableNode) {
   EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
 }
 
+TEST_F(IndexScanRuleTest, IndexScanBelowValidate) {
+  table->create_table_index(ColumnID{2});
+
+  auto statistics_mock = generate_mock_statistics(1'000'000);
+  table->set_table_statistics(statistics_mock);
+
+  auto validate_node = ValidateNode::make(stored_table_node);
+  auto predicate_node_0 = PredicateNode::make(greater_than_(c, 19'900), validate_node);
+
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, HashIndexOnlyForEqualityPredicates) {
+  table->create_index<HashIndex>({ColumnID{2}});
+
+  // Column c has 20'000 distinct values, so that equality predicates are selective
+  std::vector<std::shared_ptr<const BaseColumnStatistics>> column_statistics;
+  column_statistics.emplace_back(std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10, 0, 20));
+  column_statistics.emplace_back(std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10, 0, 20));
+  column_statistics.emplace_back(std::make_shared<ColumnStatistics<int32_t>>(0.0f, 20'000, 0, 20'000));
+  table->set_table_statistics(
+      std::make_shared<TableStatistics>(TableStatistics{TableType::Data, 1'000'000, column_statistics}));
+
+  auto predicate_node_0 = PredicateNode::make(equals_(c, 19'900), stored_table_node);
+  StrategyBaseTest::apply_rule(rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
+
+  auto predicate_node_1 = PredicateNode::make(in_(c, list_(19'900, 19'901)), stored_table_node);
+  StrategyBaseTest::apply_rule(rule, predicate_node_1);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::IndexScan);
+
+  auto predicate_node_2 = PredicateNode::make(greater_than_(c, 19'900), stored_table_node);
+  StrategyBaseTest::apply_rule(rule, predicate_node_2);
+  EXPECT_EQ(predicate_node_2->scan_type, ScanType::TableScan);
+}
+
 }  // namespace opossum
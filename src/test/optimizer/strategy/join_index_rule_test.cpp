@@ -0,0 +1,131 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "optimizer/strategy/join_index_rule.hpp"
+#include "optimizer/strategy/strategy_base_test.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class JoinIndexRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    table = load_table("resources/test_data/tbl/int_int_int.tbl");
+    StorageManager::get().add_table("a", table);
+
+    // Pretend that the table is large, the rule only looks at the statistics
+    table->set_table_statistics(generate_mock_statistics(1'000'000));
+
+    rule = std::make_shared<JoinIndexRule>();
+
+    stored_table_node = StoredTableNode::make("a");
+    a = stored_table_node->get_column("a");
+    b = stored_table_node->get_column("b");
+
+    mock_node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "x"}});
+    x = mock_node->get_column("x");
+  }
+
+  std::shared_ptr<TableStatistics> generate_mock_statistics(float row_count) {
+    std::vector<std::shared_ptr<const BaseColumnStatistics>> column_statistics;
+    column_statistics.emplace_back(std::make_shared<ColumnStatistics<int32_t>>(0.0f, row_count, 0, 1'000'000));
+    column_statistics.emplace_back(std::make_shared<ColumnStatistics<int32_t>>(0.0f, row_count, 0, 1'000'000));
+    column_statistics.emplace_back(std::make_shared<ColumnStatistics<int32_t>>(0.0f, row_count, 0, 1'000'000));
+    return std::make_shared<TableStatistics>(TableStatistics{TableType::Data, row_count, column_statistics});
+  }
+
+  void set_left_row_count(float row_count) {
+    std::vector<std::shared_ptr<const BaseColumnStatistics>> column_statistics;
+    column_statistics.emplace_back(std::make_shared<ColumnStatistics<int32_t>>(0.0f, row_count, 0, 1'000'000));
+    mock_node->set_statistics(
+        std::make_shared<TableStatistics>(TableStatistics{TableType::Data, row_count, column_statistics}));
+  }
+
+  std::shared_ptr<JoinIndexRule> rule;
+  std::shared_ptr<StoredTableNode> stored_table_node;
+  std::shared_ptr<MockNode> mock_node;
+  std::shared_ptr<Table> table;
+  LQPColumnReference a, b, x;
+};
+
+TEST_F(JoinIndexRuleTest, NoIndexJoinWithoutIndex) {
+  set_left_row_count(10);
+
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(x, a), mock_node, stored_table_node);
+  StrategyBaseTest::apply_rule(rule, join_node);
+  EXPECT_EQ(join_node->join_type, JoinType::Default);
+}
+
+TEST_F(JoinIndexRuleTest, NoIndexJoinWithIndexOnOtherColumn) {
+  table->create_table_index(ColumnID{1});
+  set_left_row_count(10);
+
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(x, a), mock_node, stored_table_node);
+  StrategyBaseTest::apply_rule(rule, join_node);
+  EXPECT_EQ(join_node->join_type, JoinType::Default);
+}
+
+TEST_F(JoinIndexRuleTest, IndexJoinWithTableIndexAndSmallLeftInput) {
+  table->create_table_index(ColumnID{0});
+  set_left_row_count(10);
+
+  const auto join_node = JoinNode::make(JoinMode::Left, equals_(x, a), mock_node, stored_table_node);
+  StrategyBaseTest::apply_rule(rule, join_node);
+  EXPECT_EQ(join_node->join_type, JoinType::Index);
+}
+
+TEST_F(JoinIndexRuleTest, IndexJoinWithChunkIndex) {
+  table->create_index<GroupKeyIndex>({ColumnID{0}});
+  set_left_row_count(10);
+
+  const auto join_node = JoinNode::make(JoinMode::Inner, less_than_(x, a), mock_node, stored_table_node);
+  StrategyBaseTest::apply_rule(rule, join_node);
+  EXPECT_EQ(join_node->join_type, JoinType::Index);
+}
+
+TEST_F(JoinIndexRuleTest, NoIndexJoinWithLargeLeftInput) {
+  table->create_table_index(ColumnID{0});
+  set_left_row_count(500'000);
+
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(x, a), mock_node, stored_table_node);
+  StrategyBaseTest::apply_rule(rule, join_node);
+  EXPECT_EQ(join_node->join_type, JoinType::Default);
+}
+
+TEST_F(JoinIndexRuleTest, NoIndexJoinWithIndexOnLeftInput) {
+  // JoinIndex only probes the right input
+  table->create_table_index(ColumnID{0});
+  set_left_row_count(10);
+
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(a, x), stored_table_node, mock_node);
+  StrategyBaseTest::apply_rule(rule, join_node);
+  EXPECT_EQ(join_node->join_type, JoinType::Default);
+}
+
+TEST_F(JoinIndexRuleTest, NoIndexJoinForUnsupportedModes) {
+  table->create_table_index(ColumnID{0});
+  set_left_row_count(10);
+
+  for (const auto join_mode : {JoinMode::Semi, JoinMode::Anti}) {
+    const auto join_node = JoinNode::make(join_mode, equals_(x, a), mock_node, stored_table_node);
+    StrategyBaseTest::apply_rule(rule, join_node);
+    EXPECT_EQ(join_node->join_type, JoinType::Default);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,120 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/morsel_queue.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class MorselQueueTest : public BaseTest {};
+
+TEST_F(MorselQueueTest, SplitChunk) {
+  auto morsels = std::vector<Morsel>{};
+
+  MorselQueue::split_chunk(morsels, ChunkID{0}, 10, 4);
+  MorselQueue::split_chunk(morsels, ChunkID{1}, 0, 4);
+  MorselQueue::split_chunk(morsels, ChunkID{2}, 3, 4);
+
+  // The rows of a chunk are distributed evenly across its morsels. Empty chunks are represented by an empty morsel.
+  EXPECT_EQ(morsels, std::vector<Morsel>({{ChunkID{0}, 0, 3},
+                                          {ChunkID{0}, 3, 6},
+                                          {ChunkID{0}, 6, 10},
+                                          {ChunkID{1}, 0, 0},
+                                          {ChunkID{2}, 0, 3}}));
+}
+
+TEST_F(MorselQueueTest, SplitTable) {
+  const auto table = load_table("resources/test_data/tbl/int_float4.tbl", 3);
+
+  EXPECT_EQ(MorselQueue::split_table(*table, 2), std::vector<Morsel>({{ChunkID{0}, 0, 1},
+                                                                      {ChunkID{0}, 1, 3},
+                                                                      {ChunkID{1}, 0, 1},
+                                                                      {ChunkID{1}, 1, 3},
+                                                                      {ChunkID{2}, 0, 1}}));
+  EXPECT_EQ(MorselQueue::split_table(*table, Chunk::MAX_SIZE).size(), table->chunk_count());
+}
+
+TEST_F(MorselQueueTest, MorselSize) {
+  // Without a scheduler, chunks are not split
+  EXPECT_EQ(MorselQueue::worker_count(), 1u);
+  EXPECT_EQ(MorselQueue::morsel_size_for(10'000'000), Chunk::MAX_SIZE);
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto worker_count = MorselQueue::worker_count();
+  EXPECT_GE(worker_count, 1u);
+  if (worker_count > 1) {
+    EXPECT_EQ(MorselQueue::morsel_size_for(100), MorselQueue::MIN_MORSEL_SIZE);
+    EXPECT_EQ(MorselQueue::morsel_size_for(worker_count * MorselQueue::MORSELS_PER_WORKER * 50'000), 50'000u);
+  }
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(MorselQueueTest, ProcessesEachMorselOnce) {
+  auto morsels = std::vector<Morsel>{};
+  MorselQueue::split_chunk(morsels, ChunkID{0}, 1'000, 10);
+
+  const auto process_and_check = [&]() {
+    auto queue = MorselQueue{morsels};
+    auto processed = std::vector<std::atomic<size_t>>(morsels.size());
+    queue.process([&](const size_t morsel_index) { ++processed[morsel_index]; });
+
+    for (const auto& count : processed) {
+      EXPECT_EQ(count, 1u);
+    }
+    EXPECT_EQ(queue.pop(), std::nullopt);
+  };
+
+  process_and_check();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  process_and_check();
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(MorselQueueTest, ProcessesSmallInputsOnCallingThread) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // Many small morsels are not worth scheduling a JobTask
+  auto small_morsels = std::vector<Morsel>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < 100; ++chunk_id) {
+    MorselQueue::split_chunk(small_morsels, chunk_id, 10, MorselQueue::MIN_MORSEL_SIZE);
+  }
+
+  const auto calling_thread_id = std::this_thread::get_id();
+  auto small_queue = MorselQueue{small_morsels};
+  auto processed_morsel_count = size_t{0};
+  small_queue.process([&](const size_t morsel_index) {
+    EXPECT_EQ(std::this_thread::get_id(), calling_thread_id);
+    ++processed_morsel_count;
+  });
+  EXPECT_EQ(processed_morsel_count, 100u);
+
+  // Large inputs are still processed by multiple jobs
+  auto large_morsels = std::vector<Morsel>{};
+  MorselQueue::split_chunk(large_morsels, ChunkID{0}, 8 * MorselQueue::MIN_MORSEL_SIZE, MorselQueue::MIN_MORSEL_SIZE);
+
+  auto large_queue = MorselQueue{large_morsels};
+  auto processed = std::vector<std::atomic<size_t>>(large_morsels.size());
+  large_queue.process([&](const size_t morsel_index) { ++processed[morsel_index]; });
+  for (const auto& count : processed) {
+    EXPECT_EQ(count, 1u);
+  }
+
+  CurrentScheduler::get()->finish();
+}
+
+}  // namespace opossum
@@ -0,0 +1,108 @@
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/scheduler_metrics.hpp"
+#include "scheduler/topology.hpp"
+
+namespace opossum {
+
+class SchedulerMetricsTest : public BaseTest {};
+
+TEST_F(SchedulerMetricsTest, LatencyHistogram) {
+  auto histogram = LatencyHistogram{};
+  EXPECT_EQ(histogram.count(), 0u);
+  EXPECT_EQ(histogram.mean(), std::chrono::nanoseconds{0});
+  EXPECT_EQ(histogram.percentile(0.5), std::chrono::nanoseconds{0});
+
+  // 0 and 1 ns go to the first bucket, 1000 ns to the bucket [512, 1024)
+  histogram.add(std::chrono::nanoseconds{0});
+  histogram.add(std::chrono::nanoseconds{1});
+  histogram.add(std::chrono::nanoseconds{1000});
+  histogram.add(std::chrono::microseconds{1});
+  EXPECT_EQ(histogram.bucket_count(0), 2u);
+  EXPECT_EQ(histogram.bucket_count(9), 2u);
+
+  EXPECT_EQ(histogram.count(), 4u);
+  EXPECT_EQ(histogram.total(), std::chrono::nanoseconds{2001});
+  EXPECT_EQ(histogram.mean(), std::chrono::nanoseconds{500});
+
+  // Percentiles are reported as the upper bound of their bucket
+  EXPECT_EQ(histogram.percentile(0.0), std::chrono::nanoseconds{2});
+  EXPECT_EQ(histogram.percentile(0.5), std::chrono::nanoseconds{2});
+  EXPECT_EQ(histogram.percentile(0.51), std::chrono::nanoseconds{1024});
+  EXPECT_EQ(histogram.percentile(1.0), std::chrono::nanoseconds{1024});
+
+  auto other_histogram = LatencyHistogram{};
+  other_histogram.add(std::chrono::seconds{1});
+  other_histogram.merge(histogram);
+  EXPECT_EQ(other_histogram.count(), 5u);
+  EXPECT_EQ(other_histogram.percentile(1.0), std::chrono::nanoseconds{int64_t{1} << 30});
+
+  const auto copied_histogram = other_histogram;
+  EXPECT_EQ(copied_histogram.count(), 5u);
+  EXPECT_EQ(copied_histogram.total(), other_histogram.total());
+}
+
+TEST_F(SchedulerMetricsTest, WorkerUtilization) {
+  auto worker_metrics = WorkerMetrics{};
+  EXPECT_EQ(worker_metrics.utilization(), 0.0);
+
+  worker_metrics.busy_time = std::chrono::milliseconds{3};
+  worker_metrics.idle_time = std::chrono::milliseconds{1};
+  EXPECT_DOUBLE_EQ(worker_metrics.utilization(), 0.75);
+}
+
+TEST_F(SchedulerMetricsTest, CollectedByScheduler) {
+  Topology::use_fake_numa_topology(8, 4);
+  auto scheduler = std::make_shared<NodeQueueScheduler>();
+  CurrentScheduler::set(scheduler);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto job_id = 0; job_id < 20; ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([]() {}));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  for (const auto& job : jobs) {
+    EXPECT_LE(job->enqueued_time(), job->started_time());
+    EXPECT_LE(job->started_time(), job->finished_time());
+  }
+
+  // Workers update their counters after the task has finished, i.e., possibly after wait_for_tasks() returned. As
+  // finish() removes the workers, the metrics have to be collected before.
+  const auto executed_task_count = [](const SchedulerMetrics& metrics) {
+    auto count = uint64_t{0};
+    for (const auto& worker_metrics : metrics.workers) {
+      count += worker_metrics.executed_task_count;
+    }
+    return count;
+  };
+  auto metrics = scheduler->metrics();
+  while (executed_task_count(metrics) < 20) {
+    std::this_thread::yield();
+    metrics = scheduler->metrics();
+  }
+  CurrentScheduler::get()->finish();
+
+  ASSERT_EQ(metrics.workers.size(), Topology::get().num_cpus());
+  EXPECT_EQ(executed_task_count(metrics), 20u);
+  for (const auto& worker_metrics : metrics.workers) {
+    EXPECT_GE(worker_metrics.utilization(), 0.0);
+    EXPECT_LE(worker_metrics.utilization(), 1.0);
+  }
+  EXPECT_EQ(metrics.queue_wait_time.count(), 20u);
+  EXPECT_EQ(metrics.execution_time.count(), 20u);
+
+  EXPECT_NE(metrics.to_string().find("Queue wait time: n=20"), std::string::npos);
+}
+
+}  // namespace opossum
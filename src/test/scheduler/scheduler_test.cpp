@@ -1,4 +1,10 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <memory>
+#include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -12,8 +18,14 @@
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/query_context.hpp"
+#include "scheduler/task_queue.hpp"
 #include "scheduler/topology.hpp"
+#include "scheduler/worker.hpp"
+#include "storage/pos_list.hpp"
 #include "storage/storage_manager.hpp"
+#include "utils/numa_memory_resource.hpp"
+#include "utils/query_cancelled_exception.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -258,4 +270,449 @@ TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   CurrentScheduler::get()->finish();
 }
 
+TEST_F(SchedulerTest, ContinueAfterTasks) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // The parent yields twice. Its successor must only run once the last continuation returned.
+  auto counter = std::atomic_uint{0};
+  auto continuation_count = std::atomic_uint{0};
+  auto parent = std::make_shared<JobTask>([&]() {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto job_index = 0; job_index < 10; ++job_index) {
+      jobs.emplace_back(std::make_shared<JobTask>([&]() { ++counter; }));
+    }
+    CurrentScheduler::schedule_tasks(jobs);
+
+    CurrentScheduler::continue_after_tasks(jobs, [&]() {
+      EXPECT_EQ(counter, 10u);
+      ++continuation_count;
+
+      auto more_jobs = std::vector<std::shared_ptr<AbstractTask>>{std::make_shared<JobTask>([&]() { ++counter; })};
+      CurrentScheduler::schedule_tasks(more_jobs);
+      CurrentScheduler::continue_after_tasks(more_jobs, [&]() {
+        EXPECT_EQ(counter, 11u);
+        ++continuation_count;
+      });
+    });
+  });
+
+  auto successor = std::make_shared<JobTask>([&]() { EXPECT_EQ(continuation_count, 2u); });
+  parent->set_as_predecessor_of(successor);
+
+  successor->schedule();
+  parent->schedule();
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{parent, successor});
+
+  EXPECT_TRUE(parent->is_done());
+  EXPECT_EQ(continuation_count, 2u);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, ContinuationsRunAsTasksOfTheirOwn) {
+  // A single worker executes all tasks on the same stack
+  Topology::use_fake_numa_topology(1, 1);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto query_context = std::make_shared<QueryContext>();
+  constexpr auto CONTINUATION_COUNT = 1'000u;
+
+  auto parent = std::shared_ptr<JobTask>{};
+  auto continuation_count = 0u;
+  auto first_stack_address = uintptr_t{0};
+  auto max_stack_distance = uintptr_t{0};
+
+  // Each continuation yields again. If the continuations were executed by the awaited job that finished last, they
+  // would be nested in each other and the stack would grow with every continuation.
+  auto continue_after_job = std::function<void()>{};
+  continue_after_job = [&]() {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{std::make_shared<JobTask>([]() {})};
+    CurrentScheduler::schedule_tasks(jobs);
+    CurrentScheduler::continue_after_tasks(jobs, [&]() {
+      const auto local = 0;
+      const auto stack_address = reinterpret_cast<uintptr_t>(&local);
+      if (continuation_count == 0) first_stack_address = stack_address;
+      max_stack_distance = std::max(max_stack_distance, first_stack_address > stack_address
+                                                            ? first_stack_address - stack_address
+                                                            : stack_address - first_stack_address);
+
+      // The continuation is part of the parent and its query
+      EXPECT_EQ(AbstractTask::get_this_thread_task(), parent);
+      EXPECT_EQ(query_context->running_task_count(), 1u);
+
+      if (++continuation_count < CONTINUATION_COUNT) continue_after_job();
+    });
+  };
+
+  parent = std::make_shared<JobTask>([&]() { continue_after_job(); });
+  parent->set_query_context(query_context);
+  parent->schedule();
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{parent});
+
+  EXPECT_EQ(continuation_count, CONTINUATION_COUNT);
+  EXPECT_LT(max_stack_distance, 4'096u);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, ContinueAfterTasksWithoutScheduler) {
+  // Jobs are executed when they are scheduled, so the continuation runs right after the task's execution returned
+  auto log = std::vector<std::string>{};
+  auto task = std::make_shared<JobTask>([&]() {
+    auto jobs = std::vector<std::shared_ptr<JobTask>>{std::make_shared<JobTask>([&]() { log.emplace_back("job"); })};
+    CurrentScheduler::schedule_tasks(jobs);
+    CurrentScheduler::continue_after_tasks(jobs, [&]() { log.emplace_back("continuation"); });
+    log.emplace_back("yielded");
+  });
+  task->schedule();
+
+  EXPECT_TRUE(task->is_done());
+  EXPECT_EQ(log, std::vector<std::string>({"job", "yielded", "continuation"}));
+
+  // Outside of a task, the continuation is executed right away
+  auto continued = false;
+  CurrentScheduler::continue_after_tasks(std::vector<std::shared_ptr<AbstractTask>>{task}, [&]() { continued = true; });
+  EXPECT_TRUE(continued);
+}
+
+TEST_F(SchedulerTest, ExecuteTasksInline) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // Diamond: task1 -> (task2, task3) -> task4. All tasks, including the successors that become ready when their
+  // predecessors finish, run on the calling thread in a valid order.
+  const auto calling_thread_id = std::this_thread::get_id();
+  auto log = std::vector<std::string>{};
+  const auto make_task = [&](const std::string& name) {
+    return std::make_shared<JobTask>([&, name]() {
+      EXPECT_EQ(std::this_thread::get_id(), calling_thread_id);
+      log.emplace_back(name);
+    });
+  };
+  auto tasks = std::vector<std::shared_ptr<JobTask>>{make_task("task1"), make_task("task2"), make_task("task3"),
+                                                     make_task("task4")};
+  tasks[0]->set_as_predecessor_of(tasks[1]);
+  tasks[0]->set_as_predecessor_of(tasks[2]);
+  tasks[1]->set_as_predecessor_of(tasks[3]);
+  tasks[2]->set_as_predecessor_of(tasks[3]);
+
+  CurrentScheduler::execute_tasks_inline(tasks);
+
+  for (const auto& task : tasks) {
+    EXPECT_TRUE(task->is_done());
+  }
+  ASSERT_EQ(log.size(), 4u);
+  EXPECT_EQ(log.front(), "task1");
+  EXPECT_EQ(log.back(), "task4");
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, WorkersAllocateIntermediatesOnTheirNode) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // Intermediates that are allocated by a task use the NUMAMemoryResource of the node the task runs on
+  constexpr auto JOB_COUNT = size_t{20};
+  auto node_ids = std::vector<NodeID>(JOB_COUNT, INVALID_NODE_ID);
+  auto resources = std::vector<boost::container::pmr::memory_resource*>(JOB_COUNT);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto job_id = size_t{0}; job_id < JOB_COUNT; ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_id]() {
+      node_ids[job_id] = Worker::get_this_thread_worker()->queue()->node_id();
+      resources[job_id] = PosList{}.get_allocator().resource();
+    }));
+    jobs.back()->schedule(NodeID{static_cast<uint32_t>(job_id % CurrentScheduler::get()->queues().size())});
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  for (auto job_id = size_t{0}; job_id < JOB_COUNT; ++job_id) {
+    EXPECT_EQ(resources[job_id], Topology::get().get_memory_resource(static_cast<int>(node_ids[job_id])));
+  }
+
+  // Other threads keep using the global default resource
+  EXPECT_EQ(PosList{}.get_allocator().resource(), boost::container::pmr::new_delete_resource());
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, TaskQueueServesQueriesFairly) {
+  auto queue = TaskQueue{NodeID{0}};
+  const auto large_query = std::make_shared<QueryContext>();
+  const auto short_query = std::make_shared<QueryContext>();
+
+  const auto make_task = [](const std::shared_ptr<QueryContext>& query_context) {
+    auto task = std::make_shared<JobTask>([]() {});
+    task->set_query_context(query_context);
+    return task;
+  };
+
+  auto large_query_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_index = 0; task_index < 3; ++task_index) {
+    large_query_tasks.emplace_back(make_task(large_query));
+    queue.push(large_query_tasks.back(), static_cast<uint32_t>(SchedulePriority::Default));
+  }
+  const auto short_query_task = make_task(short_query);
+  queue.push(short_query_task, static_cast<uint32_t>(SchedulePriority::Default));
+  const auto high_priority_task = make_task(large_query);
+  queue.push(high_priority_task, static_cast<uint32_t>(SchedulePriority::High));
+
+  // High priority tasks come first. Then, the short query is served before the remaining tasks of the large one, as
+  // the large query already runs a task. Pulled tasks are accounted to their query as running.
+  EXPECT_EQ(queue.pull(), high_priority_task);
+  EXPECT_EQ(large_query->running_task_count(), 1u);
+  EXPECT_EQ(queue.pull(), short_query_task);
+  EXPECT_EQ(queue.pull(), large_query_tasks[0]);
+  EXPECT_EQ(large_query->running_task_count(), 2u);
+  EXPECT_EQ(short_query->running_task_count(), 1u);
+
+  // Admission control: the large query's tasks, including high priority ones, are held back while it runs as many
+  // tasks as it is allowed to
+  large_query->set_max_concurrent_tasks(2);
+  const auto high_priority_task_2 = make_task(large_query);
+  queue.push(high_priority_task_2, static_cast<uint32_t>(SchedulePriority::High));
+  EXPECT_FALSE(queue.has_admissible_tasks());
+  EXPECT_EQ(queue.pull(), nullptr);
+  EXPECT_FALSE(queue.empty());
+
+  large_query->on_task_finished();
+  EXPECT_TRUE(queue.has_admissible_tasks());
+  EXPECT_EQ(queue.pull(), high_priority_task_2);
+  EXPECT_EQ(queue.pull(), nullptr);
+
+  large_query->on_task_finished();
+  EXPECT_EQ(queue.pull(), large_query_tasks[1]);
+  large_query->on_task_finished();
+  EXPECT_EQ(queue.pull(), large_query_tasks[2]);
+  EXPECT_TRUE(queue.empty());
+
+  // A task taken from a WorkStealingDeque that its query could not start is served like a default priority task
+  const auto deque_task = make_task(large_query);
+  ASSERT_TRUE(deque_task->try_mark_as_enqueued());
+  queue.requeue(deque_task);
+  EXPECT_FALSE(queue.empty());
+  EXPECT_EQ(queue.pull(), nullptr);
+  large_query->on_task_finished();
+  EXPECT_EQ(queue.pull(), deque_task);
+}
+
+TEST_F(SchedulerTest, QueryContextIsInherited) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto query_context = std::make_shared<QueryContext>(2);
+  auto job_query_context = std::shared_ptr<QueryContext>{};
+  auto max_running_task_count = std::atomic_uint{0};
+
+  auto task = std::make_shared<JobTask>([&]() {
+    auto job = std::shared_ptr<JobTask>{};
+    job = std::make_shared<JobTask>([&]() {
+      job_query_context = job->query_context();
+      max_running_task_count = query_context->running_task_count();
+    });
+    job->schedule();
+    CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{job});
+  });
+  task->set_query_context(query_context);
+  task->schedule();
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+
+  EXPECT_EQ(job_query_context, query_context);
+  // While the task waits for its job, only the job is accounted as running (see Worker::_wait_for_tasks())
+  EXPECT_EQ(max_running_task_count, 1u);
+  EXPECT_NE(query_context->id(), QueryContext{}.id());
+
+  CurrentScheduler::get()->finish();
+  EXPECT_EQ(query_context->running_task_count(), 0u);
+}
+
+TEST_F(SchedulerTest, OnlyJobsScheduledFromIntermediateScopesUseTheWorkersResource) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto global_resource = boost::container::pmr::new_delete_resource();
+  auto intermediate_job_resource = static_cast<boost::container::pmr::memory_resource*>(nullptr);
+  auto stored_job_resource = static_cast<boost::container::pmr::memory_resource*>(nullptr);
+  auto worker_resource = static_cast<boost::container::pmr::memory_resource*>(nullptr);
+
+  auto task = std::make_shared<JobTask>([&]() {
+    // E.g., a job that imports a table
+    auto stored_job =
+        std::make_shared<JobTask>([&]() { stored_job_resource = boost::container::pmr::get_default_resource(); });
+    stored_job->schedule();
+
+    // E.g., a job of a join, which is scheduled while the join allocates its intermediates on the worker's node
+    auto intermediate_job = std::shared_ptr<JobTask>{};
+    {
+      const auto scope = ScopedDefaultMemoryResource{Worker::get_this_thread_worker()->memory_resource()};
+      intermediate_job = std::make_shared<JobTask>([&]() {
+        worker_resource = Worker::get_this_thread_worker()->memory_resource();
+        intermediate_job_resource = boost::container::pmr::get_default_resource();
+      });
+      intermediate_job->schedule();
+    }
+
+    CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{stored_job, intermediate_job});
+  });
+  task->schedule();
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+
+  EXPECT_EQ(stored_job_resource, global_resource);
+  EXPECT_EQ(intermediate_job_resource, worker_resource);
+  EXPECT_NE(intermediate_job_resource, global_resource);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, WaitingTaskAdmitsTheJobsOfItsQuery) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // The running task exhausts the limit of the query, but the jobs it waits for must still be executed, both the ones
+  // on its own node (in the worker's deque) and the ones on other nodes (in their queues)
+  const auto query_context = std::make_shared<QueryContext>(1);
+  auto executed_job_count = std::atomic_uint{0};
+  auto max_running_task_count = std::atomic_uint{0};
+
+  auto task = std::make_shared<JobTask>([&]() {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto node_id = NodeID{0}; node_id < CurrentScheduler::get()->queues().size(); ++node_id) {
+      for (auto job_index = 0; job_index < 4; ++job_index) {
+        jobs.emplace_back(std::make_shared<JobTask>([&]() {
+          ++executed_job_count;
+          max_running_task_count = std::max(max_running_task_count.load(), query_context->running_task_count());
+        }));
+        jobs.back()->schedule(node_id);
+      }
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+  });
+  task->set_query_context(query_context);
+  task->schedule();
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+
+  EXPECT_EQ(executed_job_count, 4 * CurrentScheduler::get()->queues().size());
+  EXPECT_EQ(max_running_task_count, 1u);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, LargeQueryLeavesWorkersToShortQuery) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  const auto worker_count = CurrentScheduler::get()->workers().size();
+
+  // The large query has to leave a worker to the short query
+  if (worker_count <= 2) {
+    CurrentScheduler::get()->finish();
+    GTEST_SKIP();
+  }
+
+  // The jobs of the large query are scheduled by one of its tasks, i.e., they end up in the deque of a worker, from
+  // where idle workers steal them. Still, the query runs only as many of them at once as it is allowed to.
+  constexpr auto JOB_COUNT = 40u;
+  const auto large_query = std::make_shared<QueryContext>(2);
+  auto running_job_count = std::atomic_uint{0};
+  auto max_running_job_count = std::atomic_uint{0};
+  auto finished_job_count = std::atomic_uint{0};
+
+  auto large_task = std::make_shared<JobTask>([&]() {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto job_index = 0u; job_index < JOB_COUNT; ++job_index) {
+      jobs.emplace_back(std::make_shared<JobTask>([&]() {
+        const auto running = ++running_job_count;
+        max_running_job_count = std::max(max_running_job_count.load(), running);
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+        --running_job_count;
+        ++finished_job_count;
+      }));
+    }
+    CurrentScheduler::schedule_tasks(jobs);
+    CurrentScheduler::wait_for_tasks(jobs);
+  });
+  large_task->set_query_context(large_query);
+  large_task->schedule();
+
+  // Wait until the large query is busy
+  while (running_job_count == 0) std::this_thread::yield();
+
+  // A short query that arrives later is served by one of the remaining workers
+  auto short_task = std::make_shared<JobTask>([]() {});
+  short_task->set_query_context(std::make_shared<QueryContext>(2));
+  short_task->schedule();
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{short_task});
+  EXPECT_LT(finished_job_count, JOB_COUNT);
+
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{large_task});
+  EXPECT_EQ(finished_job_count, JOB_COUNT);
+  EXPECT_LE(max_running_job_count, 2u);
+  EXPECT_LT(max_running_job_count, worker_count);
+
+  CurrentScheduler::get()->finish();
+  EXPECT_EQ(large_query->running_task_count(), 0u);
+}
+
+TEST_F(SchedulerTest, CancelledQuerySkipsTasks) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto query_context = std::make_shared<QueryContext>();
+  auto executed_job_count = std::atomic_uint{0};
+  auto wait_threw = std::atomic_bool{false};
+
+  auto task = std::make_shared<JobTask>([&]() {
+    query_context->cancel();
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto job_id = 0; job_id < 10; ++job_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&]() { ++executed_job_count; }));
+      jobs.back()->schedule();
+    }
+
+    try {
+      CurrentScheduler::wait_for_tasks(jobs);
+    } catch (const QueryCancelledException&) {
+      wait_threw = true;
+      throw;
+    }
+  });
+  task->set_query_context(query_context);
+  task->schedule();
+
+  // Waiting from outside of the query does not throw, even though the task itself was cancelled
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+  EXPECT_TRUE(task->is_done());
+  EXPECT_TRUE(wait_threw);
+  EXPECT_EQ(executed_job_count, 0u);
+
+  EXPECT_THROW(query_context->throw_if_cancelled(), QueryCancelledException);
+
+  CurrentScheduler::get()->finish();
+
+  // No task remains accounted to the query, even though its execution ended with an exception
+  EXPECT_EQ(query_context->running_task_count(), 0u);
+}
+
+TEST_F(SchedulerTest, QueryContextTimeout) {
+  const auto query_context = std::make_shared<QueryContext>();
+  EXPECT_FALSE(query_context->is_cancelled());
+
+  query_context->set_timeout(std::chrono::hours{1});
+  EXPECT_FALSE(query_context->is_cancelled());
+
+  query_context->set_timeout(std::chrono::milliseconds{1});
+  std::this_thread::sleep_for(std::chrono::milliseconds{5});
+  EXPECT_TRUE(query_context->is_cancelled());
+
+  // Without a scheduler, tasks are executed right away, but they are skipped as well
+  auto executed = false;
+  auto job = std::make_shared<JobTask>([&]() { executed = true; });
+  job->set_query_context(query_context);
+  job->schedule();
+
+  EXPECT_TRUE(job->is_done());
+  EXPECT_FALSE(executed);
+}
+
 }  // namespace opossum
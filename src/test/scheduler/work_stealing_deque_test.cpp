@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "scheduler/work_stealing_deque.hpp"
+
+namespace opossum {
+
+class WorkStealingDequeTest : public BaseTest {
+ protected:
+  static std::vector<std::shared_ptr<AbstractTask>> create_tasks(const size_t count) {
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto index = size_t{0}; index < count; ++index) {
+      tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    }
+    return tasks;
+  }
+};
+
+TEST_F(WorkStealingDequeTest, PopIsLifoAndStealIsFifo) {
+  auto deque = WorkStealingDeque{};
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+
+  const auto tasks = create_tasks(4);
+  for (const auto& task : tasks) {
+    deque.push(task);
+  }
+  EXPECT_FALSE(deque.empty());
+
+  EXPECT_EQ(deque.pop(), tasks[3]);
+  EXPECT_EQ(deque.steal(), tasks[0]);
+  EXPECT_EQ(deque.pop(), tasks[2]);
+  EXPECT_EQ(deque.steal(), tasks[1]);
+
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+}
+
+TEST_F(WorkStealingDequeTest, Grow) {
+  auto deque = WorkStealingDeque{};
+
+  // Interleave pushes and steals so that the elements wrap around in the buffer before it grows
+  const auto tasks = create_tasks(WorkStealingDeque::INITIAL_CAPACITY * 4);
+  for (auto index = size_t{0}; index < tasks.size(); ++index) {
+    deque.push(tasks[index]);
+    if (index % 4 == 0) {
+      EXPECT_EQ(deque.steal(), tasks[index / 4]);
+    }
+  }
+
+  for (auto index = tasks.size() / 4; index < tasks.size(); ++index) {
+    EXPECT_EQ(deque.steal(), tasks[index]);
+  }
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST_F(WorkStealingDequeTest, DestructorReleasesTasks) {
+  const auto tasks = create_tasks(3);
+  {
+    auto deque = WorkStealingDeque{};
+    for (const auto& task : tasks) {
+      deque.push(task);
+    }
+    EXPECT_EQ(tasks[0].use_count(), 2);
+  }
+  EXPECT_EQ(tasks[0].use_count(), 1);
+}
+
+TEST_F(WorkStealingDequeTest, ConcurrentPopAndSteal) {
+  constexpr auto TASK_COUNT = size_t{100'000};
+  constexpr auto THIEF_COUNT = size_t{4};
+
+  auto deque = WorkStealingDeque{};
+  const auto tasks = create_tasks(TASK_COUNT);
+
+  // Every task has to be taken exactly once, either by the owner or by one of the thieves
+  auto taken_counts = std::vector<std::atomic<uint32_t>>(TASK_COUNT);
+  auto taken_task_count = std::atomic<size_t>{0};
+  const auto take = [&](const std::shared_ptr<AbstractTask>& task) {
+    if (!task) return;
+    const auto index = std::find(tasks.begin(), tasks.end(), task) - tasks.begin();
+    ++taken_counts[index];
+    ++taken_task_count;
+  };
+
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_id = size_t{0}; thief_id < THIEF_COUNT; ++thief_id) {
+    thieves.emplace_back([&]() {
+      while (taken_task_count < TASK_COUNT) {
+        take(deque.steal());
+      }
+    });
+  }
+
+  for (auto index = size_t{0}; index < TASK_COUNT; ++index) {
+    deque.push(tasks[index]);
+    if (index % 3 == 0) take(deque.pop());
+  }
+  while (taken_task_count < TASK_COUNT) {
+    take(deque.pop());
+  }
+
+  for (auto& thief : thieves) {
+    thief.join();
+  }
+
+  for (const auto& taken_count : taken_counts) {
+    EXPECT_EQ(taken_count, 1u);
+  }
+}
+
+TEST_F(WorkStealingDequeTest, NestedJobsAreExecutedByScheduler) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // Jobs scheduled from within a job go to the deque of the worker executing it and are stolen by the others
+  auto counter = std::atomic<uint32_t>{0};
+  auto outer_jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto outer_index = 0; outer_index < 8; ++outer_index) {
+    outer_jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      auto inner_jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+      for (auto inner_index = 0; inner_index < 16; ++inner_index) {
+        inner_jobs.emplace_back(std::make_shared<JobTask>([&]() { ++counter; }));
+        inner_jobs.back()->schedule();
+      }
+      CurrentScheduler::wait_for_tasks(inner_jobs);
+    }));
+    outer_jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(outer_jobs);
+
+  EXPECT_EQ(counter, 8u * 16u);
+
+  CurrentScheduler::get()->finish();
+}
+
+}  // namespace opossum
@@ -9,6 +9,7 @@ class MockConnection {
  public:
   MOCK_METHOD0(receive_startup_packet_header, boost::future<uint32_t>());
   MOCK_METHOD1(receive_startup_packet_body, boost::future<void>(uint32_t size));
+  MOCK_METHOD0(receive_cancel_request_body, boost::future<CancelRequestPacket>());
 
   MOCK_METHOD0(receive_packet_header, boost::future<RequestHeader>());
   MOCK_METHOD1(receive_simple_query_packet_body, boost::future<std::string>(uint32_t size));
@@ -21,6 +22,7 @@ class MockConnection {
 
   MOCK_METHOD0(send_ssl_denied, boost::future<void>());
   MOCK_METHOD0(send_auth, boost::future<void>());
+  MOCK_METHOD2(send_backend_key_data, boost::future<void>(uint32_t process_id, uint32_t secret_key));
   MOCK_METHOD2(send_parameter_status, boost::future<void>(const std::string& key, const std::string& value));
   MOCK_METHOD0(send_ready_for_query, boost::future<void>());
   MOCK_METHOD1(send_error, boost::future<void>(const std::string& message));
@@ -58,6 +58,29 @@ TEST_F(PostgresWireHandlerTest, HandleStartupPackage) {
   ASSERT_EQ(result, 92ul);  // 100 - 2 * sizeof(uint32_t)
 }
 
+TEST_F(PostgresWireHandlerTest, HandleCancelRequest) {
+  ByteBuffer buffer = {};
+  const auto append_value = [&](const uint32_t host_value) {
+    const auto value = htonl(host_value);
+    const auto chars = reinterpret_cast<const char*>(&value);
+    buffer.insert(buffer.end(), chars, chars + sizeof(uint32_t));
+  };
+  append_value(16);        // length
+  append_value(80877102);  // cancel request code
+  append_value(1234);      // process id
+  append_value(5678);      // secret key
+  _input_packet.data = buffer;
+  _input_packet.offset = _input_packet.data.cbegin();
+
+  ASSERT_EQ(postgres_wire_handler.handle_startup_package(_input_packet), PostgresWireHandler::CANCEL_REQUEST);
+
+  // The startup package is not consumed, skip it
+  _input_packet.offset += 2 * sizeof(uint32_t);
+  const auto cancel_request = postgres_wire_handler.handle_cancel_request_packet(_input_packet);
+  EXPECT_EQ(cancel_request.process_id, 1234u);
+  EXPECT_EQ(cancel_request.secret_key, 5678u);
+}
+
 TEST_F(PostgresWireHandlerTest, WriteString) {
   std::string value("Response");
 
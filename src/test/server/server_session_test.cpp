@@ -60,6 +60,9 @@ class ServerSessionTest : public BaseTest {
     // (i.e. don't throw an exception)
     ON_CALL(*_connection, send_ssl_denied()).WillByDefault(Invoke([]() { return boost::make_ready_future(); }));
     ON_CALL(*_connection, send_auth()).WillByDefault(Invoke([]() { return boost::make_ready_future(); }));
+    ON_CALL(*_connection, send_backend_key_data(_, _)).WillByDefault(Invoke([](uint32_t, uint32_t) {
+      return boost::make_ready_future();
+    }));
     ON_CALL(*_connection, send_parameter_status(_, _)).WillByDefault(Invoke([](const std::string&, const std::string&) {
       return boost::make_ready_future();
     }));
@@ -112,8 +115,10 @@ TEST_F(ServerSessionTest, SessionPerformsStartup) {
   // Make sure receive_startup_packet_body is called with the magic value defined above
   EXPECT_CALL(*_connection, receive_startup_packet_body(startup_packet_header_length));
 
-  // Expect that the session sends out an authentication response and an initial ReadyForQuery
+  // Expect that the session sends out an authentication response, the key for cancel requests, and an initial
+  // ReadyForQuery
   EXPECT_CALL(*_connection, send_auth());
+  EXPECT_CALL(*_connection, send_backend_key_data(_, _));
   EXPECT_CALL(*_connection, send_parameter_status(_, _)).Times(2);
   EXPECT_CALL(*_connection, send_ready_for_query());
 
@@ -245,6 +250,86 @@ TEST_F(ServerSessionTest, SessionExecutesSimpleQueryCommand) {
   _session->start().wait();
 }
 
+TEST_F(ServerSessionTest, SessionHandlesCancelRequest) {
+  auto process_id = uint32_t{0};
+  auto secret_key = uint32_t{0};
+  EXPECT_CALL(*_connection, send_backend_key_data(_, _)).WillOnce(Invoke([&](uint32_t pid, uint32_t key) {
+    process_id = pid;
+    secret_key = key;
+    return boost::make_ready_future();
+  }));
+
+  // Execute a query so that the session has a current QueryContext
+  RequestHeader request{NetworkMessageType::SimpleQueryCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(request))))
+      .WillOnce(Return(ByMove(boost::make_ready_future(RequestHeader{NetworkMessageType::TerminateCommand, 0}))));
+  EXPECT_CALL(*_connection, receive_simple_query_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("SELECT * FROM foo;")))));
+
+  auto create_pipeline_result = std::make_unique<CreatePipelineResult>();
+  create_pipeline_result->sql_pipeline = _create_working_sql_pipeline();
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(create_pipeline_result)))));
+
+  auto query_context = std::shared_ptr<QueryContext>{};
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerQueryTask>>()))
+      .WillOnce(Invoke([&](std::shared_ptr<ExecuteServerQueryTask> task) {
+        query_context = task->query_context();
+        return boost::make_ready_future();
+      }));
+
+  _session->start().wait();
+  ASSERT_TRUE(query_context);
+  EXPECT_FALSE(query_context->is_cancelled());
+
+  // Cancel requests are sent on a new connection, which is closed right away
+  const auto send_cancel_request = [&](const CancelRequestPacket& packet) {
+    auto connection = std::make_shared<TestConnection>();
+    EXPECT_CALL(*connection, receive_startup_packet_header())
+        .WillOnce(Return(ByMove(boost::make_ready_future(PostgresWireHandler::CANCEL_REQUEST))));
+    EXPECT_CALL(*connection, receive_cancel_request_body())
+        .WillOnce(Return(ByMove(boost::make_ready_future(packet))));
+    EXPECT_CALL(*connection, send_auth()).Times(0);
+    EXPECT_CALL(*connection, receive_packet_header()).Times(0);
+
+    std::make_shared<TestServerSession>(connection, _task_runner)->start().wait();
+  };
+
+  // Requests with a wrong secret key are ignored
+  send_cancel_request(CancelRequestPacket{process_id, secret_key + 1});
+  EXPECT_FALSE(query_context->is_cancelled());
+
+  send_cancel_request(CancelRequestPacket{process_id, secret_key});
+  EXPECT_TRUE(query_context->is_cancelled());
+}
+
+TEST_F(ServerSessionTest, SessionAppliesStatementTimeout) {
+  _session = std::make_shared<TestServerSession>(_connection, _task_runner, std::chrono::milliseconds{0});
+
+  RequestHeader request{NetworkMessageType::SimpleQueryCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(request))))
+      .WillOnce(Return(ByMove(boost::make_ready_future(RequestHeader{NetworkMessageType::TerminateCommand, 0}))));
+  EXPECT_CALL(*_connection, receive_simple_query_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("SELECT * FROM foo;")))));
+
+  auto query_context = std::shared_ptr<QueryContext>{};
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>()))
+      .WillOnce(Invoke([&](std::shared_ptr<CreatePipelineTask> task) {
+        query_context = task->query_context();
+        auto create_pipeline_result = std::make_unique<CreatePipelineResult>();
+        create_pipeline_result->load_table = std::make_pair("file", "table");
+        return boost::make_ready_future(std::move(create_pipeline_result));
+      }));
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<LoadServerFileTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future())));
+
+  _session->start().wait();
+  ASSERT_TRUE(query_context);
+  EXPECT_TRUE(query_context->is_cancelled());
+}
+
 TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   InSequence s;
 
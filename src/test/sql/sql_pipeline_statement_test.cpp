@@ -15,11 +15,13 @@
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/query_context.hpp"
 #include "scheduler/topology.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "storage/storage_manager.hpp"
+#include "utils/query_cancelled_exception.hpp"
 
 namespace {
 // This function is a slightly hacky way to check whether an LQP was optimized. This relies on JoinDetectionRule and
@@ -508,6 +510,34 @@ TEST_F(SQLPipelineStatementTest, GetResultTableNoMVCC) {
   EXPECT_EQ(sql_pipeline.transaction_context(), nullptr);
 }
 
+TEST_F(SQLPipelineStatementTest, GetResultTableCancelled) {
+  const auto query_context = std::make_shared<QueryContext>();
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.with_query_context(query_context).create_pipeline_statement();
+  EXPECT_EQ(sql_pipeline.query_context(), query_context);
+
+  query_context->cancel();
+  EXPECT_THROW(sql_pipeline.get_result_table(), QueryCancelledException);
+
+  // The auto-commit transaction is rolled back
+  EXPECT_EQ(sql_pipeline.transaction_context()->phase(), TransactionPhase::RolledBack);
+}
+
+TEST_F(SQLPipelineStatementTest, GetResultTableTimedOut) {
+  const auto query_context = std::make_shared<QueryContext>();
+  query_context->set_timeout(std::chrono::milliseconds{0});
+
+  const auto sql = "UPDATE table_a SET a = 1 WHERE a < 5";
+  auto sql_pipeline = SQLPipelineBuilder{sql}.with_query_context(query_context).create_pipeline_statement();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  EXPECT_THROW(sql_pipeline.get_result_table(), QueryCancelledException);
+
+  // The table is not modified
+  EXPECT_TABLE_EQ_UNORDERED(SQLPipelineBuilder{_select_query_a}.create_pipeline_statement().get_result_table(),
+                            _table_a);
+}
+
 TEST_F(SQLPipelineStatementTest, GetTimes) {
   const auto& cache = SQLPhysicalPlanCache::get();
   EXPECT_EQ(cache.size(), 0u);
@@ -0,0 +1,74 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "statistics/chunk_statistics/segment_statistics.hpp"
+#include "statistics/chunk_statistics/zone_map.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class ZoneMapTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Three blocks of four rows: [0, 3], only NULLs, and [5, 100] - the last block is incomplete
+    _segment = std::make_shared<ValueSegment<int32_t>>(true);
+    for (const auto value : {3, 1, 0, 2}) _segment->append(value);
+    for (auto index = 0; index < 4; ++index) _segment->append(NULL_VALUE);
+    for (const auto value : {100, 5}) _segment->append(value);
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> _segment;
+};
+
+TEST_F(ZoneMapTest, Blocks) {
+  const auto zone_map = ZoneMap::build(*_segment, 4);
+
+  EXPECT_EQ(zone_map->block_size(), 4u);
+  ASSERT_EQ(zone_map->block_count(), 3u);
+
+  EXPECT_EQ(zone_map->block_range(0), std::make_pair(ChunkOffset{0}, ChunkOffset{4}));
+  EXPECT_EQ(zone_map->block_range(1), std::make_pair(ChunkOffset{4}, ChunkOffset{8}));
+  EXPECT_EQ(zone_map->block_range(2), std::make_pair(ChunkOffset{8}, ChunkOffset{10}));
+}
+
+TEST_F(ZoneMapTest, BlockFilters) {
+  const auto zone_map = ZoneMap::build(*_segment, 4);
+
+  const auto& first_filter = zone_map->block_filter(0);
+  ASSERT_TRUE(first_filter);
+  EXPECT_FALSE(first_filter->can_prune(PredicateCondition::Equals, 0));
+  EXPECT_FALSE(first_filter->can_prune(PredicateCondition::Equals, 3));
+  EXPECT_TRUE(first_filter->can_prune(PredicateCondition::Equals, 4));
+  EXPECT_TRUE(first_filter->can_prune(PredicateCondition::GreaterThan, 3));
+
+  // A block with only NULLs has no filter
+  EXPECT_FALSE(zone_map->block_filter(1));
+
+  const auto& last_filter = zone_map->block_filter(2);
+  ASSERT_TRUE(last_filter);
+  EXPECT_TRUE(last_filter->can_prune(PredicateCondition::LessThan, 5));
+  EXPECT_FALSE(last_filter->can_prune(PredicateCondition::Between, 50, 60));
+  EXPECT_TRUE(last_filter->can_prune(PredicateCondition::Between, 101, 200));
+}
+
+TEST_F(ZoneMapTest, BuiltWithSegmentStatistics) {
+  // Small segments do not get a zone map
+  EXPECT_FALSE(SegmentStatistics::build_statistics(DataType::Int, _segment)->zone_map());
+
+  auto large_segment = std::make_shared<ValueSegment<int32_t>>();
+  for (auto value = 0; value < static_cast<int32_t>(ZoneMap::DEFAULT_BLOCK_SIZE) * 2 + 1; ++value) {
+    large_segment->append(value);
+  }
+
+  const auto zone_map = SegmentStatistics::build_statistics(DataType::Int, large_segment)->zone_map();
+  ASSERT_TRUE(zone_map);
+  EXPECT_EQ(zone_map->block_count(), 3u);
+}
+
+}  // namespace opossum
@@ -210,6 +210,35 @@ TEST_F(AdaptiveRadixTreeIndexTest, SimpleTest) {
   EXPECT_EQ(index->upper_bound({std::numeric_limits<int32_t>::max()}), index->cend());
 }
 
+TEST_F(AdaptiveRadixTreeIndexTest, FullNode16) {
+  // 16 distinct values (in reverse order) result in 16 ValueIDs that only differ in the last byte. Thus, the leaves
+  // are the children of a single, full ARTNode16.
+  std::vector<int32_t> values;
+  for (auto value = int32_t{15}; value >= 0; --value) {
+    values.emplace_back(value * 10);
+    values.emplace_back(value * 10);
+  }
+
+  auto segment = create_dict_segment_by_type<int32_t>(DataType::Int, values);
+  auto index = std::make_shared<AdaptiveRadixTreeIndex>(std::vector<std::shared_ptr<const BaseSegment>>({segment}));
+
+  for (auto value = int32_t{0}; value < 16; ++value) {
+    const auto lower_bound = index->lower_bound({value * 10});
+    const auto upper_bound = index->upper_bound({value * 10});
+    ASSERT_EQ(std::distance(lower_bound, upper_bound), 2);
+    EXPECT_EQ(*lower_bound, static_cast<ChunkOffset>((15 - value) * 2));
+    EXPECT_EQ(*(lower_bound + 1), static_cast<ChunkOffset>((15 - value) * 2 + 1));
+
+    // Values in between are not found, but the bounds point to the next larger value
+    EXPECT_EQ(index->lower_bound({value * 10 + 5}), upper_bound);
+    EXPECT_EQ(index->upper_bound({value * 10 + 5}), upper_bound);
+  }
+
+  EXPECT_EQ(index->lower_bound({-1}), index->cbegin());
+  EXPECT_EQ(index->lower_bound({151}), index->cend());
+  EXPECT_EQ(index->upper_bound({150}), index->cend());
+}
+
 /**
 * The following two cases try to test two rather extreme situations that both
 * test the node overflow handling of the ART implementation:
@@ -203,4 +203,32 @@ TEST_F(StorageChunkTest, RemoveIndex) {
             indices_for_segment_0.cend());
 }
 
+TEST_F(StorageChunkTest, OrderedBy) {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data);
+  table->append({1});
+  table->append({2});
+  const auto chunk = table->get_chunk(ChunkID{0});
+  EXPECT_FALSE(chunk->ordered_by());
+
+  chunk->set_ordered_by({ColumnID{0}, OrderByMode::Ascending});
+  ASSERT_TRUE(chunk->ordered_by());
+  EXPECT_EQ(chunk->ordered_by()->first, ColumnID{0});
+  EXPECT_EQ(chunk->ordered_by()->second, OrderByMode::Ascending);
+
+  // Appended rows would break the order, so they go into a new chunk
+  EXPECT_FALSE(chunk->is_mutable());
+  table->append({0});
+  EXPECT_EQ(table->chunk_count(), 2u);
+  EXPECT_EQ(chunk->size(), 2u);
+
+  // The order is kept when the chunk is encoded
+  ChunkEncoder::encode_chunk(chunk, {DataType::Int}, SegmentEncodingSpec{EncodingType::Dictionary});
+  ASSERT_TRUE(chunk->ordered_by());
+  EXPECT_EQ(chunk->ordered_by()->first, ColumnID{0});
+
+  if (HYRISE_DEBUG) {
+    EXPECT_THROW(chunk->set_ordered_by({ColumnID{1}, OrderByMode::Ascending}), std::exception);
+  }
+}
+
 }  // namespace opossum
@@ -15,6 +15,8 @@
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
 #include "storage/constraints/unique_checker.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/partitioning/hash_partition_schema.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 
@@ -171,6 +173,35 @@ TEST_F(ConstraintsTest, InvalidInsert) {
   EXPECT_TRUE(context->rollback());
 }
 
+TEST_F(ConstraintsTest, SingleColumnConstraintUsesTableIndex) {
+  const auto table = StorageManager::get().get_table("table");
+
+  // Adding the constraint created a table index on the column, which is maintained by the Insert operator
+  const auto table_index = table->get_table_index(ColumnID{0});
+  ASSERT_TRUE(table_index);
+  EXPECT_EQ(table_index->size(), 3u);
+
+  auto new_values = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+  new_values->append({7, 42, 42, 42});
+  auto [ins, context] = _insert_values("table", new_values);
+  EXPECT_FALSE(ins->execute_failed());
+  EXPECT_TRUE(context->commit());
+  EXPECT_EQ(table_index->size(), 4u);
+
+  // The value that was just inserted is found in the index
+  auto duplicate_values = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+  duplicate_values->append({7, 43, 43, 43});
+  auto [duplicate_ins, duplicate_context] = _insert_values("table", duplicate_values);
+  EXPECT_TRUE(duplicate_ins->execute_failed());
+  EXPECT_TRUE(duplicate_context->rollback());
+  EXPECT_EQ(table_index->size(), 4u);
+
+  // Multi-column constraints are still checked by scanning the table
+  table->add_unique_constraint({ColumnID{1}, ColumnID{2}});
+  EXPECT_FALSE(table->get_table_index(ColumnID{1}));
+  EXPECT_FALSE(table->get_table_index(ColumnID{2}));
+}
+
 TEST_F(ConstraintsTest, InvalidInsertOnDict) {
   auto& manager = StorageManager::get();
   auto table = manager.get_table("table");
@@ -423,4 +454,25 @@ TEST_F(ConstraintsTest, ConcurrentInsertInsertRace) {
   EXPECT_EQ(insert_1->state(), ReadWriteOperatorState::RolledBack);
 }
 
+TEST_F(ConstraintsTest, InsertInsertRaceOnPartitionedTable) {
+  // The chunks of a partitioned table are only created by the insert. Without any chunks at the time of the first
+  // insert, the chunks created by the second one still have to be checked when the first one commits.
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+  table->set_partition_schema(std::make_shared<HashPartitionSchema>(ColumnID{0}, DataType::Int, PartitionID{2}));
+  table->add_unique_constraint({ColumnID{0}});
+  StorageManager::get().add_table("partitioned_table", table);
+
+  auto new_values = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+  new_values->append({5, 42, 1, 42});
+
+  auto[insert_1, insert_1_context] = _insert_values("partitioned_table", new_values);
+  EXPECT_FALSE(insert_1->execute_failed());
+  auto[insert_2, insert_2_context] = _insert_values("partitioned_table", new_values);
+  EXPECT_FALSE(insert_2->execute_failed());
+
+  EXPECT_TRUE(insert_2_context->commit());
+  EXPECT_FALSE(insert_1_context->commit());
+  EXPECT_EQ(insert_1_context->phase(), TransactionPhase::RolledBack);
+}
+
 }  // namespace opossum
@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/base_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/index/hash/hash_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class HashIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    values = {"hotel", "delta", "frank", "delta", "apple", "charlie", "charlie", "inbox"};
+    segment = std::make_shared<ValueSegment<std::string>>(values);
+    index = std::make_shared<HashIndex>(std::vector<std::shared_ptr<const BaseSegment>>({segment}));
+  }
+
+  // Returns the ChunkOffsets in [lower_bound(value), upper_bound(value))
+  static std::vector<ChunkOffset> positions(const BaseIndex& index, const AllTypeVariant& value) {
+    return std::vector<ChunkOffset>(index.lower_bound({value}), index.upper_bound({value}));
+  }
+
+  std::vector<std::string> values;
+  std::shared_ptr<HashIndex> index = nullptr;
+  std::shared_ptr<ValueSegment<std::string>> segment = nullptr;
+};
+
+TEST_F(HashIndexTest, IndexProbes) {
+  EXPECT_EQ(positions(*index, "apple"), std::vector<ChunkOffset>({4}));
+  EXPECT_EQ(positions(*index, "charlie"), std::vector<ChunkOffset>({5, 6}));
+  EXPECT_EQ(positions(*index, "delta"), std::vector<ChunkOffset>({1, 3}));
+  EXPECT_EQ(positions(*index, "frank"), std::vector<ChunkOffset>({2}));
+  EXPECT_EQ(positions(*index, "hotel"), std::vector<ChunkOffset>({0}));
+  EXPECT_EQ(positions(*index, "inbox"), std::vector<ChunkOffset>({7}));
+
+  // Values that are not contained result in an empty range
+  EXPECT_EQ(index->lower_bound({"bravo"}), index->cend());
+  EXPECT_EQ(index->upper_bound({"bravo"}), index->cend());
+  EXPECT_EQ(index->lower_bound({NULL_VALUE}), index->cend());
+}
+
+TEST_F(HashIndexTest, AllOtherPositionsSurroundTheRangeOfAValue) {
+  // This is what IndexScan relies on for NotEquals
+  auto other_positions = std::vector<ChunkOffset>(index->cbegin(), index->lower_bound({"delta"}));
+  other_positions.insert(other_positions.end(), index->upper_bound({"delta"}), index->cend());
+  std::sort(other_positions.begin(), other_positions.end());
+
+  EXPECT_EQ(other_positions, std::vector<ChunkOffset>({0, 2, 4, 5, 6, 7}));
+}
+
+TEST_F(HashIndexTest, ManyDistinctValues) {
+  // Forces the hash table to grow several times. Without mixing the hash, multiples of 1024 would collide.
+  auto int_values = std::vector<int32_t>{};
+  auto null_values = std::vector<bool>{};
+  for (auto value = 0; value < 1000; ++value) {
+    int_values.push_back(value * 1024);
+    null_values.push_back(value % 10 == 0);
+  }
+  int_values.push_back(1024);
+  null_values.push_back(false);
+
+  const auto int_segment = std::make_shared<ValueSegment<int32_t>>(std::move(int_values), std::move(null_values));
+  const auto int_index = HashIndex{std::vector<std::shared_ptr<const BaseSegment>>({int_segment})};
+
+  // NULLs are not indexed
+  EXPECT_EQ(std::distance(int_index.cbegin(), int_index.cend()), 901);
+  EXPECT_EQ(positions(int_index, 0), std::vector<ChunkOffset>{});
+  EXPECT_EQ(positions(int_index, 1024), std::vector<ChunkOffset>({1, 1000}));
+  EXPECT_EQ(positions(int_index, 999 * 1024), std::vector<ChunkOffset>({999}));
+  EXPECT_EQ(positions(int_index, 1025), std::vector<ChunkOffset>{});
+}
+
+TEST_F(HashIndexTest, EmptySegment) {
+  const auto empty_segment = std::make_shared<ValueSegment<int32_t>>();
+  const auto empty_index = HashIndex{std::vector<std::shared_ptr<const BaseSegment>>({empty_segment})};
+
+  EXPECT_EQ(empty_index.cbegin(), empty_index.cend());
+  EXPECT_EQ(empty_index.lower_bound({1}), empty_index.cend());
+}
+
+TEST_F(HashIndexTest, MemoryConsumption) {
+  // The 6 distinct values are stored in 16 slots (load factor <= 0.5), each holding a value and a range of
+  // ChunkOffsets. No string exceeds the reserved space for short strings.
+  const auto slot_size = sizeof(std::string) + 2 * sizeof(ChunkOffset);
+  EXPECT_EQ(index->memory_consumption(),
+            2 * sizeof(std::vector<ChunkOffset>) + 8 * sizeof(ChunkOffset) + 16 * slot_size);
+}
+
+}  // namespace opossum
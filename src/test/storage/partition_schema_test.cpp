@@ -0,0 +1,118 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/partitioning/hash_partition_schema.hpp"
+#include "storage/partitioning/range_partition_schema.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class PartitionSchemaTest : public BaseTest {};
+
+TEST_F(PartitionSchemaTest, RangeMatchingPartition) {
+  const auto schema = RangePartitionSchema{ColumnID{0}, DataType::Int, {10, 20}};
+
+  EXPECT_EQ(schema.partition_count(), PartitionID{3});
+  EXPECT_EQ(schema.get_matching_partition(-5), PartitionID{0});
+  EXPECT_EQ(schema.get_matching_partition(9), PartitionID{0});
+  EXPECT_EQ(schema.get_matching_partition(10), PartitionID{1});
+  EXPECT_EQ(schema.get_matching_partition(19), PartitionID{1});
+  EXPECT_EQ(schema.get_matching_partition(20), PartitionID{2});
+  EXPECT_EQ(schema.get_matching_partition(int64_t{1'000}), PartitionID{2});
+  EXPECT_EQ(schema.get_matching_partition(NULL_VALUE), PartitionID{0});
+}
+
+TEST_F(PartitionSchemaTest, RangeCanPrune) {
+  const auto schema = RangePartitionSchema{ColumnID{0}, DataType::Int, {10, 20}};
+
+  // Partition 1 holds the values in [10, 20)
+  EXPECT_TRUE(schema.can_prune(PartitionID{1}, PredicateCondition::Equals, 9));
+  EXPECT_FALSE(schema.can_prune(PartitionID{1}, PredicateCondition::Equals, 10));
+  EXPECT_FALSE(schema.can_prune(PartitionID{1}, PredicateCondition::Equals, 19));
+  EXPECT_TRUE(schema.can_prune(PartitionID{1}, PredicateCondition::Equals, 20));
+
+  EXPECT_TRUE(schema.can_prune(PartitionID{1}, PredicateCondition::LessThan, 10));
+  EXPECT_FALSE(schema.can_prune(PartitionID{1}, PredicateCondition::LessThan, 11));
+  EXPECT_TRUE(schema.can_prune(PartitionID{1}, PredicateCondition::LessThanEquals, 9));
+  EXPECT_FALSE(schema.can_prune(PartitionID{1}, PredicateCondition::LessThanEquals, 10));
+  EXPECT_TRUE(schema.can_prune(PartitionID{1}, PredicateCondition::GreaterThanEquals, 20));
+  EXPECT_FALSE(schema.can_prune(PartitionID{1}, PredicateCondition::GreaterThanEquals, 19));
+
+  EXPECT_TRUE(schema.can_prune(PartitionID{1}, PredicateCondition::Between, 0, 9));
+  EXPECT_FALSE(schema.can_prune(PartitionID{1}, PredicateCondition::Between, 0, 10));
+  EXPECT_TRUE(schema.can_prune(PartitionID{1}, PredicateCondition::Between, 20, 30));
+
+  // The first and the last partition are unbounded on one side
+  EXPECT_FALSE(schema.can_prune(PartitionID{0}, PredicateCondition::LessThan, -1'000));
+  EXPECT_TRUE(schema.can_prune(PartitionID{0}, PredicateCondition::GreaterThan, 10));
+  EXPECT_FALSE(schema.can_prune(PartitionID{2}, PredicateCondition::GreaterThan, 1'000));
+  EXPECT_TRUE(schema.can_prune(PartitionID{2}, PredicateCondition::LessThan, 20));
+
+  // Other predicates and NULLs never prune
+  EXPECT_FALSE(schema.can_prune(PartitionID{1}, PredicateCondition::NotEquals, 5));
+  EXPECT_FALSE(schema.can_prune(PartitionID{1}, PredicateCondition::Equals, NULL_VALUE));
+}
+
+TEST_F(PartitionSchemaTest, RangeInvalidBounds) {
+  EXPECT_THROW(RangePartitionSchema(ColumnID{0}, DataType::Int, {}), std::logic_error);
+  EXPECT_THROW(RangePartitionSchema(ColumnID{0}, DataType::Int, {20, 10}), std::logic_error);
+  EXPECT_THROW(RangePartitionSchema(ColumnID{0}, DataType::Int, {10, NULL_VALUE}), std::logic_error);
+}
+
+TEST_F(PartitionSchemaTest, Hash) {
+  const auto schema = HashPartitionSchema{ColumnID{0}, DataType::String, PartitionID{4}};
+
+  EXPECT_EQ(schema.partition_count(), PartitionID{4});
+
+  const auto partition_id = schema.get_matching_partition("tenant_a");
+  EXPECT_LT(partition_id, PartitionID{4});
+  EXPECT_EQ(schema.get_matching_partition("tenant_a"), partition_id);
+  EXPECT_EQ(schema.get_matching_partition(NULL_VALUE), PartitionID{0});
+
+  for (auto other_partition_id = PartitionID{0}; other_partition_id < PartitionID{4}; ++other_partition_id) {
+    EXPECT_EQ(schema.can_prune(other_partition_id, PredicateCondition::Equals, "tenant_a"),
+              other_partition_id != partition_id);
+    EXPECT_FALSE(schema.can_prune(other_partition_id, PredicateCondition::LessThan, "tenant_a"));
+  }
+}
+
+TEST_F(PartitionSchemaTest, TableRoutesRowsToPartitions) {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 2);
+  table->set_partition_schema(std::make_shared<RangePartitionSchema>(ColumnID{0}, DataType::Int,
+                                                                     std::vector<AllTypeVariant>{10}));
+
+  table->append({1});
+  table->append({11});
+  table->append({2});
+  table->append({3});
+  table->append({12});
+
+  // Chunk 0: [1, 2], chunk 1: [11, 12], chunk 2: [3]
+  ASSERT_EQ(table->chunk_count(), 3u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->partition_id(), PartitionID{0});
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->partition_id(), PartitionID{1});
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->partition_id(), PartitionID{0});
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 2u);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->size(), 2u);
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->size(), 1u);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{0}, 3), 12);
+
+  // The schema cannot be changed once the table holds data
+  EXPECT_THROW(table->set_partition_schema(std::make_shared<HashPartitionSchema>(ColumnID{0}, DataType::Int,
+                                                                                 PartitionID{2})),
+               std::logic_error);
+}
+
+TEST_F(PartitionSchemaTest, SchemaMustMatchColumn) {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data);
+  EXPECT_THROW(
+      table->set_partition_schema(std::make_shared<HashPartitionSchema>(ColumnID{1}, DataType::Int, PartitionID{2})),
+      std::logic_error);
+  EXPECT_THROW(table->set_partition_schema(
+                   std::make_shared<HashPartitionSchema>(ColumnID{0}, DataType::String, PartitionID{2})),
+               std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class TableIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, false}}, TableType::Data, 3);
+    _table->append({5, "five"});
+    _table->append({3, "three"});
+    _table->append({NULL_VALUE, "null"});
+    _table->append({7, "seven"});
+    _table->append({3, "three again"});
+    _table->append({1, "one"});
+    _table->append({9, "nine"});
+  }
+
+  // The index returns the matches ordered by value, which is not defined for duplicates
+  static PosList sorted(PosList pos_list) {
+    std::sort(pos_list.begin(), pos_list.end());
+    return pos_list;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(TableIndexTest, CreateIndexesExistingRows) {
+  const auto index = _table->create_table_index(ColumnID{0});
+
+  EXPECT_EQ(index->column_id(), ColumnID{0});
+  EXPECT_EQ(_table->get_table_index(ColumnID{0}), index);
+  EXPECT_EQ(_table->get_table_index(ColumnID{1}), nullptr);
+  EXPECT_EQ(_table->table_indexes().size(), 1u);
+
+  // NULLs are not indexed
+  EXPECT_EQ(index->size(), 6u);
+}
+
+TEST_F(TableIndexTest, CreateTwiceThrows) {
+  _table->create_table_index(ColumnID{0});
+  EXPECT_THROW(_table->create_table_index(ColumnID{0}), std::logic_error);
+}
+
+TEST_F(TableIndexTest, Lookup) {
+  const auto index = _table->create_table_index(ColumnID{0});
+
+  // The table has the chunks [5, 3, NULL], [7, 3, 1], [9]
+  EXPECT_EQ(sorted(index->lookup(PredicateCondition::Equals, 3)),
+            PosList({RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 1}}));
+  EXPECT_EQ(index->lookup(PredicateCondition::Equals, 4), PosList{});
+  EXPECT_EQ(index->lookup(PredicateCondition::LessThan, 3), PosList({RowID{ChunkID{1}, 2}}));
+  EXPECT_EQ(index->lookup(PredicateCondition::LessThanEquals, 3).size(), 3u);
+  EXPECT_EQ(index->lookup(PredicateCondition::GreaterThan, 7), PosList({RowID{ChunkID{2}, 0}}));
+  EXPECT_EQ(index->lookup(PredicateCondition::GreaterThanEquals, 7).size(), 2u);
+  EXPECT_EQ(index->lookup(PredicateCondition::NotEquals, 3).size(), 4u);
+  EXPECT_EQ(index->lookup(PredicateCondition::Between, 3, AllTypeVariant{5}).size(), 3u);
+  EXPECT_EQ(index->lookup(PredicateCondition::Between, 5, AllTypeVariant{3}), PosList{});
+
+  // Values of other types are cast to the column type, NULL never matches
+  EXPECT_EQ(index->lookup(PredicateCondition::Equals, int64_t{9}), PosList({RowID{ChunkID{2}, 0}}));
+  EXPECT_EQ(index->lookup(PredicateCondition::Equals, NULL_VALUE), PosList{});
+  EXPECT_EQ(index->lookup(PredicateCondition::NotEquals, NULL_VALUE), PosList{});
+}
+
+TEST_F(TableIndexTest, CountAndLookupValues) {
+  const auto index = std::static_pointer_cast<TableIndex<int32_t>>(_table->create_table_index(ColumnID{0}));
+
+  EXPECT_EQ(index->count(PredicateCondition::Equals, 3), 2u);
+  EXPECT_EQ(index->count(PredicateCondition::LessThanEquals, 5), 4u);
+  EXPECT_EQ(index->count(PredicateCondition::NotEquals, NULL_VALUE), 0u);
+
+  // Values are returned in the same order as the RowIDs of lookup()
+  EXPECT_EQ(index->lookup_values(PredicateCondition::GreaterThanEquals, 5), std::vector<int32_t>({5, 7, 9}));
+  EXPECT_EQ(index->lookup_values(PredicateCondition::Between, 1, AllTypeVariant{3}),
+            std::vector<int32_t>({1, 3, 3}));
+}
+
+TEST_F(TableIndexTest, LookupOnEncodedChunks) {
+  ChunkEncoder::encode_all_chunks(_table, SegmentEncodingSpec{EncodingType::Dictionary});
+  const auto index = _table->create_table_index(ColumnID{1});
+
+  EXPECT_EQ(index->lookup(PredicateCondition::Equals, "seven"), PosList({RowID{ChunkID{1}, 0}}));
+  EXPECT_EQ(index->lookup(PredicateCondition::GreaterThanEquals, "three").size(), 2u);
+}
+
+TEST_F(TableIndexTest, MaintainedByAppend) {
+  const auto index = _table->create_table_index(ColumnID{0});
+
+  _table->append({3, "three in a new chunk"});
+  _table->append({NULL_VALUE, "another null"});
+
+  EXPECT_EQ(index->size(), 7u);
+  EXPECT_EQ(sorted(index->lookup(PredicateCondition::Equals, 3)),
+            PosList({RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 1}, RowID{ChunkID{2}, 1}}));
+}
+
+TEST_F(TableIndexTest, EraseRows) {
+  const auto index = _table->create_table_index(ColumnID{0});
+
+  // Removes 3 and 1 from the chunk [7, 3, 1] and the NULL from [5, 3, NULL], which is skipped
+  index->erase_rows(*_table->get_chunk(ChunkID{1}), ChunkID{1}, 1, 3);
+  index->erase_rows(*_table->get_chunk(ChunkID{0}), ChunkID{0}, 2, 3);
+
+  EXPECT_EQ(index->size(), 4u);
+  EXPECT_EQ(index->lookup(PredicateCondition::Equals, 3), PosList({RowID{ChunkID{0}, 1}}));
+  EXPECT_EQ(index->lookup(PredicateCondition::Equals, 1), PosList{});
+  EXPECT_EQ(index->lookup(PredicateCondition::Equals, 7), PosList({RowID{ChunkID{1}, 0}}));
+}
+
+}  // namespace opossum
@@ -8,6 +8,8 @@
 #include "gtest/gtest.h"
 
 #include "resolve_type.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -180,6 +182,27 @@ TEST_F(StorageTableTest, MemoryUsageEstimation) {
                                                      sizeof(TransactionID) + 2 * sizeof(CommitID));
 }
 
+TEST_F(StorageTableTest, CreateIndexByType) {
+  for (auto i = 0; i < 5; ++i) {
+    t->append({i, "Hello"});
+  }
+  ChunkEncoder::encode_all_chunks(t);
+
+  t->create_index(SegmentIndexType::GroupKey, {ColumnID{0}}, "a");
+
+  ASSERT_EQ(t->get_indexes().size(), 1u);
+  EXPECT_EQ(t->get_indexes()[0].type, SegmentIndexType::GroupKey);
+  EXPECT_EQ(t->get_indexes()[0].name, "a");
+
+  // Chunks that already have an index of the same type are skipped
+  t->create_index<GroupKeyIndex>({ColumnID{0}});
+  for (auto chunk_id = ChunkID{0}; chunk_id < t->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(t->get_chunk(chunk_id)->get_indices(std::vector<ColumnID>{ColumnID{0}}).size(), 1u);
+  }
+
+  EXPECT_THROW(t->create_index(SegmentIndexType::Invalid, {ColumnID{0}}), std::logic_error);
+}
+
 TEST_F(StorageTableTest, StableChunks) {
   // Tests that pointers to a chunk remain valid even if the table grows (#1463)
   auto table = std::make_shared<Table>(column_definitions, TableType::Data, 1);
@@ -7,11 +7,20 @@
 
 #include "expression/expression_functional.hpp"
 #include "operators/abstract_join_operator.hpp"
+#include "operators/chunk_pipeline.hpp"
 #include "operators/get_table.hpp"
+#include "operators/import_csv.hpp"
+#include "operators/index_scan.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
 #include "operators/union_positions.hpp"
+#include "operators/validate.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/storage_manager.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -123,4 +132,156 @@ TEST_F(OperatorTaskTest, MakeDiamondShape) {
   EXPECT_EQ(scan_b->get_output(), nullptr);
   EXPECT_EQ(scan_c->get_output(), nullptr);
 }
+
+TEST_F(OperatorTaskTest, InputRowCount) {
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto table_wrapper = std::make_shared<TableWrapper>(_test_table_b);
+  auto join = std::make_shared<JoinHash>(gt_a, table_wrapper, JoinMode::Inner, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                         PredicateCondition::Equals);
+  EXPECT_EQ(OperatorTask::input_row_count(OperatorTask::make_tasks_from_operator(join, CleanupTemporaries::Yes)),
+            size_t{6});
+
+  // The size of files to import is unknown
+  auto import_csv = std::make_shared<ImportCsv>("resources/test_data/csv/float.csv");
+  EXPECT_EQ(OperatorTask::input_row_count(OperatorTask::make_tasks_from_operator(import_csv, CleanupTemporaries::Yes)),
+            std::nullopt);
+
+  // The table is not created yet
+  auto gt_c = std::make_shared<GetTable>("table_c");
+  EXPECT_EQ(OperatorTask::input_row_count(OperatorTask::make_tasks_from_operator(gt_c, CleanupTemporaries::Yes)),
+            std::nullopt);
+}
+
+TEST_F(OperatorTaskTest, InputRowCountOfPrunedAndIndexScannedChunks) {
+  // table_a has two chunks with two and one rows
+  const auto count_rows = [](const std::shared_ptr<AbstractOperator>& op) {
+    return OperatorTask::input_row_count(OperatorTask::make_tasks_from_operator(op, CleanupTemporaries::Yes));
+  };
+
+  auto pruned_gt_a = std::make_shared<GetTable>("table_a");
+  pruned_gt_a->set_excluded_chunk_ids({ChunkID{0}});
+  EXPECT_EQ(count_rows(pruned_gt_a), size_t{1});
+
+  const auto make_index_scan = [](const std::shared_ptr<AbstractOperator>& input) {
+    auto index_scan = std::make_shared<IndexScan>(input, SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}},
+                                                  PredicateCondition::Equals, std::vector<AllTypeVariant>{123});
+    index_scan->set_included_chunk_ids({ChunkID{0}});
+    return index_scan;
+  };
+
+  // The chunks of the IndexScan are numbered without the pruned ones
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  EXPECT_EQ(count_rows(make_index_scan(gt_a)), size_t{2});
+  EXPECT_EQ(count_rows(make_index_scan(pruned_gt_a)), size_t{1});
+
+  // All chunks are read if another operator consumes the GetTable as well
+  auto shared_gt_a = std::make_shared<GetTable>("table_a");
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto table_scan = std::make_shared<TableScan>(shared_gt_a, greater_than_(a, 200));
+  auto union_positions = std::make_shared<UnionPositions>(make_index_scan(shared_gt_a), table_scan);
+  EXPECT_EQ(count_rows(union_positions), size_t{3});
+}
+
+TEST_F(OperatorTaskTest, ExecuteTasksInlineForSmallInputs) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto execute_join = [&]() {
+    auto gt_a = std::make_shared<GetTable>("table_a");
+    auto gt_b = std::make_shared<GetTable>("table_b");
+    auto join = std::make_shared<JoinHash>(gt_a, gt_b, JoinMode::Inner, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                           PredicateCondition::Equals);
+
+    auto tasks = OperatorTask::make_tasks_from_operator(join, CleanupTemporaries::Yes);
+    OperatorTask::execute_tasks(tasks);
+
+    auto expected_result = load_table("resources/test_data/tbl/joinoperators/int_inner_join.tbl", 2);
+    EXPECT_TABLE_EQ_UNORDERED(expected_result, tasks.back()->get_operator()->get_output());
+    EXPECT_EQ(gt_a->get_output(), nullptr);
+    EXPECT_EQ(gt_b->get_output(), nullptr);
+
+    return tasks;
+  };
+
+  // Tasks that are executed inline never pass through a queue
+  for (const auto& task : execute_join()) {
+    EXPECT_TRUE(task->is_done());
+    EXPECT_EQ(task->enqueued_time(), std::chrono::steady_clock::time_point{});
+  }
+
+  OperatorTask::set_inline_execution_threshold(0);
+  for (const auto& task : execute_join()) {
+    EXPECT_TRUE(task->is_done());
+    EXPECT_NE(task->enqueued_time(), std::chrono::steady_clock::time_point{});
+  }
+  OperatorTask::set_inline_execution_threshold(OperatorTask::DEFAULT_INLINE_EXECUTION_THRESHOLD);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(OperatorTaskTest, OperatorsYieldWhileWaitingForTheirJobs) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  OperatorTask::set_inline_execution_threshold(0);
+
+  // Large enough for the TableScan and the JoinHash to split their inputs into morsels that are processed by JobTasks,
+  // after which the OperatorTasks continue (see AbstractOperator::_continue_after_tasks())
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{50'000});
+  for (auto value = 0; value < 100'000; ++value) {
+    table->append({value});
+  }
+  StorageManager::get().add_table("table_large", table);
+
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto table_scan = std::make_shared<TableScan>(std::make_shared<GetTable>("table_large"), less_than_(a, 60'000));
+  const auto join = std::make_shared<JoinHash>(table_scan, std::make_shared<GetTable>("table_large"), JoinMode::Inner,
+                                               ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(join, CleanupTemporaries::No);
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  for (const auto& task : tasks) {
+    EXPECT_TRUE(task->is_done());
+  }
+  EXPECT_EQ(table_scan->get_output()->row_count(), 60'000u);
+  EXPECT_EQ(join->get_output()->row_count(), 60'000u);
+  EXPECT_GT(join->performance_data().walltime.count(), 0);
+
+  OperatorTask::set_inline_execution_threshold(OperatorTask::DEFAULT_INLINE_EXECUTION_THRESHOLD);
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(OperatorTaskTest, PipelinedChain) {
+  ChunkPipeline::set_enabled(true);
+
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto gt = std::make_shared<GetTable>("table_a");
+  const auto scan_a = std::make_shared<TableScan>(gt, greater_than_(a, 200));
+  const auto scan_b = std::make_shared<TableScan>(scan_a, less_than_(a, 20'000));
+  const auto projection = std::make_shared<Projection>(scan_b, expression_vector(a));
+
+  // The chain above the GetTable is executed by a single task
+  const auto tasks = OperatorTask::make_tasks_from_operator(projection, CleanupTemporaries::No);
+  ASSERT_EQ(tasks.size(), 2u);
+  EXPECT_EQ(tasks[0]->get_operator(), gt);
+  EXPECT_EQ(tasks[1]->get_operator(), projection);
+
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  const auto expected = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data);
+  expected->append({12345});
+  expected->append({1234});
+  EXPECT_TABLE_EQ_UNORDERED(projection->get_output(), expected);
+  EXPECT_EQ(scan_a->get_output(), nullptr);
+
+  // Operators whose output is consumed by more than one operator end the chain
+  const auto union_positions = std::make_shared<UnionPositions>(
+      std::make_shared<TableScan>(scan_b, greater_than_(a, 1'000)), std::make_shared<Validate>(scan_b));
+  const auto union_tasks = OperatorTask::make_tasks_from_operator(union_positions, CleanupTemporaries::No);
+  ASSERT_EQ(union_tasks.size(), 5u);
+  EXPECT_EQ(union_tasks[1]->get_operator(), scan_b);
+
+  ChunkPipeline::set_enabled(false);
+}
+
 }  // namespace opossum
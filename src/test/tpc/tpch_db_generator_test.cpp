@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 
+#include "benchmark_config.hpp"
 #include "storage/storage_manager.hpp"
 #include "testing_assert.hpp"
 #include "tpch/tpch_table_generator.hpp"
@@ -70,4 +71,37 @@ TEST(TpchDbGeneratorTest, GenerateAndStore) {
 
   StorageManager::reset();
 }
+
+TEST(TpchDbGeneratorTest, GenerateAndStoreSorted) {
+  const auto chunk_size = 1000;
+  auto benchmark_config = std::make_shared<BenchmarkConfig>(BenchmarkConfig::get_default_config());
+  benchmark_config->chunk_size = chunk_size;
+  benchmark_config->sort_tables = true;
+  TpchTableGenerator(0.001f, benchmark_config).generate_and_store();
+
+  const auto lineitem = StorageManager::get().get_table("lineitem");
+  EXPECT_TABLE_EQ_UNORDERED(lineitem, load_table("resources/test_data/tbl/tpch/sf-0.001/lineitem.tbl", chunk_size));
+  EXPECT_EQ(lineitem->has_mvcc(), UseMvcc::Yes);
+
+  const auto shipdate_column_id = lineitem->column_id_by_name("l_shipdate");
+  auto previous_shipdate = std::string{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < lineitem->chunk_count(); ++chunk_id) {
+    const auto chunk = lineitem->get_chunk(chunk_id);
+    ASSERT_TRUE(chunk->ordered_by());
+    EXPECT_EQ(chunk->ordered_by()->first, shipdate_column_id);
+    EXPECT_EQ(chunk->ordered_by()->second, OrderByMode::Ascending);
+
+    const auto& segment = *chunk->get_segment(shipdate_column_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      const auto shipdate = type_cast_variant<std::string>(segment[chunk_offset]);
+      EXPECT_LE(previous_shipdate, shipdate);
+      previous_shipdate = shipdate;
+    }
+  }
+
+  // Tables without a sort column are not touched
+  EXPECT_FALSE(StorageManager::get().get_table("part")->get_chunk(ChunkID{0})->ordered_by());
+
+  StorageManager::reset();
+}
 }  // namespace opossum
@@ -6,6 +6,7 @@
 #include <numa.h>
 #endif
 
+#include "storage/pos_list.hpp"
 #include "types.hpp"
 #include "utils/numa_memory_resource.hpp"
 
@@ -39,4 +40,37 @@ TEST_F(NUMAMemoryResourceTest, BasicAllocate) {
   EXPECT_EQ(get_node_id_of(vec.data()), numa_node);
 }
 
+TEST_F(NUMAMemoryResourceTest, ScopedDefaultMemoryResource) {
+  auto memory_resource_a = NUMAMemoryResource(0, "test_a");
+  auto memory_resource_b = NUMAMemoryResource(0, "test_b");
+  const auto global_resource = boost::container::pmr::get_default_resource();
+  EXPECT_EQ(ScopedDefaultMemoryResource::current(), nullptr);
+
+  {
+    const auto scope_a = ScopedDefaultMemoryResource{&memory_resource_a};
+    EXPECT_EQ(boost::container::pmr::get_default_resource(), &memory_resource_a);
+
+    {
+      const auto scope_b = ScopedDefaultMemoryResource{&memory_resource_b};
+      EXPECT_EQ(ScopedDefaultMemoryResource::current(), &memory_resource_b);
+
+      // Default constructed allocators, e.g., those of intermediate results, use the innermost resource
+      auto pos_list = PosList{RowID{ChunkID{0}, ChunkOffset{1}}};
+      EXPECT_EQ(pos_list.get_allocator().resource(), &memory_resource_b);
+      EXPECT_EQ(pos_list[0], (RowID{ChunkID{0}, ChunkOffset{1}}));
+    }
+
+    {
+      // Stored data is allocated from the global resource
+      const auto global_scope = ScopedDefaultMemoryResource{nullptr};
+      EXPECT_EQ(boost::container::pmr::get_default_resource(), global_resource);
+    }
+
+    EXPECT_EQ(boost::container::pmr::get_default_resource(), &memory_resource_a);
+  }
+
+  EXPECT_EQ(boost::container::pmr::get_default_resource(), global_resource);
+  EXPECT_EQ(ScopedDefaultMemoryResource::current(), nullptr);
+}
+
 }  // namespace opossum
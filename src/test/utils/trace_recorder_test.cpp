@@ -0,0 +1,131 @@
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+#include "json.hpp"
+
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "utils/load_table.hpp"
+#include "utils/tracing/trace_recorder.hpp"
+
+namespace opossum {
+
+class TraceRecorderTest : public BaseTest {
+ protected:
+  void TearDown() override { TraceRecorder::get().disable(); }
+};
+
+TEST_F(TraceRecorderTest, RecordsOnlyWhileEnabled) {
+  auto& trace_recorder = TraceRecorder::get();
+  const auto now = std::chrono::steady_clock::now();
+
+  trace_recorder.enable();
+  trace_recorder.record(TraceEventCategory::Task, "first", now, now + std::chrono::microseconds{5});
+  trace_recorder.disable();
+  EXPECT_FALSE(trace_recorder.is_enabled());
+  trace_recorder.record(TraceEventCategory::Task, "second", now, now);
+
+  const auto events = trace_recorder.events();
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_EQ(events[0].category, TraceEventCategory::Task);
+  EXPECT_EQ(events[0].name, "first");
+  EXPECT_EQ(events[0].duration, std::chrono::microseconds{5});
+  EXPECT_EQ(events[0].node_id, INVALID_NODE_ID);
+  EXPECT_FALSE(events[0].row_count);
+
+  // Enabling the recording again discards the previous spans
+  trace_recorder.enable();
+  EXPECT_TRUE(trace_recorder.events().empty());
+}
+
+TEST_F(TraceRecorderTest, RingBufferKeepsMostRecentSpans) {
+  auto& trace_recorder = TraceRecorder::get();
+  const auto now = std::chrono::steady_clock::now();
+
+  trace_recorder.enable();
+  for (auto index = size_t{0}; index < TraceRecorder::CAPACITY + 10; ++index) {
+    trace_recorder.record(TraceEventCategory::Operator, std::string(40, 'a'), now,
+                          now + std::chrono::nanoseconds{index}, index);
+  }
+
+  const auto events = trace_recorder.events();
+  ASSERT_EQ(events.size(), TraceRecorder::CAPACITY);
+  EXPECT_EQ(events.front().row_count, uint64_t{10});
+  EXPECT_EQ(events.back().row_count, uint64_t{TraceRecorder::CAPACITY + 9});
+
+  // Names are truncated
+  EXPECT_EQ(events.front().name, std::string(TraceRecorder::MAX_NAME_LENGTH, 'a'));
+}
+
+TEST_F(TraceRecorderTest, RecordsOperatorsAndJobTasks) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto& trace_recorder = TraceRecorder::get();
+  trace_recorder.enable();
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float.tbl", 2));
+  table_wrapper->execute();
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto job_id = 0; job_id < 4; ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([]() {}));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  CurrentScheduler::get()->finish();
+
+  trace_recorder.disable();
+
+  auto operator_count = size_t{0};
+  auto job_count = size_t{0};
+  for (const auto& event : trace_recorder.events()) {
+    if (event.category == TraceEventCategory::Operator) {
+      ++operator_count;
+      EXPECT_EQ(event.name, "TableWrapper");
+      EXPECT_EQ(event.row_count, uint64_t{3});
+    } else {
+      ++job_count;
+      EXPECT_EQ(event.name, "JobTask");
+      EXPECT_NE(event.node_id, INVALID_NODE_ID);
+    }
+  }
+  EXPECT_EQ(operator_count, 1u);
+  EXPECT_EQ(job_count, 4u);
+}
+
+TEST_F(TraceRecorderTest, WriteChromeTrace) {
+  auto& trace_recorder = TraceRecorder::get();
+  const auto now = std::chrono::steady_clock::now();
+
+  trace_recorder.enable();
+  trace_recorder.record(TraceEventCategory::Operator, "TableScan", now, now + std::chrono::microseconds{3}, 42);
+  trace_recorder.disable();
+
+  auto stream = std::stringstream{};
+  trace_recorder.write_chrome_trace(stream);
+  const auto trace = nlohmann::json::parse(stream.str());
+
+  // Metadata events for the process and thread, followed by the span
+  const auto& trace_events = trace.at("traceEvents");
+  ASSERT_EQ(trace_events.size(), 3u);
+  EXPECT_EQ(trace_events[0].at("name"), "process_name");
+  EXPECT_EQ(trace_events[1].at("name"), "thread_name");
+
+  const auto& span = trace_events[2];
+  EXPECT_EQ(span.at("name"), "TableScan");
+  EXPECT_EQ(span.at("cat"), "operator");
+  EXPECT_EQ(span.at("ph"), "X");
+  EXPECT_EQ(span.at("pid"), 0);
+  EXPECT_DOUBLE_EQ(span.at("dur").get<double>(), 3.0);
+  EXPECT_EQ(span.at("args").at("rows"), 42);
+}
+
+}  // namespace opossum